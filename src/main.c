@@ -16,7 +16,7 @@ int main()
     scheduler_init();
     log_init();
     comm_init();
-    midi_init(M_BANK_0, P_BANK_0, ENVELOPES);
+    midi_init(M_BANKS, P_BANK_0_IMAGES, ENVELOPES);
     midi_receiver_init();
     ui_init();
     SYS_setVIntAligned(false);
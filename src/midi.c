@@ -1,17 +1,23 @@
 #include "midi.h"
+#include "bits.h"
 #include "comm.h"
 #include "log.h"
 #include "memcmp.h"
 #include "memory.h"
+#include "midi_dac.h"
 #include "midi_fm.h"
+#include "midi_fm_special.h"
 #include "midi_psg.h"
 #include "midi_sender.h"
+#include "persistence.h"
+#include "sample_bank.h"
+#include "pitch.h"
 #include "synth.h"
 #include "ui_fm.h"
 #include <stdbool.h>
+#include <stddef.h>
 
 #define MIN_MIDI_VELOCITY 0
-#define RANGE(value, range) (value / (128 / range))
 #define CHANNEL_UNASSIGNED 0xFF
 #define LENGTH_OF(x) (sizeof(x) / sizeof(x[0]))
 
@@ -24,8 +30,16 @@ typedef struct MidiChannel MidiChannel;
 struct MidiChannel {
     u8 volume;
     u8 program;
+    u8 bank;
+    u8 pendingBank;
     u8 pan;
     u16 pitchBend;
+    s16 bend;
+    u8 bendSemitones;
+    u8 bendCents;
+    u16 rpn;
+    bool sustain;
+    bool sostenuto;
     DeviceSelect deviceSelect;
 };
 
@@ -33,7 +47,102 @@ typedef enum MappingMode MappingMode;
 
 enum MappingMode { MappingMode_Static, MappingMode_Dynamic, MappingMode_Auto };
 
-static DeviceChannel deviceChannels[DEV_CHANS];
+typedef struct ControlChange ControlChange;
+
+struct ControlChange {
+    void (*handler)(u8 chan, u8 op, u8 value);
+    u8 op;
+    u8 shift;
+    u8 flags;
+    u8 patchField;
+};
+
+#define CC_NON_GENERAL_MIDI 0x01
+#define CC_FM_CHANNEL 0x02
+#define CC_COALESCE 0x04
+
+typedef struct PendingControlChange PendingControlChange;
+
+struct PendingControlChange {
+    u8 chan;
+    u8 function;
+    u8 value;
+};
+
+#define MTS_NAME_LENGTH 16
+#define MTS_FREQUENCY_LENGTH 3
+#define MTS_NO_CHANGE 0x7F
+#define MIDI_KEYS 128
+
+#define SYSEX_HEADER_LENGTH 4
+#define SYSEX_ARGS_LENGTH (1 + SYSEX_FM_PATCH_LENGTH)
+#define SYSEX_RECORD_LENGTH (1 + MTS_FREQUENCY_LENGTH)
+
+typedef struct SysExHandler SysExHandler;
+
+struct SysExHandler {
+    void (*begin)(void);
+    void (*chunk)(const u8* data, u16 length);
+    void (*end)(void);
+};
+
+typedef struct SysExEnvelope SysExEnvelope;
+
+struct SysExEnvelope {
+    bool hasProgram;
+    u8 program;
+    u8 steps[MAX_EEF_LENGTH];
+};
+
+typedef struct SysExRecords SysExRecords;
+
+struct SysExRecords {
+    u8 skip;
+    bool counted;
+    u8 remaining;
+    u8 length;
+    u8 index;
+    u8 record[SYSEX_RECORD_LENGTH];
+    u8 key;
+    void (*apply)(const u8* record);
+};
+
+/* SysEx messages are dispatched on their first SYSEX_HEADER_LENGTH bytes
+   and the rest is handed to the matching handler as it arrives, so only the
+   handler's own state is held rather than the whole message. */
+typedef struct SysExStream SysExStream;
+
+struct SysExStream {
+    u8 header[SYSEX_HEADER_LENGTH];
+    u8 headerLength;
+    const SysExHandler* handler;
+    u16 length;
+    union {
+        u8 args[SYSEX_ARGS_LENGTH];
+        SysExEnvelope envelope;
+        SysExRecords records;
+    } state;
+};
+
+#define RPN_PITCH_BEND_SENSITIVITY 0
+#define RPN_NULL 0x3FFF
+
+#define MAX_PERCUSSION_POLYPHONY 2
+#define MAX_PENDING_CONTROL_CHANGES 32
+#define PATCH_SHADOW_PROGRAM 0x80
+#define INVALID_PROGRAM 0xFF
+
+#define SETTINGS_LENGTH (2 + ALL_DEV_CHANS)
+#define SETTING_DYNAMIC_MODE 0x01
+#define SETTING_INVERT_TOTAL_LEVEL 0x02
+#define SETTING_NON_GENERAL_MIDI_CCS 0x04
+#define SETTING_STICK_TO_DEVICE_TYPE 0x08
+#define NO_PROGRAM_ENVELOPE 0xFF
+
+static DeviceChannel deviceChannels[ALL_DEV_CHANS];
+static u16 mappedDeviceChannels[MIDI_CHANNELS];
+static u16 deferredNoteOffs[MIDI_CHANNELS];
+static u16 sostenutoNotes[MIDI_CHANNELS];
 
 static const VTable PSG_VTable = { midi_psg_note_on, midi_psg_note_off,
     midi_psg_channel_volume, midi_psg_pitch_bend, midi_psg_program,
@@ -43,14 +152,42 @@ static const VTable FM_VTable = { midi_fm_note_on, midi_fm_note_off,
     midi_fm_channel_volume, midi_fm_pitch_bend, midi_fm_program,
     midi_fm_all_notes_off, midi_fm_pan };
 
+static const VTable FM_SPECIAL_VTable = { midi_fm_special_note_on,
+    midi_fm_special_note_off, midi_fm_special_channel_volume,
+    midi_fm_special_pitch_bend, midi_fm_special_program,
+    midi_fm_special_all_notes_off, midi_fm_special_pan };
+
+static const VTable DAC_VTable = { midi_dac_note_on, midi_dac_note_off,
+    midi_dac_channel_volume, midi_dac_pitch_bend, midi_dac_program,
+    midi_dac_all_notes_off, midi_dac_pan };
+
 static MappingMode mappingModePref;
 static MidiChannel midiChannels[MIDI_CHANNELS];
 static bool dynamicMode;
 static bool disableNonGeneralMidiCCs;
 static bool stickToDeviceType;
+static bool specialMode;
+static bool dacMode;
 static bool invertTotalLevel;
+static u8 controllerMappings[MIDI_CONTROLLERS];
+static bool coalesceUpdates;
+/* Coalesced messages replaced by a later one before being applied. These
+   are MIDI updates, not register writes: a superseded pitch bend may have
+   cost several writes, an unchanged pan none. */
+static u16 supersededUpdates;
+static PendingControlChange pendingControlChanges[MAX_PENDING_CONTROL_CHANGES];
+static u8 pendingControlChangeCount;
+static u16 pendingPitchBends;
+static u16 pendingPitchBendValues[MIDI_CHANNELS];
+static bool parametersVisible;
+static FmChannel patchShadows[MIDI_CHANNELS];
+static u16 editedPatches;
+static bool settingsUnsaved;
+static u8 parametersMidiChannel;
+static SysExStream sysEx;
 
 static void allNotesOff(u8 chan);
+static void clearDeferredNoteOff(DeviceChannel* devChan);
 static void generalMidiReset(void);
 static void applyDynamicMode(void);
 static void sendPong(void);
@@ -60,33 +197,68 @@ static void setOperatorTotalLevel(u8 chan, u8 op, u8 value);
 static void updateDeviceChannelFromAssociatedMidiChannel(
     DeviceChannel* devChan);
 static DeviceChannel* deviceChannelByMidiChannel(u8 midiChannel);
+static void assignMidiChannel(DeviceChannel* devChan, u8 midiChannel);
+static void resetControllerMappings(void);
+static void remapController(u8 controller, u8 function);
+static void flushPendingUpdates(void);
+static void setCoalesceUpdates(bool enabled);
+static void setSpecialMode(bool enable);
+static void setDacMode(bool enable);
+static void loadFmPatch(u8 target, const u8* data);
+static void dumpFmPatch(u8 target);
+static void storeUserPreset(u8 slot, const u8* data, u16 length);
+static void saveSettings(void);
+static void restoreSettings(void);
 
 static void initMidiChannel(u8 midiChan)
 {
     MidiChannel* chan = &midiChannels[midiChan];
     chan->program = 0;
+    chan->bank = 0;
+    chan->pendingBank = 0;
     chan->pan = DEFAULT_MIDI_PAN;
     chan->volume = MAX_MIDI_VOLUME;
     chan->pitchBend = DEFAULT_MIDI_PITCH_BEND;
+    chan->bend = 0;
+    chan->rpn = RPN_NULL;
+    chan->sustain = false;
+    chan->sostenuto = false;
     chan->deviceSelect = Auto;
+    deferredNoteOffs[midiChan] = 0;
+    sostenutoNotes[midiChan] = 0;
+}
+
+static void initPitchBendRange(u8 midiChan)
+{
+    MidiChannel* chan = &midiChannels[midiChan];
+    chan->bendSemitones = GENERAL_MIDI_PITCH_BEND_SEMITONE_RANGE;
+    chan->bendCents = 0;
 }
 
 static void initDeviceChannel(u8 devChan)
 {
     DeviceChannel* chan = &deviceChannels[devChan];
-    bool isFm = devChan < DEV_CHAN_MIN_PSG;
-    chan->number = isFm ? devChan : devChan - DEV_CHAN_MIN_PSG;
-    chan->ops = isFm ? &FM_VTable : &PSG_VTable;
+    if (devChan == DEV_CHAN_DAC) {
+        chan->number = 0;
+        chan->ops = &DAC_VTable;
+    } else if (devChan >= DEV_CHAN_MIN_SPECIAL) {
+        chan->number = devChan - DEV_CHAN_MIN_SPECIAL;
+        chan->ops = &FM_SPECIAL_VTable;
+    } else {
+        bool isFm = devChan < DEV_CHAN_MIN_PSG;
+        chan->number = isFm ? devChan : devChan - DEV_CHAN_MIN_PSG;
+        chan->ops = isFm ? &FM_VTable : &PSG_VTable;
+    }
     chan->noteOn = false;
-    chan->midiChannel = devChan;
+    assignMidiChannel(chan, devChan);
     chan->pitch = 0;
-    chan->pitchBend = DEFAULT_MIDI_PITCH_BEND;
+    chan->pitchBend = 0;
     updateDeviceChannelFromAssociatedMidiChannel(chan);
 }
 
 static void initAllDeviceChannels(void)
 {
-    for (u16 i = 0; i < DEV_CHANS; i++) {
+    for (u16 i = 0; i < ALL_DEV_CHANS; i++) {
         initDeviceChannel(i);
     }
 }
@@ -95,41 +267,80 @@ static void resetAllState(void)
 {
     for (u8 i = 0; i < MIDI_CHANNELS; i++) {
         initMidiChannel(i);
+        initPitchBendRange(i);
+        mappedDeviceChannels[i] = 0;
     }
     initAllDeviceChannels();
     applyDynamicMode();
 }
 
 static const u8** defaultEnvelopes;
-static const FmChannel** defaultPresets;
-static const PercussionPreset** defaultPercussionPresets;
+static const FmPresetImage*** defaultPresetBanks;
+static const PercussionPresetImage* defaultPercussionPresets;
 
 static void init(void)
 {
+    pitch_init();
     midi_psg_init(defaultEnvelopes);
-    midi_fm_init(defaultPresets, defaultPercussionPresets);
+    midi_fm_init(defaultPresetBanks, defaultPercussionPresets);
+    midi_fm_special_init();
+    sample_bank_init();
     mappingModePref = MappingMode_Auto;
     dynamicMode = false;
     disableNonGeneralMidiCCs = false;
     stickToDeviceType = false;
+    specialMode = false;
+    dacMode = false;
+    resetControllerMappings();
+    coalesceUpdates = false;
+    supersededUpdates = 0;
+    pendingControlChangeCount = 0;
+    pendingPitchBends = 0;
+    parametersVisible = false;
+    editedPatches = 0;
+    settingsUnsaved = false;
     resetAllState();
+    restoreSettings();
 }
 
-void midi_init(const FmChannel** presets,
-    const PercussionPreset** percussionPresets, const u8** envelopes)
+void midi_init(const FmPresetImage** presetBanks[],
+    const PercussionPresetImage* percussionPresets, const u8** envelopes)
 {
     defaultEnvelopes = envelopes;
-    defaultPresets = presets;
+    defaultPresetBanks = presetBanks;
     defaultPercussionPresets = percussionPresets;
     init();
 }
 
+static u16 deviceChannelsMappedTo(u8 midiChannel)
+{
+    return midiChannel < MIDI_CHANNELS ? mappedDeviceChannels[midiChannel] : 0;
+}
+
+static u16 deviceChannelRange(u8 minDevChan, u8 maxDevChan)
+{
+    return ((1 << (maxDevChan + 1)) - 1) & ~((1 << minDevChan) - 1);
+}
+
+static void assignMidiChannel(DeviceChannel* devChan, u8 midiChannel)
+{
+    u8 index = devChan - deviceChannels;
+    if (devChan->midiChannel < MIDI_CHANNELS) {
+        CLEAR_BIT(mappedDeviceChannels[devChan->midiChannel], index);
+    }
+    devChan->midiChannel = midiChannel;
+    if (midiChannel < MIDI_CHANNELS) {
+        SET_BIT(mappedDeviceChannels[midiChannel], index);
+    }
+}
+
 static DeviceChannel* findChannelPlayingNote(u8 midiChannel, u8 pitch)
 {
-    for (u16 i = 0; i < DEV_CHANS; i++) {
+    u16 mapped = deviceChannelsMappedTo(midiChannel);
+    for (u8 i = 0; mapped != 0; i++, mapped >>= 1) {
         DeviceChannel* chan = &deviceChannels[i];
-        if (chan->noteOn && chan->midiChannel == midiChannel
-            && chan->pitch == pitch) {
+        if ((mapped & 1) && chan->noteOn && chan->pitch == pitch
+            && !CHECK_BIT(deferredNoteOffs[midiChannel], i)) {
             return chan;
         }
     }
@@ -143,21 +354,39 @@ static bool isPsgAndIncomingChanIsPercussive(
         && incomingChan == GENERAL_MIDI_PERCUSSION_CHANNEL;
 }
 
+static bool isDeviceChannelDisabled(u8 devChan)
+{
+    if (devChan == DEV_CHAN_DAC) {
+        return !dacMode;
+    }
+    if (devChan >= DEV_CHAN_MIN_SPECIAL) {
+        return !specialMode;
+    }
+    if (devChan == DEV_CHAN_MIN_FM + SPECIAL_MODE_CHANNEL) {
+        return specialMode;
+    }
+    if (devChan == DEV_CHAN_MIN_FM + DAC_CHANNEL) {
+        return dacMode;
+    }
+    return false;
+}
+
 static bool isChannelSuitable(DeviceChannel* chan, u8 incomingMidiChan)
 {
     return !chan->noteOn
-        && !isPsgAndIncomingChanIsPercussive(chan, incomingMidiChan);
+        && !isPsgAndIncomingChanIsPercussive(chan, incomingMidiChan)
+        && !isDeviceChannelDisabled(chan - deviceChannels);
 }
 
 static DeviceChannel* findFreeMidiAssignedChannel(
     u8 incomingMidiChan, u8 devChanMin, u8 devChanMax)
 {
-    for (u16 i = devChanMin; i <= devChanMax; i++) {
+    u16 mapped = deviceChannelsMappedTo(incomingMidiChan)
+        & deviceChannelRange(devChanMin, devChanMax);
+    for (u8 i = 0; mapped != 0; i++, mapped >>= 1) {
         DeviceChannel* chan = &deviceChannels[i];
-        if (chan->midiChannel == incomingMidiChan) {
-            if (isChannelSuitable(chan, incomingMidiChan)) {
-                return chan;
-            }
+        if ((mapped & 1) && isChannelSuitable(chan, incomingMidiChan)) {
+            return chan;
         }
     }
     return NULL;
@@ -194,6 +423,66 @@ static DeviceChannel* findAnyFreeChannel(
     return NULL;
 }
 
+static DeviceChannel* findSustainedChannel(
+    u8 incomingMidiChan, u8 minDevChan, u8 maxDevChan)
+{
+    for (u16 i = minDevChan; i <= maxDevChan; i++) {
+        DeviceChannel* chan = &deviceChannels[i];
+        if (chan->midiChannel < MIDI_CHANNELS
+            && CHECK_BIT(deferredNoteOffs[chan->midiChannel], i)
+            && !isPsgAndIncomingChanIsPercussive(chan, incomingMidiChan)) {
+            return chan;
+        }
+    }
+    return NULL;
+}
+
+static bool percussionPolyphonyReached(void)
+{
+    u16 counter = 0;
+    u16 mapped = deviceChannelsMappedTo(GENERAL_MIDI_PERCUSSION_CHANNEL)
+        & deviceChannelRange(DEV_CHAN_MIN_FM, DEV_CHAN_MAX_PSG);
+    for (u8 i = 0; mapped != 0; i++, mapped >>= 1) {
+        if ((mapped & 1) && deviceChannels[i].noteOn) {
+            counter++;
+        }
+        if (counter >= MAX_PERCUSSION_POLYPHONY) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool acceptsExtraPercussionVoices(u8 incomingMidiChan)
+{
+    DeviceSelect deviceSelect = midiChannels[incomingMidiChan].deviceSelect;
+    return incomingMidiChan == GENERAL_MIDI_PERCUSSION_CHANNEL
+        && (deviceSelect == Auto || deviceSelect == FM);
+}
+
+static DeviceChannel* findDacChannel(u8 incomingMidiChan, u8 pitch)
+{
+    if (!dacMode || !acceptsExtraPercussionVoices(incomingMidiChan)
+        || !midi_dac_has_sample(pitch)) {
+        return NULL;
+    }
+    return &deviceChannels[DEV_CHAN_DAC];
+}
+
+static DeviceChannel* findFreeSpecialModeVoice(u8 incomingMidiChan)
+{
+    if (!specialMode || !acceptsExtraPercussionVoices(incomingMidiChan)) {
+        return NULL;
+    }
+    for (u16 i = DEV_CHAN_MIN_SPECIAL; i <= DEV_CHAN_MAX_SPECIAL; i++) {
+        DeviceChannel* chan = &deviceChannels[i];
+        if (!chan->noteOn) {
+            return chan;
+        }
+    }
+    return NULL;
+}
+
 static DeviceChannel* findDeviceSpecificChannel(
     u8 incomingMidiChan, u8 minDevChan, u8 maxDevChan)
 {
@@ -216,9 +505,16 @@ static DeviceChannel* findDeviceSpecificChannel(
             return chan;
         }
     }
-    for (u16 i = minChan; i <= maxChan; i++) {
+    DeviceChannel* sustainedChan
+        = findSustainedChannel(incomingMidiChan, minChan, maxChan);
+    if (sustainedChan != NULL) {
+        return sustainedChan;
+    }
+    u16 mapped = deviceChannelsMappedTo(incomingMidiChan)
+        & deviceChannelRange(minChan, maxChan);
+    for (u8 i = 0; mapped != 0; i++, mapped >>= 1) {
         DeviceChannel* chan = &deviceChannels[i];
-        if (chan->midiChannel == incomingMidiChan
+        if ((mapped & 1)
             && !isPsgAndIncomingChanIsPercussive(chan, incomingMidiChan)) {
             return chan;
         }
@@ -245,13 +541,43 @@ static void setDeviceMinMaxChans(
     }
 }
 
-static DeviceChannel* findFreeChannel(u8 incomingMidiChan)
+static DeviceChannel* findFreeChannelWithPercussionPreset(
+    u8 pitch, u8 minDevChan, u8 maxDevChan)
+{
+    if (maxDevChan > DEV_CHAN_MAX_FM) {
+        maxDevChan = DEV_CHAN_MAX_FM;
+    }
+    for (u16 i = minDevChan; i <= maxDevChan; i++) {
+        DeviceChannel* chan = &deviceChannels[i];
+        if (isChannelSuitable(chan, GENERAL_MIDI_PERCUSSION_CHANNEL)
+            && midi_fm_percussion_preset(chan->number) == pitch) {
+            return chan;
+        }
+    }
+    return NULL;
+}
+
+static DeviceChannel* findFreeChannel(u8 incomingMidiChan, u8 pitch)
 {
     u8 minDevChan;
     u8 maxDevChan;
     setDeviceMinMaxChans(incomingMidiChan, &minDevChan, &maxDevChan);
-    DeviceChannel* chan
-        = findFreeMidiAssignedChannel(incomingMidiChan, minDevChan, maxDevChan);
+    DeviceChannel* chan;
+    if (incomingMidiChan == GENERAL_MIDI_PERCUSSION_CHANNEL) {
+        chan = findDacChannel(incomingMidiChan, pitch);
+        if (chan != NULL) {
+            return chan;
+        }
+        if (percussionPolyphonyReached()) {
+            return findFreeSpecialModeVoice(incomingMidiChan);
+        }
+        chan = findFreeChannelWithPercussionPreset(
+            pitch, minDevChan, maxDevChan);
+        if (chan != NULL) {
+            return chan;
+        }
+    }
+    chan = findFreeMidiAssignedChannel(incomingMidiChan, minDevChan, maxDevChan);
     if (chan != NULL) {
         return chan;
     }
@@ -270,26 +596,14 @@ static DeviceChannel* findFreeChannel(u8 incomingMidiChan)
     return NULL;
 }
 
-static bool tooManyPercussiveNotes(u8 midiChan)
+static bool tooManyPercussiveNotes(u8 midiChan, u8 pitch)
 {
-    const u8 MAX_POLYPHONY = 2;
-
-    if (midiChan != GENERAL_MIDI_PERCUSSION_CHANNEL) {
+    if (midiChan != GENERAL_MIDI_PERCUSSION_CHANNEL
+        || findDacChannel(midiChan, pitch) != NULL) {
         return false;
     }
-
-    u16 counter = 0;
-    for (u16 i = 0; i < DEV_CHANS; i++) {
-        DeviceChannel* chan = &deviceChannels[i];
-        if (chan->midiChannel == GENERAL_MIDI_PERCUSSION_CHANNEL
-            && chan->noteOn) {
-            counter++;
-        }
-        if (counter >= MAX_POLYPHONY) {
-            return true;
-        }
-    }
-    return false;
+    return percussionPolyphonyReached()
+        && findFreeSpecialModeVoice(midiChan) == NULL;
 }
 
 static void updateVolume(MidiChannel* midiChannel, DeviceChannel* devChan)
@@ -310,17 +624,34 @@ static void updatePan(MidiChannel* midiChannel, DeviceChannel* devChan)
 
 static void updatePitchBend(MidiChannel* midiChannel, DeviceChannel* devChan)
 {
-    if (devChan->pitchBend != midiChannel->pitchBend) {
-        devChan->ops->pitchBend(devChan->number, midiChannel->pitchBend);
-        devChan->pitchBend = midiChannel->pitchBend;
+    if (devChan->pitchBend != midiChannel->bend) {
+        devChan->ops->pitchBend(devChan->number, midiChannel->bend);
+        devChan->pitchBend = midiChannel->bend;
     }
 }
 
+static bool isFmChannel(DeviceChannel* devChan)
+{
+    return devChan->ops == &FM_VTable;
+}
+
 static void updateProgram(MidiChannel* midiChannel, DeviceChannel* devChan)
 {
-    if (devChan->program != midiChannel->program) {
-        devChan->ops->program(devChan->number, midiChannel->program);
+    u8 midiChan = midiChannel - midiChannels;
+    if (CHECK_BIT(editedPatches, midiChan) && isFmChannel(devChan)) {
+        u8 program = PATCH_SHADOW_PROGRAM | midiChan;
+        if (devChan->program != program) {
+            midi_fm_preset(devChan->number, &patchShadows[midiChan]);
+            devChan->program = program;
+        }
+        return;
+    }
+    if (devChan->program != midiChannel->program
+        || devChan->bank != midiChannel->bank) {
+        devChan->ops->program(
+            devChan->number, midiChannel->bank, midiChannel->program);
         devChan->program = midiChannel->program;
+        devChan->bank = midiChannel->bank;
     }
 }
 
@@ -332,10 +663,10 @@ static void channelDeviceSelect(u8 midiChan, DeviceSelect deviceSelect)
 
 static DeviceChannel* deviceChannelByMidiChannel(u8 midiChannel)
 {
-    for (u8 i = 0; i < DEV_CHANS; i++) {
-        DeviceChannel* chan = &deviceChannels[i];
-        if (chan->midiChannel == midiChannel) {
-            return chan;
+    u16 mapped = deviceChannelsMappedTo(midiChannel);
+    for (u8 i = 0; mapped != 0; i++, mapped >>= 1) {
+        if (mapped & 1) {
+            return &deviceChannels[i];
         }
     }
     return NULL;
@@ -344,59 +675,113 @@ static DeviceChannel* deviceChannelByMidiChannel(u8 midiChannel)
 static void updateDeviceChannelFromAssociatedMidiChannel(DeviceChannel* devChan)
 {
     MidiChannel* midiChannel = &midiChannels[devChan->midiChannel];
-    midi_fm_percussive(devChan->number,
-        devChan->midiChannel == GENERAL_MIDI_PERCUSSION_CHANNEL);
+    if (isFmChannel(devChan)) {
+        midi_fm_percussive(devChan->number,
+            devChan->midiChannel == GENERAL_MIDI_PERCUSSION_CHANNEL);
+    }
     updateVolume(midiChannel, devChan);
     updatePan(midiChannel, devChan);
     updateProgram(midiChannel, devChan);
     updatePitchBend(midiChannel, devChan);
 }
 
-static DeviceChannel* findSuitableDeviceChannel(u8 midiChan)
+static DeviceChannel* findSuitableDeviceChannel(u8 midiChan, u8 pitch)
 {
-    return dynamicMode ? findFreeChannel(midiChan)
+    return dynamicMode ? findFreeChannel(midiChan, pitch)
                        : deviceChannelByMidiChannel(midiChan);
 }
 
 void midi_note_on(u8 chan, u8 pitch, u8 velocity)
 {
+    flushPendingUpdates();
     if (velocity == MIN_MIDI_VELOCITY) {
         midi_note_off(chan, pitch);
         return;
     }
-    if (tooManyPercussiveNotes(chan)) {
+    if (tooManyPercussiveNotes(chan, pitch)) {
         return;
     }
-    DeviceChannel* devChan = findSuitableDeviceChannel(chan);
+    DeviceChannel* devChan = findSuitableDeviceChannel(chan, pitch);
     if (devChan == NULL) {
         log_warn("Ch %d: Dropped note %d", chan + 1, pitch);
         return;
     }
-    devChan->midiChannel = chan;
+    clearDeferredNoteOff(devChan);
+    assignMidiChannel(devChan, chan);
     updateDeviceChannelFromAssociatedMidiChannel(devChan);
     devChan->pitch = pitch;
     devChan->noteOn = true;
     devChan->ops->noteOn(devChan->number, pitch, velocity);
 }
 
+static void releaseNote(DeviceChannel* devChan)
+{
+    u8 pitch = devChan->pitch;
+    devChan->noteOn = false;
+    devChan->pitch = 0;
+    devChan->ops->noteOff(devChan->number, pitch);
+}
+
+static bool isNoteHeldByPedal(u8 chan, u8 devChanIndex)
+{
+    return midiChannels[chan].sustain
+        || CHECK_BIT(sostenutoNotes[chan], devChanIndex);
+}
+
 void midi_note_off(u8 chan, u8 pitch)
 {
+    flushPendingUpdates();
     DeviceChannel* devChan;
     while ((devChan = findChannelPlayingNote(chan, pitch)) != NULL) {
-        devChan->noteOn = false;
-        devChan->pitch = 0;
-        devChan->ops->noteOff(devChan->number, pitch);
+        u8 index = devChan - deviceChannels;
+        if (isNoteHeldByPedal(chan, index)) {
+            SET_BIT(deferredNoteOffs[chan], index);
+        } else {
+            releaseNote(devChan);
+        }
+    }
+}
+
+static void clearDeferredNoteOff(DeviceChannel* devChan)
+{
+    if (devChan->midiChannel < MIDI_CHANNELS) {
+        u8 index = devChan - deviceChannels;
+        CLEAR_BIT(deferredNoteOffs[devChan->midiChannel], index);
+        CLEAR_BIT(sostenutoNotes[devChan->midiChannel], index);
+    }
+}
+
+static void releaseDeferredNoteOffs(u8 chan, u16 devChans)
+{
+    u16 released = deferredNoteOffs[chan] & devChans;
+    deferredNoteOffs[chan] &= ~devChans;
+    for (u8 i = 0; released != 0; i++, released >>= 1) {
+        if (released & 1) {
+            releaseNote(&deviceChannels[i]);
+        }
+    }
+}
+
+static u16 keysDown(u8 chan)
+{
+    u16 down = 0;
+    u16 mapped = deviceChannelsMappedTo(chan);
+    for (u8 i = 0; mapped != 0; i++, mapped >>= 1) {
+        if ((mapped & 1) && deviceChannels[i].noteOn) {
+            SET_BIT(down, i);
+        }
     }
+    return down & ~deferredNoteOffs[chan];
 }
 
 static void channelPan(u8 chan, u8 pan)
 {
     MidiChannel* midiChannel = &midiChannels[chan];
     midiChannel->pan = pan;
-    for (u8 i = 0; i < DEV_CHANS; i++) {
-        DeviceChannel* devChan = &deviceChannels[i];
-        if (devChan->midiChannel == chan) {
-            updatePan(midiChannel, devChan);
+    u16 mapped = deviceChannelsMappedTo(chan);
+    for (u8 i = 0; mapped != 0; i++, mapped >>= 1) {
+        if (mapped & 1) {
+            updatePan(midiChannel, &deviceChannels[i]);
         }
     }
 }
@@ -405,20 +790,21 @@ static void channelVolume(u8 chan, u8 volume)
 {
     MidiChannel* midiChannel = &midiChannels[chan];
     midiChannel->volume = volume;
-    for (u8 i = 0; i < DEV_CHANS; i++) {
-        DeviceChannel* state = &deviceChannels[i];
-        if (state->midiChannel == chan) {
-            updateVolume(midiChannel, state);
+    u16 mapped = deviceChannelsMappedTo(chan);
+    for (u8 i = 0; mapped != 0; i++, mapped >>= 1) {
+        if (mapped & 1) {
+            updateVolume(midiChannel, &deviceChannels[i]);
         }
     }
 }
 
 void resetAllControllers(u8 chan)
 {
+    releaseDeferredNoteOffs(chan, deviceChannelRange(0, ALL_DEV_CHANS - 1));
     initMidiChannel(chan);
-    for (u8 i = 0; i < DEV_CHANS; i++) {
-        DeviceChannel* state = &deviceChannels[i];
-        if (state->midiChannel == chan) {
+    u16 mapped = deviceChannelsMappedTo(chan);
+    for (u8 i = 0; mapped != 0; i++, mapped >>= 1) {
+        if (mapped & 1) {
             initDeviceChannel(i);
         }
     }
@@ -438,29 +824,69 @@ static void setPolyphonicMode(bool enable)
             midi_remap_channel(0, chan);
         }
     }
+    saveSettings();
 }
 
-void midi_pitch_bend(u8 chan, u16 bend)
+static void applyPitchBend(u8 chan)
 {
     MidiChannel* midiChannel = &midiChannels[chan];
-    midiChannel->pitchBend = bend;
-    for (DeviceChannel* state = &deviceChannels[0];
-         state < &deviceChannels[DEV_CHANS]; state++) {
-        if (state->midiChannel == chan && state->noteOn) {
+    midiChannel->bend = pitch_bendOffset(midiChannel->pitchBend,
+        pitch_bendRange(midiChannel->bendSemitones, midiChannel->bendCents));
+    u16 mapped = deviceChannelsMappedTo(chan);
+    for (u8 i = 0; mapped != 0; i++, mapped >>= 1) {
+        DeviceChannel* state = &deviceChannels[i];
+        if ((mapped & 1) && state->noteOn) {
             updatePitchBend(midiChannel, state);
         }
     }
 }
 
+static void channelPitchBend(u8 chan, u16 bend)
+{
+    midiChannels[chan].pitchBend = bend;
+    applyPitchBend(chan);
+}
+
+static void countSupersededUpdate(void)
+{
+    if (supersededUpdates != 0xFFFF) {
+        supersededUpdates++;
+    }
+}
+
+void midi_pitch_bend(u8 chan, u16 bend)
+{
+    if (coalesceUpdates) {
+        if (CHECK_BIT(pendingPitchBends, chan)) {
+            countSupersededUpdate();
+        }
+        SET_BIT(pendingPitchBends, chan);
+        pendingPitchBendValues[chan] = bend;
+        return;
+    }
+    channelPitchBend(chan, bend);
+}
+
+static void applyProgram(u8 chan)
+{
+    MidiChannel* midiChannel = &midiChannels[chan];
+    u16 mapped = deviceChannelsMappedTo(chan);
+    for (u8 i = 0; mapped != 0; i++, mapped >>= 1) {
+        if (mapped & 1) {
+            updateProgram(midiChannel, &deviceChannels[i]);
+        }
+    }
+}
+
 void midi_program(u8 chan, u8 program)
 {
+    flushPendingUpdates();
     MidiChannel* midiChannel = &midiChannels[chan];
     midiChannel->program = program;
-    for (u8 i = 0; i < DEV_CHANS; i++) {
-        DeviceChannel* state = &deviceChannels[i];
-        if (state->midiChannel == chan) {
-            updateProgram(midiChannel, state);
-        }
+    midiChannel->bank = midiChannel->pendingBank;
+    CLEAR_BIT(editedPatches, chan);
+    if (parametersVisible && parametersMidiChannel == chan) {
+        applyProgram(chan);
     }
 }
 
@@ -476,9 +902,14 @@ DeviceChannel* midi_channel_mappings(void)
 
 static void allNotesOff(u8 chan)
 {
-    for (u8 i = 0; i < DEV_CHANS; i++) {
+    if (chan < MIDI_CHANNELS) {
+        deferredNoteOffs[chan] = 0;
+        sostenutoNotes[chan] = 0;
+    }
+    u16 mapped = deviceChannelsMappedTo(chan);
+    for (u8 i = 0; mapped != 0; i++, mapped >>= 1) {
         DeviceChannel* devChan = &deviceChannels[i];
-        if (devChan->midiChannel == chan) {
+        if (mapped & 1) {
             devChan->noteOn = false;
             devChan->pitch = 0;
             devChan->ops->allNotesOff(devChan->number);
@@ -496,32 +927,57 @@ static void setStickToDeviceType(bool enable)
     stickToDeviceType = enable;
 }
 
-static void loadPsgEnvelope(const u8* data, u16 length)
+static bool isMtsNoChange(const u8* frequency)
+{
+    return frequency[0] == MTS_NO_CHANGE && frequency[1] == MTS_NO_CHANGE
+        && frequency[2] == MTS_NO_CHANGE;
+}
+
+static u16 mtsPitch(const u8* frequency)
+{
+    /* semitone, then a 14-bit fraction of a semitone */
+    return ((u16)frequency[0] << PITCH_FRACTION_BITS) | (frequency[1] << 1)
+        | (frequency[2] >> 6);
+}
+
+static void retuneSoundingNotes(u8 key)
 {
-    u8 buffer[256];
-    u16 eefStepIndex = 0;
-    for (u16 i = 0; i < length; i += 2) {
-        buffer[eefStepIndex++] = (data[i] << 4) | data[i + 1];
+    for (u8 i = 0; i < ALL_DEV_CHANS; i++) {
+        DeviceChannel* devChan = &deviceChannels[i];
+        if (devChan->noteOn && devChan->pitch == key) {
+            devChan->ops->pitchBend(devChan->number, devChan->pitchBend);
+        }
     }
-    buffer[eefStepIndex] = EEF_END;
-    midi_psg_load_envelope(buffer);
-    log_info("Loaded User Defined Envelope");
 }
 
-static void incrementSysExCursor(const u8** data, u16* length, u8 value)
+static void doNothing(void)
 {
-    (*data) += value;
-    (*length) -= value;
 }
 
-static void handleCustomSysEx(const u8* data, u16 length)
+static void ignoreChunk(const u8* data, u16 length)
 {
-    u8 command = *data;
-    incrementSysExCursor(&data, &length, 1);
-    switch (command) {
+    (void)data;
+    (void)length;
+}
+
+static void collectArgs(const u8* data, u16 length)
+{
+    for (u16 i = 0; i < length; i++, sysEx.length++) {
+        if (sysEx.length < SYSEX_ARGS_LENGTH) {
+            sysEx.state.args[sysEx.length] = data[i];
+        }
+    }
+}
+
+static void applyCustomCommand(void)
+{
+    const u8* data = sysEx.state.args;
+    u16 length = sysEx.length;
+    switch (sysEx.header[SYSEX_HEADER_LENGTH - 1]) {
     case SYSEX_COMMAND_REMAP:
         if (length == 2) {
             midi_remap_channel(data[0], data[1]);
+            saveSettings();
         }
         break;
     case SYSEX_COMMAND_PING:
@@ -532,95 +988,455 @@ static void handleCustomSysEx(const u8* data, u16 length)
     case SYSEX_COMMAND_DYNAMIC:
         if (length == 1) {
             setDynamicMode((bool)data[0]);
+            saveSettings();
         }
         break;
     case SYSEX_COMMAND_NON_GENERAL_MIDI_CCS:
         if (length == 1) {
             setNonGeneralMidiCCs((bool)data[0]);
+            saveSettings();
         }
         break;
     case SYSEX_COMMAND_STICK_TO_DEVICE_TYPE:
         if (length == 1) {
             setStickToDeviceType((bool)data[0]);
+            saveSettings();
         }
         break;
     case SYSEX_COMMAND_INVERT_TOTAL_LEVEL:
         if (length == 1) {
             setInvertTotalLevel((bool)data[0]);
+            saveSettings();
         }
         break;
-    case SYSEX_COMMAND_LOAD_PSG_ENVELOPE:
-        loadPsgEnvelope(data, length);
+    case SYSEX_COMMAND_REMAP_CC:
+        if (length == 2) {
+            remapController(data[0], data[1]);
+        }
+        break;
+    case SYSEX_COMMAND_COALESCE_UPDATES:
+        if (length == 1) {
+            setCoalesceUpdates((bool)data[0]);
+        }
+        break;
+    case SYSEX_COMMAND_SPECIAL_MODE:
+        if (length == 1) {
+            setSpecialMode((bool)data[0]);
+        }
+        break;
+    case SYSEX_COMMAND_DAC_DRUMS:
+        if (length == 1) {
+            setDacMode((bool)data[0]);
+        }
+        break;
+    case SYSEX_COMMAND_DELETE_SAMPLE:
+        if (length == 1) {
+            sample_bank_delete(data[0]);
+        }
+        break;
+    case SYSEX_COMMAND_LOAD_FM_PATCH:
+        if (length == 1 + SYSEX_FM_PATCH_LENGTH) {
+            loadFmPatch(data[0], &data[1]);
+        }
+        break;
+    case SYSEX_COMMAND_DUMP_FM_PATCH:
+        if (length == 1) {
+            dumpFmPatch(data[0]);
+        }
+        break;
+    case SYSEX_COMMAND_STORE_USER_PRESET:
+        /* either the patch of a channel or an uploaded one */
+        if (length == 2 || length == 1 + SYSEX_FM_PATCH_LENGTH) {
+            storeUserPreset(data[0], &data[1], length - 1);
+        }
         break;
     }
 }
 
-void midi_sysex(const u8* data, u16 length)
+static void envelopeChunk(const u8* data, u16 length)
 {
-    const u8 GENERAL_MIDI_RESET_SEQ[] = { 0x7E, 0x7F, 0x09, 0x01 };
-    if (length < LENGTH_OF(GENERAL_MIDI_RESET_SEQ)) {
-        return;
-    }
-    if (memcmp(data, GENERAL_MIDI_RESET_SEQ, LENGTH_OF(GENERAL_MIDI_RESET_SEQ))
-        == 0) {
-        generalMidiReset();
-        return;
-    }
-
-    const u8 CUSTOM_SYSEX_SEQ[]
-        = { SYSEX_MANU_EXTENDED, SYSEX_MANU_REGION, SYSEX_MANU_ID };
-    if (memcmp(data, CUSTOM_SYSEX_SEQ, LENGTH_OF(CUSTOM_SYSEX_SEQ)) == 0) {
-        incrementSysExCursor(&data, &length, LENGTH_OF(CUSTOM_SYSEX_SEQ));
-        handleCustomSysEx(data, length);
+    /* each EEF step arrives as a pair of nibbles */
+    for (u16 i = 0; i < length; i++, sysEx.length++) {
+        u16 step = sysEx.length / 2;
+        if (step >= MAX_EEF_LENGTH - 1) {
+            continue;
+        }
+        if (sysEx.length % 2 == 0) {
+            sysEx.state.envelope.steps[step] = data[i] << 4;
+        } else {
+            sysEx.state.envelope.steps[step] |= data[i] & 0x0F;
+        }
     }
 }
 
-static void sendPong(void)
+static bool terminateEnvelope(void)
 {
-    const u8 pongSequence[] = { SYSEX_MANU_EXTENDED, SYSEX_MANU_REGION,
-        SYSEX_MANU_ID, SYSEX_COMMAND_PONG };
-
-    midi_sender_send_sysex(pongSequence, sizeof(pongSequence));
+    u16 steps = sysEx.length / 2;
+    if (steps >= MAX_EEF_LENGTH) {
+        log_warn("Envelope too long");
+        return false;
+    }
+    sysEx.state.envelope.steps[steps] = EEF_END;
+    return true;
 }
 
-void midi_remap_channel(u8 midiChan, u8 devChan)
+static void envelopeEnd(void)
 {
-    const u8 SYSEX_UNASSIGNED_DEVICE_CHANNEL = 0x7F;
-    const u8 SYSEX_UNASSIGNED_MIDI_CHANNEL = 0x7F;
-
-    if (devChan == SYSEX_UNASSIGNED_DEVICE_CHANNEL) {
-        DeviceChannel* assignedChan = deviceChannelByMidiChannel(midiChan);
-        if (assignedChan != NULL) {
-            assignedChan->midiChannel = DEFAULT_MIDI_CHANNEL;
-        }
+    if (!terminateEnvelope()) {
         return;
     }
-    DeviceChannel* chan = &deviceChannels[devChan];
-    chan->midiChannel = (midiChan == SYSEX_UNASSIGNED_MIDI_CHANNEL)
-        ? DEFAULT_MIDI_CHANNEL
-        : midiChan;
+    if (!midi_psg_load_envelope(sysEx.state.envelope.steps)) {
+        log_warn("Invalid envelope");
+        return;
+    }
+    log_info("Loaded User Defined Envelope");
+    saveSettings();
 }
 
-static void generalMidiReset(void)
+static void programEnvelopeBegin(void)
 {
-    for (u8 chan = 0; chan < MIDI_CHANNELS; chan++) {
-        allNotesOff(chan);
-    }
-    if (mappingModePref == MappingMode_Auto) {
-        dynamicMode = true;
-    }
-    resetAllState();
+    sysEx.state.envelope.hasProgram = false;
 }
 
-static void applyDynamicMode(void)
+static void programEnvelopeChunk(const u8* data, u16 length)
 {
-    for (u8 chan = 0; chan < DEV_CHANS; chan++) {
-        DeviceChannel* devChan = &deviceChannels[chan];
-        devChan->midiChannel = dynamicMode ? DEFAULT_MIDI_CHANNEL : chan;
+    SysExEnvelope* envelope = &sysEx.state.envelope;
+    if (length > 0 && !envelope->hasProgram) {
+        envelope->program = data[0];
+        envelope->hasProgram = true;
+        data++;
+        length--;
     }
+    envelopeChunk(data, length);
 }
 
-static void setDynamicMode(MappingMode mode)
+static void programEnvelopeEnd(void)
+{
+    SysExEnvelope* envelope = &sysEx.state.envelope;
+    if (!envelope->hasProgram || envelope->program >= MIDI_PROGRAMS) {
+        log_warn("Envelope program?");
+        return;
+    }
+    if (!terminateEnvelope()) {
+        return;
+    }
+    /* an envelope without steps reverts the program to its built-in one */
+    if (envelope->steps[0] == EEF_END) {
+        midi_psg_remove_envelope(envelope->program);
+    } else if (!midi_psg_store_envelope(envelope->program, envelope->steps)) {
+        log_warn("Envelope rejected");
+        return;
+    }
+    saveSettings();
+}
+
+static void sampleUploadBegin(void)
+{
+    sample_bank_upload_begin();
+}
+
+static void sampleUploadEnd(void)
+{
+    sample_bank_upload_end();
+}
+
+static void refuseSampleUpload(void)
+{
+    log_warn("Samples need Z80 driver");
+}
+
+static void recordsChunk(const u8* data, u16 length)
+{
+    SysExRecords* records = &sysEx.state.records;
+    for (u16 i = 0; i < length; i++) {
+        if (records->skip > 0) {
+            records->skip--;
+        } else if (records->counted) {
+            records->remaining = data[i];
+            records->counted = false;
+        } else if (records->remaining > 0) {
+            records->record[records->index++] = data[i];
+            if (records->index == records->length) {
+                records->apply(records->record);
+                records->index = 0;
+                records->remaining--;
+            }
+        }
+    }
+}
+
+static void beginRecords(
+    u8 skip, bool counted, u8 length, void (*apply)(const u8* record))
+{
+    SysExRecords* records = &sysEx.state.records;
+    records->skip = skip;
+    records->counted = counted;
+    records->remaining = MIDI_KEYS;
+    records->length = length;
+    records->index = 0;
+    records->key = 0;
+    records->apply = apply;
+}
+
+static void applyTuningDumpFrequency(const u8* frequency)
+{
+    u8 key = sysEx.state.records.key++;
+    if (!isMtsNoChange(frequency)) {
+        pitch_tune(key, mtsPitch(frequency));
+    }
+}
+
+static void applyNoteTuning(const u8* change)
+{
+    u8 key = change[0];
+    if (key < MIDI_KEYS && !isMtsNoChange(&change[1])) {
+        pitch_tune(key, mtsPitch(&change[1]));
+        if (sysEx.header[0] == SYSEX_UNIVERSAL_REAL_TIME) {
+            retuneSoundingNotes(key);
+        }
+    }
+}
+
+static void tuningDumpBegin(void)
+{
+    beginRecords(1 + MTS_NAME_LENGTH, false, MTS_FREQUENCY_LENGTH,
+        applyTuningDumpFrequency);
+}
+
+static void tuningDumpEnd(void)
+{
+    if (sysEx.state.records.key == MIDI_KEYS) {
+        log_info("Loaded MTS Tuning");
+    }
+}
+
+static void noteTuningBegin(void)
+{
+    /* the bank form carries a tuning bank byte ahead of the program */
+    u8 skip = sysEx.header[SYSEX_HEADER_LENGTH - 1]
+            == SYSEX_MIDI_TUNING_NOTE_CHANGE_BANK
+        ? 2
+        : 1;
+    beginRecords(skip, true, 1 + MTS_FREQUENCY_LENGTH, applyNoteTuning);
+}
+
+static const SysExHandler CUSTOM_COMMAND_HANDLER
+    = { doNothing, collectArgs, applyCustomCommand };
+static const SysExHandler PSG_ENVELOPE_HANDLER
+    = { doNothing, envelopeChunk, envelopeEnd };
+static const SysExHandler PSG_PROGRAM_ENVELOPE_HANDLER
+    = { programEnvelopeBegin, programEnvelopeChunk, programEnvelopeEnd };
+static const SysExHandler SAMPLE_UPLOAD_HANDLER
+    = { sampleUploadBegin, sample_bank_upload_data, sampleUploadEnd };
+static const SysExHandler REFUSED_SAMPLE_UPLOAD_HANDLER
+    = { refuseSampleUpload, ignoreChunk, doNothing };
+static const SysExHandler GENERAL_MIDI_RESET_HANDLER
+    = { doNothing, ignoreChunk, generalMidiReset };
+static const SysExHandler TUNING_DUMP_HANDLER
+    = { tuningDumpBegin, recordsChunk, tuningDumpEnd };
+static const SysExHandler NOTE_TUNING_HANDLER
+    = { noteTuningBegin, recordsChunk, doNothing };
+
+static const SysExHandler* tuningHandler(bool realTime, u8 command)
+{
+    switch (command) {
+    case SYSEX_MIDI_TUNING_BULK_DUMP:
+        return realTime ? NULL : &TUNING_DUMP_HANDLER;
+    case SYSEX_MIDI_TUNING_NOTE_CHANGE:
+        return realTime ? &NOTE_TUNING_HANDLER : NULL;
+    case SYSEX_MIDI_TUNING_NOTE_CHANGE_BANK:
+        return &NOTE_TUNING_HANDLER;
+    default:
+        return NULL;
+    }
+}
+
+static const SysExHandler* customHandler(u8 command)
+{
+    switch (command) {
+    case SYSEX_COMMAND_LOAD_PSG_ENVELOPE:
+        return &PSG_ENVELOPE_HANDLER;
+    case SYSEX_COMMAND_STORE_PSG_ENVELOPE:
+        return &PSG_PROGRAM_ENVELOPE_HANDLER;
+    case SYSEX_COMMAND_UPLOAD_SAMPLE:
+        return synth_dacAvailable() ? &SAMPLE_UPLOAD_HANDLER
+                                    : &REFUSED_SAMPLE_UPLOAD_HANDLER;
+    default:
+        return &CUSTOM_COMMAND_HANDLER;
+    }
+}
+
+static const SysExHandler* findSysExHandler(const u8* header)
+{
+    const u8 GENERAL_MIDI_RESET_SEQ[] = { 0x7E, 0x7F, 0x09, 0x01 };
+    const u8 CUSTOM_SYSEX_SEQ[]
+        = { SYSEX_MANU_EXTENDED, SYSEX_MANU_REGION, SYSEX_MANU_ID };
+    if (memcmp(
+            header, GENERAL_MIDI_RESET_SEQ, LENGTH_OF(GENERAL_MIDI_RESET_SEQ))
+        == 0) {
+        return &GENERAL_MIDI_RESET_HANDLER;
+    }
+    if ((header[0] == SYSEX_UNIVERSAL_NON_REAL_TIME
+            || header[0] == SYSEX_UNIVERSAL_REAL_TIME)
+        && header[2] == SYSEX_MIDI_TUNING) {
+        return tuningHandler(header[0] == SYSEX_UNIVERSAL_REAL_TIME, header[3]);
+    }
+    if (memcmp(header, CUSTOM_SYSEX_SEQ, LENGTH_OF(CUSTOM_SYSEX_SEQ)) == 0) {
+        return customHandler(header[3]);
+    }
+    return NULL;
+}
+
+void midi_sysex_begin(void)
+{
+    flushPendingUpdates();
+    sysEx.headerLength = 0;
+    sysEx.length = 0;
+    sysEx.handler = NULL;
+}
+
+void midi_sysex_data(const u8* data, u16 length)
+{
+    while (sysEx.headerLength < SYSEX_HEADER_LENGTH && length > 0) {
+        sysEx.header[sysEx.headerLength++] = *data++;
+        length--;
+        if (sysEx.headerLength == SYSEX_HEADER_LENGTH) {
+            sysEx.handler = findSysExHandler(sysEx.header);
+            if (sysEx.handler != NULL) {
+                sysEx.handler->begin();
+            }
+        }
+    }
+    if (sysEx.handler != NULL && length > 0) {
+        sysEx.handler->chunk(data, length);
+    }
+}
+
+void midi_sysex_end(void)
+{
+    if (sysEx.handler != NULL) {
+        sysEx.handler->end();
+        sysEx.handler = NULL;
+    }
+}
+
+void midi_sysex(const u8* data, u16 length)
+{
+    midi_sysex_begin();
+    midi_sysex_data(data, length);
+    midi_sysex_end();
+}
+
+static void sendPong(void)
+{
+    const u8 pongSequence[] = { SYSEX_MANU_EXTENDED, SYSEX_MANU_REGION,
+        SYSEX_MANU_ID, SYSEX_COMMAND_PONG };
+
+    midi_sender_send_sysex(pongSequence, sizeof(pongSequence));
+}
+
+void midi_remap_channel(u8 midiChan, u8 devChan)
+{
+    const u8 SYSEX_UNASSIGNED_DEVICE_CHANNEL = 0x7F;
+    const u8 SYSEX_UNASSIGNED_MIDI_CHANNEL = 0x7F;
+
+    if (devChan == SYSEX_UNASSIGNED_DEVICE_CHANNEL) {
+        DeviceChannel* assignedChan = deviceChannelByMidiChannel(midiChan);
+        if (assignedChan != NULL) {
+            assignMidiChannel(assignedChan, DEFAULT_MIDI_CHANNEL);
+        }
+        return;
+    }
+    if (isDeviceChannelDisabled(devChan)) {
+        return;
+    }
+    assignMidiChannel(&deviceChannels[devChan],
+        (midiChan == SYSEX_UNASSIGNED_MIDI_CHANNEL) ? DEFAULT_MIDI_CHANNEL
+                                                    : midiChan);
+}
+
+static void generalMidiReset(void)
+{
+    for (u8 chan = 0; chan < MIDI_CHANNELS; chan++) {
+        allNotesOff(chan);
+    }
+    if (mappingModePref == MappingMode_Auto) {
+        dynamicMode = true;
+    }
+    resetAllState();
+}
+
+static u8 defaultMidiChannel(u8 devChan)
+{
+    return dynamicMode || devChan >= DEV_CHAN_MIN_SPECIAL
+            || isDeviceChannelDisabled(devChan)
+        ? DEFAULT_MIDI_CHANNEL
+        : devChan;
+}
+
+static void applyDynamicMode(void)
+{
+    for (u8 chan = 0; chan < ALL_DEV_CHANS; chan++) {
+        assignMidiChannel(&deviceChannels[chan], defaultMidiChannel(chan));
+    }
+}
+
+static void releaseDeviceChannels(u16 devChans)
+{
+    for (u8 i = 0; devChans != 0; i++, devChans >>= 1) {
+        DeviceChannel* devChan = &deviceChannels[i];
+        if ((devChans & 1) && devChan->noteOn) {
+            clearDeferredNoteOff(devChan);
+            releaseNote(devChan);
+        }
+    }
+}
+
+static void resetDeviceChannelMappings(u16 devChans)
+{
+    for (u8 i = 0; devChans != 0; i++, devChans >>= 1) {
+        if (devChans & 1) {
+            DeviceChannel* devChan = &deviceChannels[i];
+            devChan->program = INVALID_PROGRAM;
+            assignMidiChannel(devChan, defaultMidiChannel(i));
+        }
+    }
+}
+
+static void setSpecialMode(bool enable)
+{
+    if (specialMode == enable) {
+        return;
+    }
+    u8 fmChan = DEV_CHAN_MIN_FM + SPECIAL_MODE_CHANNEL;
+    u16 devChans
+        = deviceChannelRange(DEV_CHAN_MIN_SPECIAL, DEV_CHAN_MAX_SPECIAL)
+        | (1 << fmChan);
+    releaseDeviceChannels(devChans);
+    specialMode = enable;
+    midi_fm_special_enable(enable);
+    midi_fm_preset_edited(SPECIAL_MODE_CHANNEL);
+    resetDeviceChannelMappings(devChans);
+}
+
+static void setDacMode(bool enable)
+{
+    if (dacMode == enable) {
+        return;
+    }
+    if (enable && !synth_dacAvailable()) {
+        log_warn("DAC drums need Z80 driver");
+        return;
+    }
+    u8 fmChan = DEV_CHAN_MIN_FM + DAC_CHANNEL;
+    u16 devChans = (1 << DEV_CHAN_DAC) | (1 << fmChan);
+    releaseDeviceChannels(devChans);
+    dacMode = enable;
+    midi_dac_enable(enable);
+    resetDeviceChannelMappings(devChans);
+}
+
+static void setDynamicMode(MappingMode mode)
 {
     mappingModePref = mode;
     if (mode == MappingMode_Dynamic) {
@@ -642,206 +1458,789 @@ static void setOperatorTotalLevel(u8 chan, u8 op, u8 value)
     synth_operatorTotalLevel(chan, op, value);
 }
 
-static void setFmChanParameter(DeviceChannel* devChan, u8 controller, u8 value)
+static void setInvertTotalLevel(bool invert)
 {
-    switch (controller) {
-    case CC_GENMDM_FM_ALGORITHM:
-        if (isIgnoringNonGeneralMidiCCs())
-            break;
-        synth_algorithm(devChan->number, RANGE(value, 8));
-        break;
-    case CC_GENMDM_FM_FEEDBACK:
-        if (isIgnoringNonGeneralMidiCCs())
-            break;
-        synth_feedback(devChan->number, RANGE(value, 8));
-        break;
-    case CC_GENMDM_TOTAL_LEVEL_OP1:
-    case CC_GENMDM_TOTAL_LEVEL_OP2:
-    case CC_GENMDM_TOTAL_LEVEL_OP3:
-    case CC_GENMDM_TOTAL_LEVEL_OP4:
-        if (isIgnoringNonGeneralMidiCCs())
-            break;
-        setOperatorTotalLevel(
-            devChan->number, controller - CC_GENMDM_TOTAL_LEVEL_OP1, value);
-        break;
-    case CC_GENMDM_MULTIPLE_OP1:
-    case CC_GENMDM_MULTIPLE_OP2:
-    case CC_GENMDM_MULTIPLE_OP3:
-    case CC_GENMDM_MULTIPLE_OP4:
-        if (isIgnoringNonGeneralMidiCCs())
-            break;
-        synth_operatorMultiple(devChan->number,
-            controller - CC_GENMDM_MULTIPLE_OP1, RANGE(value, 16));
-        break;
-    case CC_GENMDM_DETUNE_OP1:
-    case CC_GENMDM_DETUNE_OP2:
-    case CC_GENMDM_DETUNE_OP3:
-    case CC_GENMDM_DETUNE_OP4:
-        if (isIgnoringNonGeneralMidiCCs())
-            break;
-        synth_operatorDetune(devChan->number, controller - CC_GENMDM_DETUNE_OP1,
-            RANGE(value, 8));
-        break;
-    case CC_GENMDM_RATE_SCALING_OP1:
-    case CC_GENMDM_RATE_SCALING_OP2:
-    case CC_GENMDM_RATE_SCALING_OP3:
-    case CC_GENMDM_RATE_SCALING_OP4:
-        if (isIgnoringNonGeneralMidiCCs())
-            break;
-        synth_operatorRateScaling(devChan->number,
-            controller - CC_GENMDM_RATE_SCALING_OP1, RANGE(value, 4));
-        break;
-    case CC_GENMDM_ATTACK_RATE_OP1:
-    case CC_GENMDM_ATTACK_RATE_OP2:
-    case CC_GENMDM_ATTACK_RATE_OP3:
-    case CC_GENMDM_ATTACK_RATE_OP4:
-        if (isIgnoringNonGeneralMidiCCs())
-            break;
-        synth_operatorAttackRate(devChan->number,
-            controller - CC_GENMDM_ATTACK_RATE_OP1, RANGE(value, 32));
-        break;
-    case CC_GENMDM_FIRST_DECAY_RATE_OP1:
-    case CC_GENMDM_FIRST_DECAY_RATE_OP2:
-    case CC_GENMDM_FIRST_DECAY_RATE_OP3:
-    case CC_GENMDM_FIRST_DECAY_RATE_OP4:
-        if (isIgnoringNonGeneralMidiCCs())
-            break;
-        synth_operatorFirstDecayRate(devChan->number,
-            controller - CC_GENMDM_FIRST_DECAY_RATE_OP1, RANGE(value, 32));
-        break;
-    case CC_GENMDM_SECOND_DECAY_RATE_OP1:
-    case CC_GENMDM_SECOND_DECAY_RATE_OP2:
-    case CC_GENMDM_SECOND_DECAY_RATE_OP3:
-    case CC_GENMDM_SECOND_DECAY_RATE_OP4:
-        if (isIgnoringNonGeneralMidiCCs())
-            break;
-        synth_operatorSecondDecayRate(devChan->number,
-            controller - CC_GENMDM_SECOND_DECAY_RATE_OP1, RANGE(value, 16));
-        break;
-    case CC_GENMDM_SECOND_AMPLITUDE_OP1:
-    case CC_GENMDM_SECOND_AMPLITUDE_OP2:
-    case CC_GENMDM_SECOND_AMPLITUDE_OP3:
-    case CC_GENMDM_SECOND_AMPLITUDE_OP4:
-        if (isIgnoringNonGeneralMidiCCs())
-            break;
-        synth_operatorSecondaryAmplitude(devChan->number,
-            controller - CC_GENMDM_SECOND_AMPLITUDE_OP1, RANGE(value, 16));
-        break;
-    case CC_GENMDM_RELEASE_RATE_OP1:
-    case CC_GENMDM_RELEASE_RATE_OP2:
-    case CC_GENMDM_RELEASE_RATE_OP3:
-    case CC_GENMDM_RELEASE_RATE_OP4:
-        if (isIgnoringNonGeneralMidiCCs())
-            break;
-        synth_operatorReleaseRate(devChan->number,
-            controller - CC_GENMDM_RELEASE_RATE_OP1, RANGE(value, 16));
-        break;
-    case CC_GENMDM_AMPLITUDE_MODULATION_OP1:
-    case CC_GENMDM_AMPLITUDE_MODULATION_OP2:
-    case CC_GENMDM_AMPLITUDE_MODULATION_OP3:
-    case CC_GENMDM_AMPLITUDE_MODULATION_OP4:
-        if (isIgnoringNonGeneralMidiCCs())
-            break;
-        synth_operatorAmplitudeModulation(devChan->number,
-            controller - CC_GENMDM_AMPLITUDE_MODULATION_OP1, RANGE(value, 2));
-        break;
-    case CC_GENMDM_SSG_EG_OP1:
-    case CC_GENMDM_SSG_EG_OP2:
-    case CC_GENMDM_SSG_EG_OP3:
-    case CC_GENMDM_SSG_EG_OP4:
-        if (isIgnoringNonGeneralMidiCCs())
-            break;
-        synth_operatorSsgEg(devChan->number, controller - CC_GENMDM_SSG_EG_OP1,
-            RANGE(value, 16));
-        break;
-    case CC_GENMDM_GLOBAL_LFO_ENABLE:
-        if (isIgnoringNonGeneralMidiCCs())
-            break;
-        synth_enableLfo(RANGE(value, 2));
-        break;
-    case CC_GENMDM_GLOBAL_LFO_FREQUENCY:
-        if (isIgnoringNonGeneralMidiCCs())
-            break;
-        synth_globalLfoFrequency(RANGE(value, 8));
-        break;
-    case CC_GENMDM_AMS:
-        if (isIgnoringNonGeneralMidiCCs())
-            break;
-        synth_ams(devChan->number, RANGE(value, 4));
-        break;
-    case CC_GENMDM_FMS:
-        if (isIgnoringNonGeneralMidiCCs())
-            break;
-        synth_fms(devChan->number, RANGE(value, 8));
-        break;
-    case CC_GENMDM_STEREO:
-        if (isIgnoringNonGeneralMidiCCs())
-            break;
-        synth_stereo(devChan->number, RANGE(value, 4));
-        break;
-    case CC_SUSTAIN_PEDAL:
-    case CC_DATA_ENTRY_LSB:
-    case CC_DATA_ENTRY_MSB:
-    case CC_NRPN_LSB:
-    case CC_NRPN_MSB:
-    case CC_RPN_LSB:
-    case CC_RPN_MSB:
-        break;
-    default:
-        log_warn("Ch %d: CC 0x%02X 0x%02X?", devChan->midiChannel, controller,
-            value);
-        break;
+    invertTotalLevel = invert;
+}
+
+static void controlChangeRpnMsb(u8 chan, u8 op, u8 value)
+{
+    (void)op;
+    MidiChannel* midiChannel = &midiChannels[chan];
+    midiChannel->rpn = (value << 7) | (midiChannel->rpn & 0x7F);
+}
+
+static void controlChangeRpnLsb(u8 chan, u8 op, u8 value)
+{
+    (void)op;
+    MidiChannel* midiChannel = &midiChannels[chan];
+    midiChannel->rpn = (midiChannel->rpn & 0x3F80) | value;
+}
+
+static void controlChangeNrpn(u8 chan, u8 op, u8 value)
+{
+    (void)op;
+    (void)value;
+    midiChannels[chan].rpn = RPN_NULL;
+}
+
+static void controlChangeDataEntryMsb(u8 chan, u8 op, u8 value)
+{
+    (void)op;
+    MidiChannel* midiChannel = &midiChannels[chan];
+    if (midiChannel->rpn == RPN_PITCH_BEND_SENSITIVITY) {
+        midiChannel->bendSemitones = value;
+        applyPitchBend(chan);
     }
 }
 
-static void setInvertTotalLevel(bool invert)
+static void controlChangeDataEntryLsb(u8 chan, u8 op, u8 value)
 {
-    invertTotalLevel = invert;
+    (void)op;
+    MidiChannel* midiChannel = &midiChannels[chan];
+    if (midiChannel->rpn == RPN_PITCH_BEND_SENSITIVITY) {
+        midiChannel->bendCents = value;
+        applyPitchBend(chan);
+    }
+}
+
+static void controlChangeSustain(u8 chan, u8 op, u8 value)
+{
+    (void)op;
+    MidiChannel* midiChannel = &midiChannels[chan];
+    midiChannel->sustain = value;
+    if (!midiChannel->sustain) {
+        releaseDeferredNoteOffs(chan, ~sostenutoNotes[chan]);
+    }
+}
+
+static void controlChangeSostenuto(u8 chan, u8 op, u8 value)
+{
+    (void)op;
+    MidiChannel* midiChannel = &midiChannels[chan];
+    if (value && !midiChannel->sostenuto) {
+        sostenutoNotes[chan] = keysDown(chan);
+    } else if (!value && midiChannel->sostenuto) {
+        u16 held = sostenutoNotes[chan];
+        sostenutoNotes[chan] = 0;
+        if (!midiChannel->sustain) {
+            releaseDeferredNoteOffs(chan, held);
+        }
+    }
+    midiChannel->sostenuto = value;
 }
 
-static void fmParameterCC(u8 chan, u8 controller, u8 value)
+static void controlChangeVolume(u8 chan, u8 op, u8 value)
 {
-    for (u8 i = 0; i < DEV_CHANS; i++) {
+    (void)op;
+    channelVolume(chan, value);
+}
+
+static void controlChangePan(u8 chan, u8 op, u8 value)
+{
+    (void)op;
+    channelPan(chan, value);
+}
+
+static void controlChangeAllNotesOff(u8 chan, u8 op, u8 value)
+{
+    (void)op;
+    (void)value;
+    allNotesOff(chan);
+}
+
+static void controlChangePolyphonicMode(u8 chan, u8 op, u8 value)
+{
+    (void)chan;
+    (void)op;
+    setPolyphonicMode(value != 0);
+}
+
+static void controlChangeResetAllControllers(u8 chan, u8 op, u8 value)
+{
+    (void)op;
+    (void)value;
+    resetAllControllers(chan);
+}
+
+static void controlChangeShowParameters(u8 chan, u8 op, u8 value)
+{
+    (void)op;
+    parametersVisible = value;
+    parametersMidiChannel = chan;
+    if (parametersVisible) {
+        applyProgram(chan);
+    }
+    ui_fm_set_parameters_visibility(chan, value);
+}
+
+static void controlChangeBankSelect(u8 chan, u8 op, u8 value)
+{
+    (void)op;
+    midiChannels[chan].pendingBank = value;
+}
+
+static void controlChangeBankSelectLsb(u8 chan, u8 op, u8 value)
+{
+    /* banks are told apart by their MSB alone, as GS does for
+       variations; the LSB would only pick between sound maps */
+    (void)chan;
+    (void)op;
+    (void)value;
+}
+
+static void controlChangeDeviceSelect(u8 chan, u8 op, u8 value)
+{
+    (void)op;
+    channelDeviceSelect(chan, value);
+}
+
+static void fmAlgorithm(u8 chan, u8 op, u8 value)
+{
+    (void)op;
+    synth_algorithm(chan, value);
+}
+
+static void fmFeedback(u8 chan, u8 op, u8 value)
+{
+    (void)op;
+    synth_feedback(chan, value);
+}
+
+static void fmAms(u8 chan, u8 op, u8 value)
+{
+    (void)op;
+    synth_ams(chan, value);
+}
+
+static void fmFms(u8 chan, u8 op, u8 value)
+{
+    (void)op;
+    synth_fms(chan, value);
+}
+
+static void fmStereo(u8 chan, u8 op, u8 value)
+{
+    (void)op;
+    synth_stereo(chan, value);
+}
+
+static void fmEnableLfo(u8 chan, u8 op, u8 value)
+{
+    (void)chan;
+    (void)op;
+    synth_enableLfo(value);
+}
+
+static void fmGlobalLfoFrequency(u8 chan, u8 op, u8 value)
+{
+    (void)chan;
+    (void)op;
+    synth_globalLfoFrequency(value);
+}
+
+#define CC(handler, shift, flags) { handler, 0, shift, flags, 0 }
+#define CC_FM(handler, field, shift)                                           \
+    { handler, 0, shift, CC_NON_GENERAL_MIDI | CC_FM_CHANNEL,                  \
+        offsetof(FmChannel, field) }
+#define CC_FM_OPERATOR(handler, op, field, shift, flags)                       \
+    { handler, op, shift, CC_NON_GENERAL_MIDI | CC_FM_CHANNEL | flags,         \
+        offsetof(FmChannel, operators) + op * sizeof(Operator)                 \
+            + offsetof(Operator, field) }
+#define CC_OPERATORS(first, handler, field, shift, flags)                      \
+    [first] = CC_FM_OPERATOR(handler, 0, field, shift, flags),                 \
+    [first + 1] = CC_FM_OPERATOR(handler, 1, field, shift, flags),             \
+    [first + 2] = CC_FM_OPERATOR(handler, 2, field, shift, flags),             \
+    [first + 3] = CC_FM_OPERATOR(handler, 3, field, shift, flags)
+
+static const ControlChange CONTROL_CHANGES[MIDI_CONTROLLERS] = {
+    [CC_BANK_SELECT_MSB] = CC(controlChangeBankSelect, 0, 0),
+    [CC_BANK_SELECT_LSB] = CC(controlChangeBankSelectLsb, 0, 0),
+    [CC_VOLUME] = CC(controlChangeVolume, 0, CC_COALESCE),
+    [CC_PAN] = CC(controlChangePan, 0, CC_COALESCE),
+    [CC_ALL_NOTES_OFF] = CC(controlChangeAllNotesOff, 0, 0),
+    [CC_ALL_SOUND_OFF] = CC(controlChangeAllNotesOff, 0, 0),
+    [CC_POLYPHONIC_MODE] = CC(controlChangePolyphonicMode, 6, 0),
+    [CC_RESET_ALL_CONTROLLERS] = CC(controlChangeResetAllControllers, 0, 0),
+    [CC_SHOW_PARAMETERS_ON_UI]
+    = CC(controlChangeShowParameters, 6, CC_NON_GENERAL_MIDI),
+    [CC_DEVICE_SELECT] = CC(controlChangeDeviceSelect, 5, CC_NON_GENERAL_MIDI),
+    [CC_GENMDM_FM_ALGORITHM] = CC_FM(fmAlgorithm, algorithm, 4),
+    [CC_GENMDM_FM_FEEDBACK] = CC_FM(fmFeedback, feedback, 4),
+    CC_OPERATORS(CC_GENMDM_TOTAL_LEVEL_OP1, setOperatorTotalLevel, totalLevel,
+        0, CC_COALESCE),
+    CC_OPERATORS(
+        CC_GENMDM_MULTIPLE_OP1, synth_operatorMultiple, multiple, 3, 0),
+    CC_OPERATORS(CC_GENMDM_DETUNE_OP1, synth_operatorDetune, detune, 4, 0),
+    CC_OPERATORS(CC_GENMDM_RATE_SCALING_OP1, synth_operatorRateScaling,
+        rateScaling, 5, 0),
+    CC_OPERATORS(CC_GENMDM_ATTACK_RATE_OP1, synth_operatorAttackRate,
+        attackRate, 2, 0),
+    CC_OPERATORS(CC_GENMDM_FIRST_DECAY_RATE_OP1, synth_operatorFirstDecayRate,
+        firstDecayRate, 2, 0),
+    CC_OPERATORS(CC_GENMDM_SECOND_DECAY_RATE_OP1,
+        synth_operatorSecondDecayRate, secondaryDecayRate, 3, 0),
+    CC_OPERATORS(CC_GENMDM_SECOND_AMPLITUDE_OP1,
+        synth_operatorSecondaryAmplitude, secondaryAmplitude, 3, 0),
+    CC_OPERATORS(CC_GENMDM_RELEASE_RATE_OP1, synth_operatorReleaseRate,
+        releaseRate, 3, 0),
+    CC_OPERATORS(CC_GENMDM_AMPLITUDE_MODULATION_OP1,
+        synth_operatorAmplitudeModulation, amplitudeModulation, 6, 0),
+    CC_OPERATORS(CC_GENMDM_SSG_EG_OP1, synth_operatorSsgEg, ssgEg, 3, 0),
+    [CC_GENMDM_GLOBAL_LFO_ENABLE]
+    = CC(fmEnableLfo, 6, CC_NON_GENERAL_MIDI | CC_COALESCE),
+    [CC_GENMDM_GLOBAL_LFO_FREQUENCY]
+    = CC(fmGlobalLfoFrequency, 4, CC_NON_GENERAL_MIDI | CC_COALESCE),
+    [CC_GENMDM_AMS] = CC_FM(fmAms, ams, 5),
+    [CC_GENMDM_FMS] = CC_FM(fmFms, fms, 4),
+    [CC_GENMDM_STEREO] = CC_FM(fmStereo, stereo, 5),
+    [CC_SUSTAIN_PEDAL] = CC(controlChangeSustain, 6, 0),
+    [CC_SOSTENUTO_PEDAL] = CC(controlChangeSostenuto, 6, 0),
+    [CC_DATA_ENTRY_LSB] = CC(controlChangeDataEntryLsb, 0, 0),
+    [CC_DATA_ENTRY_MSB] = CC(controlChangeDataEntryMsb, 0, 0),
+    [CC_NRPN_LSB] = CC(controlChangeNrpn, 0, 0),
+    [CC_NRPN_MSB] = CC(controlChangeNrpn, 0, 0),
+    [CC_RPN_LSB] = CC(controlChangeRpnLsb, 0, 0),
+    [CC_RPN_MSB] = CC(controlChangeRpnMsb, 0, 0),
+};
+
+static void resetControllerMappings(void)
+{
+    for (u8 i = 0; i < MIDI_CONTROLLERS; i++) {
+        controllerMappings[i] = i;
+    }
+}
+
+static void remapController(u8 controller, u8 function)
+{
+    if (controller < MIDI_CONTROLLERS && function < MIDI_CONTROLLERS) {
+        controllerMappings[controller] = function;
+    }
+}
+
+static void invalidatePatchShadowCopies(u8 midiChan)
+{
+    u8 program = PATCH_SHADOW_PROGRAM | midiChan;
+    for (u8 i = DEV_CHAN_MIN_FM; i <= DEV_CHAN_MAX_FM; i++) {
+        DeviceChannel* devChan = &deviceChannels[i];
+        if (devChan->program == program && devChan->midiChannel != midiChan) {
+            devChan->program = INVALID_PROGRAM;
+        }
+    }
+}
+
+static void storePatchShadow(u8 midiChan, const FmChannel* patch)
+{
+    memcpy(&patchShadows[midiChan], patch, sizeof(FmChannel));
+    SET_BIT(editedPatches, midiChan);
+    invalidatePatchShadowCopies(midiChan);
+}
+
+/* The shadow takes a full copy when the patch first diverges from its
+   program; later edits only touch the field the CC changed. */
+static void recordPatchEdit(u8 midiChan, u8 patchField)
+{
+    u16 mapped = deviceChannelsMappedTo(midiChan)
+        & deviceChannelRange(DEV_CHAN_MIN_FM, DEV_CHAN_MAX_FM);
+    if (!dynamicMode || mapped == 0
+        || midiChan == GENERAL_MIDI_PERCUSSION_CHANNEL) {
+        return;
+    }
+    const FmChannel* edited = NULL;
+    for (u8 i = 0; mapped != 0; i++, mapped >>= 1) {
+        if (mapped & 1) {
+            DeviceChannel* devChan = &deviceChannels[i];
+            if (edited == NULL) {
+                edited = synth_channelParameters(devChan->number);
+            }
+            devChan->program = PATCH_SHADOW_PROGRAM | midiChan;
+        }
+    }
+    if (!CHECK_BIT(editedPatches, midiChan)) {
+        storePatchShadow(midiChan, edited);
+        return;
+    }
+    ((u8*)&patchShadows[midiChan])[patchField]
+        = ((const u8*)edited)[patchField];
+    invalidatePatchShadowCopies(midiChan);
+}
+
+/* Operator fields follow the channel fields, one byte per field in the
+   order FmChannel and Operator declare them. */
+static const u8 FM_PATCH_CHANNEL_LIMITS[] = { 7, 7, 3, 3, 7 };
+static const u8 FM_PATCH_OPERATOR_LIMITS[]
+    = { 15, 7, 31, 3, 31, 1, 15, 31, 15, 127, 15 };
+
+static bool isValidFmPatch(const u8* data)
+{
+    const u8 channelFields = LENGTH_OF(FM_PATCH_CHANNEL_LIMITS);
+    for (u8 i = 0; i < SYSEX_FM_PATCH_LENGTH; i++) {
+        u8 limit = i < channelFields
+            ? FM_PATCH_CHANNEL_LIMITS[i]
+            : FM_PATCH_OPERATOR_LIMITS[(i - channelFields)
+                % LENGTH_OF(FM_PATCH_OPERATOR_LIMITS)];
+        if (data[i] > limit) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void unpackFmPatch(const u8* data, FmChannel* patch)
+{
+    patch->algorithm = *data++;
+    patch->feedback = *data++;
+    patch->stereo = *data++;
+    patch->ams = *data++;
+    patch->fms = *data++;
+    patch->octave = 0;
+    patch->freqNumber = 0;
+    for (u8 i = 0; i < MAX_FM_OPERATORS; i++) {
+        Operator* op = &patch->operators[i];
+        op->multiple = *data++;
+        op->detune = *data++;
+        op->attackRate = *data++;
+        op->rateScaling = *data++;
+        op->firstDecayRate = *data++;
+        op->amplitudeModulation = *data++;
+        op->secondaryAmplitude = *data++;
+        op->secondaryDecayRate = *data++;
+        op->releaseRate = *data++;
+        op->totalLevel = *data++;
+        op->ssgEg = *data++;
+    }
+}
+
+static void packFmPatch(const FmChannel* patch, u8* data)
+{
+    *data++ = patch->algorithm;
+    *data++ = patch->feedback;
+    *data++ = patch->stereo;
+    *data++ = patch->ams;
+    *data++ = patch->fms;
+    for (u8 i = 0; i < MAX_FM_OPERATORS; i++) {
+        const Operator* op = &patch->operators[i];
+        *data++ = op->multiple;
+        *data++ = op->detune;
+        *data++ = op->attackRate;
+        *data++ = op->rateScaling;
+        *data++ = op->firstDecayRate;
+        *data++ = op->amplitudeModulation;
+        *data++ = op->secondaryAmplitude;
+        *data++ = op->secondaryDecayRate;
+        *data++ = op->releaseRate;
+        *data++ = op->totalLevel;
+        *data++ = op->ssgEg;
+    }
+}
+
+static void loadMidiChannelPatch(u8 midiChan, const FmChannel* patch)
+{
+    bool shadowed
+        = dynamicMode && midiChan != GENERAL_MIDI_PERCUSSION_CHANNEL;
+    u8 program = shadowed ? PATCH_SHADOW_PROGRAM | midiChan
+                          : midiChannels[midiChan].program;
+    u16 mapped = deviceChannelsMappedTo(midiChan)
+        & deviceChannelRange(DEV_CHAN_MIN_FM, DEV_CHAN_MAX_FM);
+    for (u8 i = 0; mapped != 0; i++, mapped >>= 1) {
+        if (mapped & 1) {
+            DeviceChannel* devChan = &deviceChannels[i];
+            midi_fm_preset(devChan->number, patch);
+            devChan->program = program;
+            devChan->bank = midiChannels[midiChan].bank;
+        }
+    }
+    if (shadowed) {
+        storePatchShadow(midiChan, patch);
+    }
+}
+
+static u8 patchTargetDeviceChannel(u8 target)
+{
+    return DEV_CHAN_MIN_FM + (target & ~SYSEX_FM_PATCH_DEVICE_CHANNEL);
+}
+
+static bool readFmPatch(const u8* data, FmChannel* patch)
+{
+    if (!isValidFmPatch(data)) {
+        log_warn("Invalid FM patch");
+        return false;
+    }
+    unpackFmPatch(data, patch);
+    return true;
+}
+
+static void loadFmPatch(u8 target, const u8* data)
+{
+    FmChannel patch;
+    if (!readFmPatch(data, &patch)) {
+        return;
+    }
+    if (target & SYSEX_FM_PATCH_DEVICE_CHANNEL) {
+        u8 devChan = patchTargetDeviceChannel(target);
+        if (devChan <= DEV_CHAN_MAX_FM && !isDeviceChannelDisabled(devChan)) {
+            midi_fm_preset(deviceChannels[devChan].number, &patch);
+        }
+    } else if (target < MIDI_CHANNELS) {
+        loadMidiChannelPatch(target, &patch);
+    }
+}
+
+static const FmChannel* fmPatchOfMidiChannel(u8 midiChan)
+{
+    if (CHECK_BIT(editedPatches, midiChan)) {
+        return &patchShadows[midiChan];
+    }
+    u16 mapped = deviceChannelsMappedTo(midiChan)
+        & deviceChannelRange(DEV_CHAN_MIN_FM, DEV_CHAN_MAX_FM);
+    for (u8 i = 0; mapped != 0; i++, mapped >>= 1) {
+        if (mapped & 1) {
+            return synth_channelParameters(deviceChannels[i].number);
+        }
+    }
+    return NULL;
+}
+
+static const FmChannel* fmPatchOfTarget(u8 target)
+{
+    if (target & SYSEX_FM_PATCH_DEVICE_CHANNEL) {
+        u8 devChan = patchTargetDeviceChannel(target);
+        return devChan <= DEV_CHAN_MAX_FM
+            ? synth_channelParameters(deviceChannels[devChan].number)
+            : NULL;
+    }
+    return target < MIDI_CHANNELS ? fmPatchOfMidiChannel(target) : NULL;
+}
+
+static void dumpFmPatch(u8 target)
+{
+    const FmChannel* patch = fmPatchOfTarget(target);
+    if (patch == NULL) {
+        return;
+    }
+    /* the reply is a load command, so the host can send it back as-is */
+    u8 sequence[SYSEX_HEADER_LENGTH + 1 + SYSEX_FM_PATCH_LENGTH]
+        = { SYSEX_MANU_EXTENDED, SYSEX_MANU_REGION, SYSEX_MANU_ID,
+              SYSEX_COMMAND_LOAD_FM_PATCH, target };
+    packFmPatch(patch, &sequence[SYSEX_HEADER_LENGTH + 1]);
+    midi_sender_send_sysex(sequence, sizeof(sequence));
+}
+
+static void invalidateUserPresetCopies(u8 slot)
+{
+    for (u8 i = DEV_CHAN_MIN_FM; i <= DEV_CHAN_MAX_FM; i++) {
         DeviceChannel* devChan = &deviceChannels[i];
-        if (devChan->midiChannel == chan) {
-            setFmChanParameter(devChan, controller, value);
+        if (devChan->bank == USER_PRESET_BANK && devChan->program == slot) {
+            devChan->program = INVALID_PROGRAM;
+        }
+    }
+}
+
+static void storeUserPreset(u8 slot, const u8* data, u16 length)
+{
+    if (slot >= USER_PRESETS) {
+        log_warn("Preset slot %d?", slot);
+        return;
+    }
+    FmChannel patch;
+    const FmChannel* preset = &patch;
+    if (length == SYSEX_FM_PATCH_LENGTH) {
+        if (!readFmPatch(data, &patch)) {
+            return;
+        }
+    } else {
+        preset = fmPatchOfTarget(data[0]);
+        if (preset == NULL) {
+            return;
+        }
+    }
+    midi_fm_store_user_preset(slot, preset);
+    invalidateUserPresetCopies(slot);
+    saveSettings();
+}
+
+static u8 settingFlags(void)
+{
+    u8 flags = 0;
+    if (dynamicMode) {
+        flags |= SETTING_DYNAMIC_MODE;
+    }
+    if (invertTotalLevel) {
+        flags |= SETTING_INVERT_TOTAL_LEVEL;
+    }
+    if (disableNonGeneralMidiCCs) {
+        flags |= SETTING_NON_GENERAL_MIDI_CCS;
+    }
+    if (stickToDeviceType) {
+        flags |= SETTING_STICK_TO_DEVICE_TYPE;
+    }
+    return flags;
+}
+
+static void saveUserEnvelope(void)
+{
+    u8 envelope[MAX_EEF_LENGTH];
+    u8 present = midi_psg_user_envelope(envelope);
+    persistence_write(&present, 1);
+    if (present) {
+        persistence_write(envelope, sizeof(envelope));
+    }
+}
+
+static void saveUserPresets(void)
+{
+    for (u8 slot = 0; slot < USER_PRESETS; slot++) {
+        const FmChannel* preset = midi_fm_user_preset(slot);
+        u8 present = preset != NULL;
+        persistence_write(&present, 1);
+        if (present) {
+            u8 packed[SYSEX_FM_PATCH_LENGTH];
+            packFmPatch(preset, packed);
+            persistence_write(packed, sizeof(packed));
+        }
+    }
+}
+
+static void saveProgramEnvelopes(void)
+{
+    for (u8 program = 0; program < MIDI_PROGRAMS; program++) {
+        u8 envelope[MAX_EEF_LENGTH];
+        if (midi_psg_program_envelope(program, envelope)) {
+            u16 length = 1;
+            while (envelope[length - 1] != EEF_END) {
+                length++;
+            }
+            persistence_write(&program, 1);
+            persistence_write(envelope, length);
+        }
+    }
+    const u8 end = NO_PROGRAM_ENVELOPE;
+    persistence_write(&end, 1);
+}
+
+static void writeSettings(void)
+{
+    u8 settings[SETTINGS_LENGTH];
+    settings[0] = mappingModePref;
+    settings[1] = settingFlags();
+    for (u8 i = 0; i < ALL_DEV_CHANS; i++) {
+        settings[2 + i] = deviceChannels[i].midiChannel;
+    }
+    persistence_write_begin();
+    persistence_write(settings, sizeof(settings));
+    saveUserEnvelope();
+    saveUserPresets();
+    saveProgramEnvelopes();
+    persistence_write_end();
+    settingsUnsaved = false;
+}
+
+/* SRAM is rewritten on the next tick, so a burst of settings SysEx
+   costs one write. */
+static void saveSettings(void)
+{
+    settingsUnsaved = true;
+}
+
+static void restoreMappings(const u8* mappings)
+{
+    for (u8 i = 0; i < ALL_DEV_CHANS; i++) {
+        u8 midiChan = mappings[i];
+        if ((midiChan < MIDI_CHANNELS || midiChan == DEFAULT_MIDI_CHANNEL)
+            && !isDeviceChannelDisabled(i)) {
+            assignMidiChannel(&deviceChannels[i], midiChan);
+        }
+    }
+}
+
+static bool restoreUserEnvelope(void)
+{
+    u8 present;
+    if (!persistence_read(&present, 1)) {
+        return false;
+    }
+    if (present) {
+        u8 envelope[MAX_EEF_LENGTH];
+        if (!persistence_read(envelope, sizeof(envelope))) {
+            return false;
+        }
+        midi_psg_load_envelope(envelope);
+    }
+    return true;
+}
+
+static bool restoreUserPresets(void)
+{
+    for (u8 slot = 0; slot < USER_PRESETS; slot++) {
+        u8 present;
+        if (!persistence_read(&present, 1)) {
+            return false;
+        }
+        if (present) {
+            u8 packed[SYSEX_FM_PATCH_LENGTH];
+            FmChannel preset;
+            if (!persistence_read(packed, sizeof(packed))) {
+                return false;
+            }
+            if (readFmPatch(packed, &preset)) {
+                midi_fm_store_user_preset(slot, &preset);
+            }
+        }
+    }
+    return true;
+}
+
+static bool readEnvelope(u8* envelope)
+{
+    for (u16 i = 0; i < MAX_EEF_LENGTH; i++) {
+        if (!persistence_read(&envelope[i], 1)) {
+            return false;
+        }
+        if (envelope[i] == EEF_END) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void restoreProgramEnvelopes(void)
+{
+    u8 program;
+    while (persistence_read(&program, 1) && program < MIDI_PROGRAMS) {
+        u8 envelope[MAX_EEF_LENGTH];
+        if (!readEnvelope(envelope)) {
+            return;
+        }
+        midi_psg_store_envelope(program, envelope);
+    }
+}
+
+static void restoreSettings(void)
+{
+    u8 settings[SETTINGS_LENGTH];
+    if (!persistence_read_begin()
+        || !persistence_read(settings, sizeof(settings))) {
+        return;
+    }
+    u8 flags = settings[1];
+    if (settings[0] <= MappingMode_Auto) {
+        mappingModePref = settings[0];
+    }
+    dynamicMode = flags & SETTING_DYNAMIC_MODE;
+    invertTotalLevel = flags & SETTING_INVERT_TOTAL_LEVEL;
+    disableNonGeneralMidiCCs = flags & SETTING_NON_GENERAL_MIDI_CCS;
+    stickToDeviceType = flags & SETTING_STICK_TO_DEVICE_TYPE;
+    applyDynamicMode();
+    if (!dynamicMode) {
+        restoreMappings(&settings[2]);
+    }
+    if (restoreUserEnvelope() && restoreUserPresets()) {
+        restoreProgramEnvelopes();
+    }
+}
+
+static void applyControlChange(u8 chan, const ControlChange* cc, u8 value)
+{
+    if (cc->flags & CC_FM_CHANNEL) {
+        MidiChannel* midiChannel = &midiChannels[chan];
+        u16 mapped = deviceChannelsMappedTo(chan);
+        for (u8 i = 0; mapped != 0; i++, mapped >>= 1) {
+            DeviceChannel* devChan = &deviceChannels[i];
+            if ((mapped & 1) && isFmChannel(devChan)) {
+                updateProgram(midiChannel, devChan);
+                cc->handler(devChan->number, cc->op, value);
+                midi_fm_preset_edited(devChan->number);
+            }
+        }
+        recordPatchEdit(chan, cc->patchField);
+    } else {
+        cc->handler(chan, cc->op, value);
+    }
+}
+
+static bool coalescePendingControlChange(u8 chan, u8 function, u8 value)
+{
+    for (u8 i = 0; i < pendingControlChangeCount; i++) {
+        PendingControlChange* pending = &pendingControlChanges[i];
+        if (pending->chan == chan && pending->function == function) {
+            pending->value = value;
+            countSupersededUpdate();
+            return true;
         }
     }
+    return false;
+}
+
+static void queueControlChange(u8 chan, u8 function, u8 value)
+{
+    if (coalescePendingControlChange(chan, function, value)) {
+        return;
+    }
+    if (pendingControlChangeCount == MAX_PENDING_CONTROL_CHANGES) {
+        flushPendingUpdates();
+    }
+    PendingControlChange* pending
+        = &pendingControlChanges[pendingControlChangeCount++];
+    pending->chan = chan;
+    pending->function = function;
+    pending->value = value;
+}
+
+static void flushPendingUpdates(void)
+{
+    for (u8 i = 0; i < pendingControlChangeCount; i++) {
+        PendingControlChange* pending = &pendingControlChanges[i];
+        applyControlChange(pending->chan, &CONTROL_CHANGES[pending->function],
+            pending->value);
+    }
+    pendingControlChangeCount = 0;
+    for (u8 chan = 0; pendingPitchBends != 0; chan++, pendingPitchBends >>= 1) {
+        if (pendingPitchBends & 1) {
+            channelPitchBend(chan, pendingPitchBendValues[chan]);
+        }
+    }
+}
+
+static void setCoalesceUpdates(bool enabled)
+{
+    flushPendingUpdates();
+    coalesceUpdates = enabled;
 }
 
 void midi_cc(u8 chan, u8 controller, u8 value)
 {
-    switch (controller) {
-    case CC_VOLUME:
-        channelVolume(chan, value);
-        break;
-    case CC_PAN:
-        channelPan(chan, value);
-        break;
-    case CC_ALL_NOTES_OFF:
-    case CC_ALL_SOUND_OFF:
-        allNotesOff(chan);
-        break;
-    case CC_POLYPHONIC_MODE:
-        setPolyphonicMode(RANGE(value, 2) != 0);
-        break;
-    case CC_RESET_ALL_CONTROLLERS:
-        resetAllControllers(chan);
-        break;
-    case CC_SHOW_PARAMETERS_ON_UI:
-        if (isIgnoringNonGeneralMidiCCs())
-            break;
-        ui_fm_set_parameters_visibility(chan, RANGE(value, 2));
-        break;
-    case CC_DEVICE_SELECT:
-        if (isIgnoringNonGeneralMidiCCs())
-            break;
-        channelDeviceSelect(chan, RANGE(value, 4));
-        break;
-    default:
-        fmParameterCC(chan, controller, value);
-        break;
+    if (controller >= MIDI_CONTROLLERS) {
+        return;
+    }
+    u8 function = controllerMappings[controller];
+    const ControlChange* cc = &CONTROL_CHANGES[function];
+    if (cc->handler == NULL) {
+        log_warn("Ch %d: CC 0x%02X 0x%02X?", chan, controller, value);
+        return;
+    }
+    if ((cc->flags & CC_NON_GENERAL_MIDI) && isIgnoringNonGeneralMidiCCs()) {
+        return;
+    }
+    value >>= cc->shift;
+    if (coalesceUpdates && (cc->flags & CC_COALESCE)) {
+        queueControlChange(chan, function, value);
+        return;
     }
+    flushPendingUpdates();
+    applyControlChange(chan, cc, value);
+}
+
+void midi_tick(void)
+{
+    flushPendingUpdates();
+    if (settingsUnsaved) {
+        writeSettings();
+    }
+}
+
+u16 midi_superseded_updates(void)
+{
+    return supersededUpdates;
 }
 
 void midi_reset(void)
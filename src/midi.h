@@ -1,10 +1,13 @@
 #pragma once
 #include "midi_fm.h"
+#include "midi_fm_special.h"
 #include "midi_psg.h"
 #include <stdbool.h>
 #include <types.h>
 
 #define MIDI_PROGRAMS 128
+#define MIDI_BANKS 128
+#define MIDI_CONTROLLERS 128
 #define MAX_MIDI_VOLUME 127
 #define DEFAULT_MIDI_PAN 64
 #define MIDI_PITCH_BEND_CENTRE 0x2000
@@ -24,7 +27,12 @@
 #define DEV_CHAN_MAX_TONE_PSG 8
 #define DEV_CHAN_PSG_NOISE 9
 #define DEV_CHAN_MAX_PSG 9
+#define DEV_CHAN_MIN_SPECIAL 10
+#define DEV_CHAN_MAX_SPECIAL 13
+#define DEV_CHAN_DAC 14
+#define ALL_DEV_CHANS 15
 
+#define CC_BANK_SELECT_MSB 0
 #define CC_DATA_ENTRY_MSB 6
 #define CC_VOLUME 7
 #define CC_PAN 10
@@ -42,6 +50,7 @@
 #define CC_GENMDM_DETUNE_OP2 25
 #define CC_GENMDM_DETUNE_OP3 26
 #define CC_GENMDM_DETUNE_OP4 27
+#define CC_BANK_SELECT_LSB 32
 #define CC_DATA_ENTRY_LSB 38
 #define CC_GENMDM_RATE_SCALING_OP1 39
 #define CC_GENMDM_RATE_SCALING_OP2 40
@@ -68,6 +77,7 @@
 #define CC_GENMDM_RELEASE_RATE_OP3 61
 #define CC_GENMDM_RELEASE_RATE_OP4 62
 #define CC_SUSTAIN_PEDAL 64
+#define CC_SOSTENUTO_PEDAL 66
 #define CC_GENMDM_AMPLITUDE_MODULATION_OP1 70
 #define CC_GENMDM_AMPLITUDE_MODULATION_OP2 71
 #define CC_GENMDM_AMPLITUDE_MODULATION_OP3 72
@@ -95,6 +105,13 @@
 #define SYSEX_START 0xF0
 #define SYSEX_END 0xF7
 
+#define SYSEX_UNIVERSAL_NON_REAL_TIME 0x7E
+#define SYSEX_UNIVERSAL_REAL_TIME 0x7F
+#define SYSEX_MIDI_TUNING 0x08
+#define SYSEX_MIDI_TUNING_BULK_DUMP 0x01
+#define SYSEX_MIDI_TUNING_NOTE_CHANGE 0x02
+#define SYSEX_MIDI_TUNING_NOTE_CHANGE_BANK 0x07
+
 #define SYSEX_MANU_EXTENDED 0x00
 #define SYSEX_MANU_REGION 0x22
 #define SYSEX_MANU_ID 0x77
@@ -107,6 +124,19 @@
 #define SYSEX_COMMAND_STICK_TO_DEVICE_TYPE 0x05
 #define SYSEX_COMMAND_LOAD_PSG_ENVELOPE 0x06
 #define SYSEX_COMMAND_INVERT_TOTAL_LEVEL 0x07
+#define SYSEX_COMMAND_REMAP_CC 0x08
+#define SYSEX_COMMAND_COALESCE_UPDATES 0x09
+#define SYSEX_COMMAND_SPECIAL_MODE 0x0A
+#define SYSEX_COMMAND_DAC_DRUMS 0x0B
+#define SYSEX_COMMAND_UPLOAD_SAMPLE 0x0C
+#define SYSEX_COMMAND_DELETE_SAMPLE 0x0D
+#define SYSEX_COMMAND_LOAD_FM_PATCH 0x0E
+#define SYSEX_COMMAND_DUMP_FM_PATCH 0x0F
+#define SYSEX_COMMAND_STORE_USER_PRESET 0x10
+#define SYSEX_COMMAND_STORE_PSG_ENVELOPE 0x11
+
+#define SYSEX_FM_PATCH_DEVICE_CHANNEL 0x10
+#define SYSEX_FM_PATCH_LENGTH 49
 
 typedef struct VTable VTable;
 
@@ -114,8 +144,8 @@ struct VTable {
     void (*noteOn)(u8 chan, u8 pitch, u8 velocity);
     void (*noteOff)(u8 chan, u8 pitch);
     void (*channelVolume)(u8 chan, u8 volume);
-    void (*pitchBend)(u8 chan, u16 bend);
-    void (*program)(u8 chan, u8 program);
+    void (*pitchBend)(u8 chan, s16 bend);
+    void (*program)(u8 chan, u8 bank, u8 program);
     void (*allNotesOff)(u8 chan);
     void (*pan)(u8 chan, u8 pan);
 };
@@ -128,14 +158,15 @@ struct DeviceChannel {
     bool noteOn;
     u8 midiChannel;
     u8 program;
+    u8 bank;
     u8 pitch;
     u8 volume;
     u8 pan;
-    u16 pitchBend;
+    s16 pitchBend;
 };
 
-void midi_init(const FmChannel** defaultPresets,
-    const PercussionPreset** defaultPercussionPresets,
+void midi_init(const FmPresetImage** defaultPresetBanks[],
+    const PercussionPresetImage* defaultPercussionPresets,
     const u8** defaultEnvelopes);
 void midi_note_on(u8 chan, u8 pitch, u8 velocity);
 void midi_note_off(u8 chan, u8 pitch);
@@ -143,7 +174,12 @@ void midi_pitch_bend(u8 chan, u16 bend);
 void midi_cc(u8 chan, u8 controller, u8 value);
 void midi_program(u8 chan, u8 program);
 void midi_sysex(const u8* data, u16 length);
+void midi_sysex_begin(void);
+void midi_sysex_data(const u8* data, u16 length);
+void midi_sysex_end(void);
 bool midi_dynamic_mode(void);
 DeviceChannel* midi_channel_mappings(void);
 void midi_remap_channel(u8 midiChannel, u8 deviceChannel);
 void midi_reset(void);
+void midi_tick(void);
+u16 midi_superseded_updates(void);
@@ -0,0 +1,77 @@
+#include "midi_dac.h"
+#include "sample_bank.h"
+#include "samples.h"
+#include "synth.h"
+
+static void stopSample(void)
+{
+    synth_dacStop();
+    sample_bank_stopped();
+}
+
+void midi_dac_enable(bool enable)
+{
+    if (!enable) {
+        stopSample();
+    }
+    synth_dacEnable(enable);
+}
+
+bool midi_dac_has_sample(u8 pitch)
+{
+    return sample_bank_find(pitch) != NULL || DAC_DRUM_SAMPLES[pitch] != NULL;
+}
+
+void midi_dac_note_on(u8 chan, u8 pitch, u8 velocity)
+{
+    (void)chan;
+    (void)velocity;
+    if (sample_bank_play(pitch)) {
+        return;
+    }
+    const DacSample* sample = DAC_DRUM_SAMPLES[pitch];
+    if (sample != NULL) {
+        sample_bank_stopped();
+        synth_dacPlay(sample->data, sample->length, sample->rate);
+    }
+}
+
+void midi_dac_note_off(u8 chan, u8 pitch)
+{
+    (void)chan;
+    const UploadedSample* uploaded = sample_bank_find(pitch);
+    if (uploaded != NULL && uploaded->loopLength != 0) {
+        stopSample();
+    }
+}
+
+void midi_dac_channel_volume(u8 chan, u8 volume)
+{
+    (void)chan;
+    (void)volume;
+}
+
+void midi_dac_pitch_bend(u8 chan, s16 bend)
+{
+    (void)chan;
+    (void)bend;
+}
+
+void midi_dac_program(u8 chan, u8 bank, u8 program)
+{
+    (void)bank;
+    (void)chan;
+    (void)program;
+}
+
+void midi_dac_all_notes_off(u8 chan)
+{
+    (void)chan;
+    stopSample();
+}
+
+void midi_dac_pan(u8 chan, u8 pan)
+{
+    (void)chan;
+    (void)pan;
+}
@@ -0,0 +1,13 @@
+#pragma once
+#include <stdbool.h>
+#include <types.h>
+
+void midi_dac_enable(bool enable);
+bool midi_dac_has_sample(u8 pitch);
+void midi_dac_note_on(u8 chan, u8 pitch, u8 velocity);
+void midi_dac_note_off(u8 chan, u8 pitch);
+void midi_dac_channel_volume(u8 chan, u8 volume);
+void midi_dac_pitch_bend(u8 chan, s16 bend);
+void midi_dac_program(u8 chan, u8 bank, u8 program);
+void midi_dac_all_notes_off(u8 chan);
+void midi_dac_pan(u8 chan, u8 pan);
@@ -1,14 +1,10 @@
 #include "midi_fm.h"
 #include "midi.h"
+#include "pitch.h"
 #include "region.h"
 #include "synth.h"
 
-static const u8 SEMITONES = 12;
-static const u16 FREQS[] = {
-    607, // B
-    644, 681, 722, 765, 810, 858, 910, 964, 1021, 1081,
-    1146 // A#
-};
+static const u8 NO_PERCUSSION_PRESET = 0xFF;
 
 typedef struct MidiFmChannel MidiFmChannel;
 
@@ -18,23 +14,34 @@ struct MidiFmChannel {
     u8 velocity;
     u8 pan;
     bool percussive;
+    u8 percussionPreset;
 };
 
 static MidiFmChannel fmChannels[MAX_FM_CHANS];
 
-static u8 octave(u8 pitch);
-static u16 freqNumber(u8 pitch);
+static void applyPitch(u8 chan, u16 pitch);
 static u8 pitchIsOutOfRange(u8 pitch);
 static u8 effectiveVolume(MidiFmChannel* channelState);
 static void updatePan(u8 chan);
+static u8 loadPercussionPreset(u8 chan, u8 pitch);
+
+/* Every bank number resolves to a full bank of register images, so
+   selecting a program is an indexed load whichever bank is selected. */
+static const FmPresetImage** banks[MIDI_BANKS];
+static const PercussionPresetImage* percussionPresets;
 
-static const FmChannel** presets;
-static const PercussionPreset** percussionPresets;
+/* Unstored user programs load the default bank's image instead. */
+static FmChannel userPresetSlots[USER_PRESETS];
+static const FmChannel* userPresets[USER_PRESETS];
 
-void midi_fm_init(const FmChannel** defaultPresets,
-    const PercussionPreset** defaultPercussionPresets)
+void midi_fm_init(const FmPresetImage** presetBanks[],
+    const PercussionPresetImage* defaultPercussionPresets)
 {
-    presets = defaultPresets;
+    for (u8 bank = 0; bank < MIDI_BANKS; bank++) {
+        banks[bank] = presetBanks[bank] != NULL ? presetBanks[bank]
+                                                : presetBanks[0];
+    }
+    banks[USER_PRESET_BANK] = presetBanks[0];
     percussionPresets = defaultPercussionPresets;
     for (u8 chan = 0; chan < MAX_FM_CHANS; chan++) {
         MidiFmChannel* fmChan = &fmChannels[chan];
@@ -42,8 +49,14 @@ void midi_fm_init(const FmChannel** defaultPresets,
         fmChan->velocity = MAX_MIDI_VOLUME;
         fmChan->pan = 0;
         fmChan->percussive = false;
+        fmChan->percussionPreset = NO_PERCUSSION_PRESET;
+    }
+    for (u8 slot = 0; slot < USER_PRESETS; slot++) {
+        userPresets[slot] = NULL;
     }
-    synth_init(presets[0]);
+    FmChannel initialPreset = { 0 };
+    synth_unpackPresetImage(&initialPreset, banks[0][0]);
+    synth_init(&initialPreset);
 }
 
 void midi_fm_note_on(u8 chan, u8 pitch, u8 velocity)
@@ -53,14 +66,12 @@ void midi_fm_note_on(u8 chan, u8 pitch, u8 velocity)
     }
     MidiFmChannel* fmChan = &fmChannels[chan];
     if (fmChan->percussive) {
-        const PercussionPreset* percussionPreset = percussionPresets[pitch];
-        synth_preset(chan, &percussionPreset->channel);
-        pitch = percussionPreset->key;
+        pitch = loadPercussionPreset(chan, pitch);
     }
     fmChan->velocity = velocity;
     synth_volume(chan, effectiveVolume(fmChan));
     fmChan->pitch = pitch;
-    synth_pitch(chan, octave(pitch), freqNumber(pitch));
+    applyPitch(chan, pitch_fromKey(pitch, 0));
     synth_noteOn(chan);
 }
 
@@ -77,22 +88,57 @@ void midi_fm_channel_volume(u8 chan, u8 volume)
     synth_volume(chan, effectiveVolume(fmChan));
 }
 
-void midi_fm_pitch_bend(u8 chan, u16 bend)
+void midi_fm_pitch_bend(u8 chan, s16 bend)
+{
+    MidiFmChannel* fmChan = &fmChannels[chan];
+    applyPitch(chan, pitch_fromKey(fmChan->pitch, bend));
+}
+
+void midi_fm_program(u8 chan, u8 bank, u8 program)
+{
+    if (bank == USER_PRESET_BANK && program < USER_PRESETS
+        && userPresets[program] != NULL) {
+        midi_fm_preset(chan, userPresets[program]);
+        return;
+    }
+    fmChannels[chan].percussionPreset = NO_PERCUSSION_PRESET;
+    synth_presetImage(chan, banks[bank][program]);
+    updatePan(chan);
+}
+
+static u8 loadPercussionPreset(u8 chan, u8 pitch)
 {
     MidiFmChannel* fmChan = &fmChannels[chan];
-    u16 freq = freqNumber(fmChan->pitch);
-    s16 bendRelative = bend - MIDI_PITCH_BEND_CENTRE;
-    freq = freq + (bendRelative / 75);
-    synth_pitch(chan, octave(fmChan->pitch), freq);
+    bool loaded = fmChan->percussionPreset == pitch;
+    fmChan->percussionPreset = pitch;
+    const PercussionPresetImage* percussionPreset = &percussionPresets[pitch];
+    if (!loaded) {
+        synth_presetImage(chan, &percussionPreset->image);
+    }
+    return percussionPreset->key;
 }
 
-void midi_fm_program(u8 chan, u8 program)
+void midi_fm_preset(u8 chan, const FmChannel* preset)
 {
-    const FmChannel* data = presets[program];
-    synth_preset(chan, data);
+    fmChannels[chan].percussionPreset = NO_PERCUSSION_PRESET;
+    synth_preset(chan, preset);
     updatePan(chan);
 }
 
+void midi_fm_store_user_preset(u8 slot, const FmChannel* preset)
+{
+    FmChannel* stored = &userPresetSlots[slot];
+    *stored = *preset;
+    stored->octave = 0;
+    stored->freqNumber = 0;
+    userPresets[slot] = stored;
+}
+
+const FmChannel* midi_fm_user_preset(u8 slot)
+{
+    return userPresets[slot];
+}
+
 void midi_fm_all_notes_off(u8 chan)
 {
     midi_fm_note_off(chan, 0);
@@ -101,9 +147,22 @@ void midi_fm_all_notes_off(u8 chan)
 void midi_fm_percussive(u8 chan, bool enabled)
 {
     MidiFmChannel* fmChan = &fmChannels[chan];
+    if (fmChan->percussive != enabled) {
+        fmChan->percussionPreset = NO_PERCUSSION_PRESET;
+    }
     fmChan->percussive = enabled;
 }
 
+u8 midi_fm_percussion_preset(u8 chan)
+{
+    return fmChannels[chan].percussionPreset;
+}
+
+void midi_fm_preset_edited(u8 chan)
+{
+    fmChannels[chan].percussionPreset = NO_PERCUSSION_PRESET;
+}
+
 void midi_fm_pan(u8 chan, u8 pan)
 {
     MidiFmChannel* fmChan = &fmChannels[chan];
@@ -123,14 +182,12 @@ static void updatePan(u8 chan)
     }
 }
 
-static u8 octave(u8 pitch)
-{
-    return (pitch - MIN_MIDI_PITCH) / SEMITONES;
-}
-
-static u16 freqNumber(u8 pitch)
+static void applyPitch(u8 chan, u16 pitch)
 {
-    return FREQS[((u8)(pitch - MIN_MIDI_PITCH)) % SEMITONES];
+    u8 octave;
+    u16 freqNumber;
+    pitch_fm(pitch, &octave, &freqNumber);
+    synth_pitch(chan, octave, freqNumber);
 }
 
 static u8 pitchIsOutOfRange(u8 pitch)
@@ -6,6 +6,8 @@
 #define MAX_FM_CHAN 5
 #define MIN_MIDI_PITCH 11
 #define MAX_MIDI_PITCH 106
+#define USER_PRESETS 32
+#define USER_PRESET_BANK 0x7F
 
 typedef struct PercussionPreset PercussionPreset;
 
@@ -14,13 +16,25 @@ struct PercussionPreset {
     u8 key;
 };
 
-void midi_fm_init(const FmChannel** defaultPresets,
-    const PercussionPreset** defaultPercussionPresets);
+typedef struct PercussionPresetImage PercussionPresetImage;
+
+struct PercussionPresetImage {
+    FmPresetImage image;
+    u8 key;
+};
+
+void midi_fm_init(const FmPresetImage** presetBanks[],
+    const PercussionPresetImage* defaultPercussionPresets);
 void midi_fm_note_on(u8 chan, u8 pitch, u8 velocity);
 void midi_fm_note_off(u8 chan, u8 pitch);
 void midi_fm_channel_volume(u8 chan, u8 volume);
 void midi_fm_pan(u8 chan, u8 pan);
-void midi_fm_pitch_bend(u8 chan, u16 bend);
-void midi_fm_program(u8 chan, u8 program);
+void midi_fm_pitch_bend(u8 chan, s16 bend);
+void midi_fm_program(u8 chan, u8 bank, u8 program);
+void midi_fm_preset(u8 chan, const FmChannel* preset);
 void midi_fm_all_notes_off(u8 chan);
 void midi_fm_percussive(u8 chan, bool enabled);
+u8 midi_fm_percussion_preset(u8 chan);
+void midi_fm_preset_edited(u8 chan);
+void midi_fm_store_user_preset(u8 slot, const FmChannel* preset);
+const FmChannel* midi_fm_user_preset(u8 slot);
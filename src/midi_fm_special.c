@@ -0,0 +1,107 @@
+#include "midi_fm_special.h"
+#include "midi.h"
+#include "midi_fm.h"
+#include "pitch.h"
+#include "synth.h"
+
+typedef struct SpecialModeVoice SpecialModeVoice;
+
+struct SpecialModeVoice {
+    u8 pitch;
+    u8 volume;
+    u8 velocity;
+};
+
+/* Each voice is a single carrier with a short percussive envelope. The
+   voices share channel 3's algorithm, feedback and stereo settings. */
+static const FmChannel SPECIAL_MODE_PRESET = { 7, 0, STEREO_MODE_CENTRE, 0, 0,
+    0, 0,
+    { { 1, 0, 31, 1, 14, 0, 10, 8, 15, 12, 0 },
+        { 1, 0, 31, 1, 14, 0, 10, 8, 15, 12, 0 },
+        { 1, 0, 31, 1, 14, 0, 10, 8, 15, 12, 0 },
+        { 1, 0, 31, 1, 14, 0, 10, 8, 15, 12, 0 } } };
+
+static SpecialModeVoice voices[SPECIAL_MODE_VOICES];
+
+static void applyPitch(u8 voice, u16 pitch);
+static u8 effectiveVolume(SpecialModeVoice* voice);
+
+void midi_fm_special_init(void)
+{
+    for (u8 i = 0; i < SPECIAL_MODE_VOICES; i++) {
+        SpecialModeVoice* voice = &voices[i];
+        voice->pitch = 0;
+        voice->volume = MAX_MIDI_VOLUME;
+        voice->velocity = MAX_MIDI_VOLUME;
+    }
+}
+
+void midi_fm_special_enable(bool enable)
+{
+    if (enable) {
+        synth_preset(SPECIAL_MODE_CHANNEL, &SPECIAL_MODE_PRESET);
+    }
+    synth_specialMode(enable);
+}
+
+void midi_fm_special_note_on(u8 voice, u8 pitch, u8 velocity)
+{
+    if (pitch < MIN_MIDI_PITCH || pitch > MAX_MIDI_PITCH) {
+        return;
+    }
+    SpecialModeVoice* state = &voices[voice];
+    state->velocity = velocity;
+    synth_specialModeVolume(voice, effectiveVolume(state));
+    state->pitch = pitch;
+    applyPitch(voice, pitch_fromKey(pitch, 0));
+    synth_specialModeNoteOn(voice);
+}
+
+void midi_fm_special_note_off(u8 voice, u8 pitch)
+{
+    (void)pitch;
+    synth_specialModeNoteOff(voice);
+}
+
+void midi_fm_special_channel_volume(u8 voice, u8 volume)
+{
+    SpecialModeVoice* state = &voices[voice];
+    state->volume = volume;
+    synth_specialModeVolume(voice, effectiveVolume(state));
+}
+
+void midi_fm_special_pitch_bend(u8 voice, s16 bend)
+{
+    applyPitch(voice, pitch_fromKey(voices[voice].pitch, bend));
+}
+
+void midi_fm_special_program(u8 voice, u8 bank, u8 program)
+{
+    (void)bank;
+    (void)voice;
+    (void)program;
+}
+
+void midi_fm_special_all_notes_off(u8 voice)
+{
+    midi_fm_special_note_off(voice, 0);
+}
+
+void midi_fm_special_pan(u8 voice, u8 pan)
+{
+    (void)voice;
+    (void)pan;
+}
+
+static void applyPitch(u8 voice, u16 pitch)
+{
+    u8 octave;
+    u16 freqNumber;
+    pitch_fm(pitch, &octave, &freqNumber);
+    synth_specialModePitch(voice, octave, freqNumber);
+}
+
+static u8 effectiveVolume(SpecialModeVoice* voice)
+{
+    return (voice->volume * voice->velocity) / 0x7F;
+}
@@ -0,0 +1,15 @@
+#pragma once
+#include <stdbool.h>
+#include <types.h>
+
+#define SPECIAL_MODE_VOICES 4
+
+void midi_fm_special_init(void);
+void midi_fm_special_enable(bool enable);
+void midi_fm_special_note_on(u8 voice, u8 pitch, u8 velocity);
+void midi_fm_special_note_off(u8 voice, u8 pitch);
+void midi_fm_special_channel_volume(u8 voice, u8 volume);
+void midi_fm_special_pitch_bend(u8 voice, s16 bend);
+void midi_fm_special_program(u8 voice, u8 bank, u8 program);
+void midi_fm_special_all_notes_off(u8 voice);
+void midi_fm_special_pan(u8 voice, u8 pan);
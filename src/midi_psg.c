@@ -1,9 +1,10 @@
 #include "midi_psg.h"
 #include "bits.h"
 #include "envelopes.h"
+#include "log.h"
 #include "midi.h"
+#include "pitch.h"
 #include "psg.h"
-#include "region.h"
 #include <memory.h>
 #include <psg.h>
 #include <stdbool.h>
@@ -12,23 +13,16 @@
 #define MIN_PSG_CHAN 6
 #define MAX_PSG_CHAN 9
 #define MIN_MIDI_KEY 45
-#define MAX_MIDI_KEY 127
-#define PITCH_SHIFTS 7
-#define NUM_TONES (128 - MIN_MIDI_KEY)
-
-static const u16 TONES_NTSC[NUM_TONES] = { 1016, 959, 905, 855, 807, 761, 719,
-    678, 640, 604, 570, 538, 508, 479, 452, 427, 403, 380, 359, 339, 320, 302,
-    285, 269, 254, 239, 226, 213, 201, 190, 179, 169, 160, 151, 142, 134, 127,
-    119, 113, 106, 100, 95, 89, 84, 80, 75, 71, 67, 63, 59, 56, 53, 50, 47, 44,
-    42, 40, 37, 35, 33, 31, 29, 28, 26, 25, 23, 22, 21, 20, 18, 17, 16, 15, 14,
-    14, 13, 12, 11, 11, 10, 10, 9, 8 };
-
-static const u16 TONES_PAL[NUM_TONES] = { 1007, 951, 897, 847, 799, 754, 712,
-    672, 634, 599, 565, 533, 503, 475, 448, 423, 399, 377, 356, 336, 317, 299,
-    282, 266, 251, 237, 224, 211, 199, 188, 178, 168, 158, 149, 141, 133, 125,
-    118, 112, 105, 99, 94, 89, 84, 79, 74, 70, 66, 62, 59, 56, 52, 49, 47, 44,
-    42, 39, 37, 35, 33, 31, 29, 28, 26, 24, 23, 22, 21, 19, 18, 17, 16, 15, 14,
-    14, 13, 12, 11, 11, 10, 9, 9, 8 };
+#define NO_ENVELOPE 0xFFFF
+#define NO_LOOP 0xFF
+#define ENVELOPE_NIBBLES 16
+#define MAX_ENVELOPE_STEPS (MAX_EEF_LENGTH - 1)
+#define ROM_ENVELOPE_POOL_SIZE 1024
+
+/* Envelope pitch shifts in 1/256ths of a semitone, indexed by the upper nibble
+   of an envelope step */
+static const s16 ENVELOPE_PITCH_SHIFTS[ENVELOPE_NIBBLES] = { 0, 13, 26, 51,
+    128, 256, 512, 1280, -13, -26, -51, -128, -256, -512, -1280, 0 };
 
 static const u8 ATTENUATIONS[] = { 15, 14, 14, 14, 13, 13, 13, 13, 12, 12, 12,
     11, 11, 11, 11, 10, 10, 10, 10, 9, 9, 9, 9, 9, 8, 8, 8, 8, 8, 7, 7, 7, 7, 7,
@@ -37,11 +31,25 @@ static const u8 ATTENUATIONS[] = { 15, 14, 14, 14, 13, 13, 13, 13, 12, 12, 12,
     2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
 
-typedef struct MidiPsgChannel MidiPsgChannel;
+static const u8 SILENT_ENVELOPE[] = { EEF_END };
+
+typedef struct PsgEnvelope PsgEnvelope;
+
+/* An EEF envelope compiled to its steps alone, with the loop markers resolved
+   to step indices. The masks record which pitch shift and attenuation nibbles
+   the steps use, so only those are precomputed for a channel. */
+struct PsgEnvelope {
+    u16 pitchShifts;
+    u16 attenuations;
+    u8 length;
+    u8 loopStart;
+    u8 loopEnd;
+    u8 steps[MAX_ENVELOPE_STEPS];
+};
+
+#define ENVELOPE_HEADER_SIZE (sizeof(PsgEnvelope) - MAX_ENVELOPE_STEPS)
 
-static u8 userDefinedEnvelope[256];
-static u8* userDefinedEnvelopePtr;
-static const u8** envelopes;
+typedef struct MidiPsgChannel MidiPsgChannel;
 
 struct MidiPsgChannel {
     u8 chanNum;
@@ -52,26 +60,47 @@ struct MidiPsgChannel {
     u8 volume;
     u8 velocity;
     u8 envelope;
-    const u8* envelopeStep;
-    const u8* envelopeLoopStart;
+    const PsgEnvelope* compiledEnvelope;
+    u8 envelopeIndex;
     bool noteReleased;
-    u16 pitchBend;
+    s16 pitchBend;
+    u16 tones[ENVELOPE_NIBBLES];
+    u8 attenuations[ENVELOPE_NIBBLES];
 };
 
+/* The default envelopes are compiled once, at init. Programs that share an
+   envelope share its compiled copy, and one that is invalid or doesn't fit
+   in the pool plays as silence. */
+static u16 romEnvelopePool[ROM_ENVELOPE_POOL_SIZE / sizeof(u16)];
+static const PsgEnvelope* romEnvelopes[MIDI_PROGRAMS];
+static PsgEnvelope userEnvelope;
+static bool hasUserEnvelope;
+
+/* Envelopes stored for individual programs are packed end to end. Replacing
+   or removing one leaves a hole that is only reclaimed by compacting the
+   bank once a new envelope no longer fits after the last one. */
+static u16 envelopeBank[PSG_ENVELOPE_BANK_SIZE / sizeof(u16)];
+static u16 envelopeBankEnd;
+static u16 envelopeBankUsed;
+static u16 programEnvelopes[MIDI_PROGRAMS];
+
 static u8 audible;
 static MidiPsgChannel psgChannels[MAX_PSG_CHANS];
 
-static u16 toneForMidiKey(u8 midiKey);
 static MidiPsgChannel* psgChannel(u8 psgChan);
+static void compileRomEnvelopes(const u8** eefs);
 static void initEnvelope(MidiPsgChannel* psgChan);
 static void applyAttenuation(MidiPsgChannel* psgChan, u8 newAtt);
-static u16 envelopeTone(MidiPsgChannel* psgChan);
-static u16 effectiveTone(MidiPsgChannel* psgChan);
 
 void midi_psg_init(const u8** defaultEnvelopes)
 {
-    userDefinedEnvelopePtr = NULL;
-    envelopes = defaultEnvelopes;
+    hasUserEnvelope = false;
+    compileRomEnvelopes(defaultEnvelopes);
+    envelopeBankEnd = 0;
+    envelopeBankUsed = 0;
+    for (u8 program = 0; program < MIDI_PROGRAMS; program++) {
+        programEnvelopes[program] = NO_ENVELOPE;
+    }
     for (u8 chan = 0; chan < MAX_PSG_CHANS; chan++) {
         MidiPsgChannel* psgChan = psgChannel(chan);
         psgChan->attenuation = PSG_ATTENUATION_SILENCE;
@@ -82,94 +111,190 @@ void midi_psg_init(const u8** defaultEnvelopes)
         psgChan->envelope = 0;
         psgChan->noteReleased = false;
         psgChan->freq = 0;
-        psgChan->pitchBend = DEFAULT_MIDI_PITCH_BEND;
+        psgChan->pitchBend = 0;
         initEnvelope(psgChan);
     }
 }
 
+static bool compileEnvelope(const u8* eef, PsgEnvelope* envelope)
+{
+    u8 length = 0;
+    envelope->pitchShifts = 1 << (EEF_END >> 4);
+    envelope->attenuations = 0;
+    envelope->loopStart = NO_LOOP;
+    envelope->loopEnd = NO_LOOP;
+    for (u16 i = 0; i < MAX_EEF_LENGTH; i++) {
+        u8 step = eef[i];
+        switch (step) {
+        case EEF_END:
+            if (envelope->loopStart != NO_LOOP
+                && (envelope->loopStart == length
+                    || envelope->loopEnd == envelope->loopStart)) {
+                return false;
+            }
+            if (envelope->loopEnd == NO_LOOP) {
+                envelope->loopEnd = length;
+            }
+            envelope->length = length;
+            return true;
+        case EEF_LOOP_START:
+            if (envelope->loopStart != NO_LOOP) {
+                return false;
+            }
+            envelope->loopStart = length;
+            break;
+        case EEF_LOOP_END:
+            if (envelope->loopStart == NO_LOOP
+                || envelope->loopEnd != NO_LOOP) {
+                return false;
+            }
+            envelope->loopEnd = length;
+            break;
+        default:
+            envelope->steps[length++] = step;
+            envelope->pitchShifts |= 1 << (step >> 4);
+            envelope->attenuations |= 1 << (step & 0x0F);
+            break;
+        }
+    }
+    return false;
+}
+
+static u16 decompileEnvelope(const PsgEnvelope* envelope, u8* eef)
+{
+    u16 length = 0;
+    for (u16 i = 0; i <= envelope->length; i++) {
+        if (i == envelope->loopStart && envelope->loopStart != NO_LOOP) {
+            eef[length++] = EEF_LOOP_START;
+        }
+        if (i == envelope->loopEnd && i < envelope->length) {
+            eef[length++] = EEF_LOOP_END;
+        }
+        if (i < envelope->length) {
+            eef[length++] = envelope->steps[i];
+        }
+    }
+    eef[length++] = EEF_END;
+    return length;
+}
+
+static const PsgEnvelope* bankEnvelope(u16 offset)
+{
+    return (const PsgEnvelope*)((const u8*)envelopeBank + offset);
+}
+
+static u16 envelopeSize(const PsgEnvelope* envelope)
+{
+    u16 size = ENVELOPE_HEADER_SIZE + envelope->length;
+    return (size + 1) & ~1;
+}
+
+static const PsgEnvelope* addRomEnvelope(const PsgEnvelope* envelope, u16* end)
+{
+    u8* address = (u8*)romEnvelopePool + *end;
+    memcpy(address, envelope, ENVELOPE_HEADER_SIZE + envelope->length);
+    *end += envelopeSize(envelope);
+    return (const PsgEnvelope*)address;
+}
+
+static const PsgEnvelope* sharedRomEnvelope(const u8** eefs, u8 program)
+{
+    for (u8 i = 0; i < program; i++) {
+        if (eefs[i] == eefs[program]) {
+            return romEnvelopes[i];
+        }
+    }
+    return NULL;
+}
+
+static void compileRomEnvelopes(const u8** eefs)
+{
+    PsgEnvelope envelope;
+    u16 end = 0;
+    compileEnvelope(SILENT_ENVELOPE, &envelope);
+    const PsgEnvelope* silent = addRomEnvelope(&envelope, &end);
+    for (u8 program = 0; program < MIDI_PROGRAMS; program++) {
+        const PsgEnvelope* shared = sharedRomEnvelope(eefs, program);
+        if (shared != NULL) {
+            romEnvelopes[program] = shared;
+        } else if (!compileEnvelope(eefs[program], &envelope)) {
+            log_warn("PSG envelope %d invalid", program);
+            romEnvelopes[program] = silent;
+        } else if (end + envelopeSize(&envelope) > ROM_ENVELOPE_POOL_SIZE) {
+            log_warn("PSG envelope %d too big", program);
+            romEnvelopes[program] = silent;
+        } else {
+            romEnvelopes[program] = addRomEnvelope(&envelope, &end);
+        }
+    }
+}
+
 static void initEnvelope(MidiPsgChannel* psgChan)
 {
-    psgChan->envelopeStep = userDefinedEnvelopePtr != NULL
-        ? userDefinedEnvelopePtr
-        : envelopes[psgChan->envelope];
-    psgChan->envelopeLoopStart = NULL;
+    u16 offset = programEnvelopes[psgChan->envelope];
+    if (offset != NO_ENVELOPE) {
+        psgChan->compiledEnvelope = bankEnvelope(offset);
+    } else if (hasUserEnvelope) {
+        psgChan->compiledEnvelope = &userEnvelope;
+    } else {
+        psgChan->compiledEnvelope = romEnvelopes[psgChan->envelope];
+    }
+    psgChan->envelopeIndex = 0;
+}
+
+static bool isLooping(MidiPsgChannel* psgChan, u8 index)
+{
+    u8 loopStart = psgChan->compiledEnvelope->loopStart;
+    return loopStart != NO_LOOP && index >= loopStart;
 }
 
-static u8 effectiveAttenuation(MidiPsgChannel* psgChan)
+static void updateAttenuations(MidiPsgChannel* psgChan)
 {
     u8 att
         = ATTENUATIONS[(psgChan->volume * psgChan->velocity) / MAX_MIDI_VOLUME];
     u8 invAtt = MAX_ATTENUATION - att;
-    u8 envAtt = *psgChan->envelopeStep & 0x0F;
-    u8 invEnvAtt = MAX_ATTENUATION - envAtt;
-    u8 invEffectiveAtt = (invAtt * invEnvAtt) / MAX_ATTENUATION;
-    u8 effectiveAtt = MAX_ATTENUATION - invEffectiveAtt;
-    return effectiveAtt;
+    u16 used = psgChan->compiledEnvelope->attenuations;
+    for (u8 envAtt = 0; used != 0; envAtt++, used >>= 1) {
+        if (used & 1) {
+            u8 invEnvAtt = MAX_ATTENUATION - envAtt;
+            u8 invEffectiveAtt = (invAtt * invEnvAtt) / MAX_ATTENUATION;
+            psgChan->attenuations[envAtt] = MAX_ATTENUATION - invEffectiveAtt;
+        }
+    }
 }
 
-static void noteOff(MidiPsgChannel* psgChan)
+static void updateTones(MidiPsgChannel* psgChan)
 {
-    applyAttenuation(psgChan, PSG_ATTENUATION_SILENCE);
-    psgChan->noteOn = false;
-    psgChan->noteReleased = false;
+    u16 used = psgChan->compiledEnvelope->pitchShifts;
+    for (u8 shift = 0; used != 0; shift++, used >>= 1) {
+        if (used & 1) {
+            psgChan->tones[shift] = pitch_psgTone(pitch_fromKey(psgChan->key,
+                ENVELOPE_PITCH_SHIFTS[shift] + psgChan->pitchBend));
+        }
+    }
 }
 
-static const u16 KEY_SHIFT_TABLE[PITCH_SHIFTS] = { 1, 1, 1, 1, 1, 2, 5 };
-static const u16 PITCH_SHIFT_TABLE[PITCH_SHIFTS] = { 1, 2, 4, 10, 20, 40, 100 };
-
-static u16 envelopeTone(MidiPsgChannel* psgChan)
-{
-    const u8 DIVISOR = 20;
-    u8 shift = *psgChan->envelopeStep >> 4;
-    u16 freq = toneForMidiKey(psgChan->key);
-    if (shift == 0) {
-        return freq;
-    }
-    u8 shiftIndex = shift - 1;
-    if (shift < 0x5) {
-        u16 nextTone = toneForMidiKey(psgChan->key + 1);
-        return freq
-            - ((freq - nextTone) * PITCH_SHIFT_TABLE[shiftIndex]) / DIVISOR;
-    } else if (shift < 0x8) {
-        return toneForMidiKey(psgChan->key + KEY_SHIFT_TABLE[shiftIndex]);
-    } else if (shift < 0xC) {
-        u16 prevFreq = toneForMidiKey(psgChan->key - 1);
-        return freq
-            + ((prevFreq - freq) * PITCH_SHIFT_TABLE[shiftIndex - 0x07])
-            / DIVISOR;
-    } else {
-        return toneForMidiKey(
-            psgChan->key - KEY_SHIFT_TABLE[shiftIndex - 0x07]);
-    }
+static u8 currentStep(MidiPsgChannel* psgChan)
+{
+    const PsgEnvelope* envelope = psgChan->compiledEnvelope;
+    return psgChan->envelopeIndex < envelope->length
+        ? envelope->steps[psgChan->envelopeIndex]
+        : EEF_END;
 }
 
-static u16 pitchBentTone(MidiPsgChannel* psgChan, u16 baseTone)
+static void noteOff(MidiPsgChannel* psgChan)
 {
-    if (psgChan->pitchBend == DEFAULT_MIDI_PITCH_BEND) {
-        return baseTone;
-    } else if (psgChan->pitchBend < MIDI_PITCH_BEND_CENTRE) {
-        // bending down
-        u16 prevTone = toneForMidiKey(
-            psgChan->key - GENERAL_MIDI_PITCH_BEND_SEMITONE_RANGE);
-        // prev tone is higher
-        u16 diff = prevTone - baseTone;
-        u16 bend = MIDI_PITCH_BEND_CENTRE - psgChan->pitchBend;
-        return baseTone + (u32)((diff * bend) / MIDI_PITCH_BEND_CENTRE);
-    } else {
-        // bending up
-        u16 nextTone = toneForMidiKey(
-            psgChan->key + GENERAL_MIDI_PITCH_BEND_SEMITONE_RANGE);
-        // next tone is lower
-        u16 diff = baseTone - nextTone;
-        u16 bend = psgChan->pitchBend - MIDI_PITCH_BEND_CENTRE;
-        return baseTone - (u32)((diff * bend) / MIDI_PITCH_BEND_CENTRE);
-    }
+    applyAttenuation(psgChan, PSG_ATTENUATION_SILENCE);
+    psgChan->noteOn = false;
+    psgChan->noteReleased = false;
 }
 
-static u16 effectiveTone(MidiPsgChannel* psgChan)
+static void resetEnvelope(MidiPsgChannel* psgChan)
 {
-    u16 baseFreq = envelopeTone(psgChan);
-    return pitchBentTone(psgChan, baseFreq);
+    if (psgChan->noteOn) {
+        noteOff(psgChan);
+    }
+    initEnvelope(psgChan);
 }
 
 static void applyTone(MidiPsgChannel* psgChan, u16 newFreq)
@@ -193,29 +318,26 @@ static void applyAttenuation(MidiPsgChannel* psgChan, u8 newAtt)
     }
 }
 
-static void applyEnvelopeStep(MidiPsgChannel* psgChan)
+static void applyEnvelopeStep(MidiPsgChannel* psgChan, u8 index)
 {
-    if (*psgChan->envelopeStep == EEF_LOOP_START) {
-        psgChan->envelopeStep++;
-        psgChan->envelopeLoopStart = psgChan->envelopeStep;
-    }
-    if (*psgChan->envelopeStep == EEF_LOOP_END
-        && psgChan->envelopeLoopStart != NULL) {
-        psgChan->envelopeStep++;
-        if (!psgChan->noteReleased) {
-            psgChan->envelopeStep = psgChan->envelopeLoopStart;
-        }
+    const PsgEnvelope* envelope = psgChan->compiledEnvelope;
+    bool held = !psgChan->noteReleased;
+    if (index == envelope->loopEnd && held && isLooping(psgChan, index)) {
+        index = envelope->loopStart;
     }
-    if (*psgChan->envelopeStep == EEF_END) {
-        if (psgChan->envelopeLoopStart != NULL && !psgChan->noteReleased) {
-            psgChan->envelopeStep = psgChan->envelopeLoopStart;
+    if (index == envelope->length) {
+        if (held && isLooping(psgChan, index)) {
+            index = envelope->loopStart;
         } else {
+            psgChan->envelopeIndex = index;
             noteOff(psgChan);
             return;
         }
     }
-    applyTone(psgChan, effectiveTone(psgChan));
-    applyAttenuation(psgChan, effectiveAttenuation(psgChan));
+    psgChan->envelopeIndex = index;
+    u8 step = envelope->steps[index];
+    applyTone(psgChan, psgChan->tones[step >> 4]);
+    applyAttenuation(psgChan, psgChan->attenuations[step & 0x0F]);
 }
 
 void midi_psg_note_on(u8 chan, u8 key, u8 velocity)
@@ -229,14 +351,16 @@ void midi_psg_note_on(u8 chan, u8 key, u8 velocity)
     psgChan->velocity = velocity;
     psgChan->noteOn = true;
     initEnvelope(psgChan);
-    applyEnvelopeStep(psgChan);
+    updateTones(psgChan);
+    updateAttenuations(psgChan);
+    applyEnvelopeStep(psgChan, 0);
 }
 
 void midi_psg_note_off(u8 chan, u8 pitch)
 {
     MidiPsgChannel* psgChan = psgChannel(chan);
     if (psgChan->noteOn && psgChan->key == pitch) {
-        if (psgChan->envelopeLoopStart != NULL) {
+        if (isLooping(psgChan, psgChan->envelopeIndex)) {
             psgChan->noteReleased = true;
         } else {
             noteOff(psgChan);
@@ -254,19 +378,23 @@ void midi_psg_channel_volume(u8 chan, u8 volume)
     MidiPsgChannel* psgChan = psgChannel(chan);
     psgChan->volume = volume;
     if (psgChan->noteOn) {
-        applyAttenuation(psgChan, effectiveAttenuation(psgChan));
+        updateAttenuations(psgChan);
+        applyAttenuation(
+            psgChan, psgChan->attenuations[currentStep(psgChan) & 0x0F]);
     }
 }
 
-void midi_psg_pitch_bend(u8 chan, u16 bend)
+void midi_psg_pitch_bend(u8 chan, s16 bend)
 {
     MidiPsgChannel* psgChan = psgChannel(chan);
     psgChan->pitchBend = bend;
-    applyTone(psgChan, effectiveTone(psgChan));
+    updateTones(psgChan);
+    applyTone(psgChan, psgChan->tones[currentStep(psgChan) >> 4]);
 }
 
-void midi_psg_program(u8 chan, u8 program)
+void midi_psg_program(u8 chan, u8 bank, u8 program)
 {
+    (void)bank;
     MidiPsgChannel* psgChan = psgChannel(chan);
     psgChan->envelope = program;
 }
@@ -277,47 +405,151 @@ void midi_psg_pan(u8 chan, u8 pan)
     (void)pan;
 }
 
-static void incrementEnvelopeStep(MidiPsgChannel* chan)
+void midi_psg_tick(void)
 {
-    if (*chan->envelopeStep != EEF_END) {
-        chan->envelopeStep++;
+    for (u8 chan = 0; chan < MAX_PSG_CHANS; chan++) {
+        MidiPsgChannel* psgChan = psgChannel(chan);
+        if (psgChan->noteOn) {
+            applyEnvelopeStep(psgChan, psgChan->envelopeIndex + 1);
+        }
     }
-    applyEnvelopeStep(chan);
 }
 
-void midi_psg_tick(void)
+bool midi_psg_load_envelope(const u8* eef)
 {
+    PsgEnvelope envelope;
+    if (!compileEnvelope(eef, &envelope)) {
+        return false;
+    }
+    userEnvelope = envelope;
+    hasUserEnvelope = true;
     for (u8 chan = 0; chan < MAX_PSG_CHANS; chan++) {
         MidiPsgChannel* psgChan = psgChannel(chan);
-        if (psgChan->noteOn) {
-            incrementEnvelopeStep(psgChan);
+        if (psgChan->compiledEnvelope == &userEnvelope) {
+            resetEnvelope(psgChan);
         }
     }
+    return true;
 }
 
-void midi_psg_load_envelope(const u8* eef)
+bool midi_psg_user_envelope(u8* eef)
 {
-    u16 i = 0;
-    for (;;) {
-        userDefinedEnvelope[i++] = *eef;
-        if (*eef == EEF_END) {
-            break;
+    if (!hasUserEnvelope) {
+        return false;
+    }
+    decompileEnvelope(&userEnvelope, eef);
+    return true;
+}
+
+static bool isInBlock(const PsgEnvelope* envelope, u16 offset, u16 size)
+{
+    const u8* address = (const u8*)envelope;
+    const u8* block = (const u8*)envelopeBank + offset;
+    return address >= block && address < block + size;
+}
+
+static void moveBlock(u16 from, u16 to, u16 size)
+{
+    u16* source = &envelopeBank[from / sizeof(u16)];
+    u16* dest = &envelopeBank[to / sizeof(u16)];
+    for (u16 i = 0; i < size / sizeof(u16); i++) {
+        dest[i] = source[i];
+    }
+    for (u8 chan = 0; chan < MAX_PSG_CHANS; chan++) {
+        MidiPsgChannel* psgChan = psgChannel(chan);
+        if (isInBlock(psgChan->compiledEnvelope, from, size)) {
+            psgChan->compiledEnvelope = bankEnvelope(to);
         }
-        eef++;
-    };
-    userDefinedEnvelopePtr = userDefinedEnvelope;
+    }
+}
+
+static u8 nextEnvelopeFrom(u16 offset)
+{
+    u8 next = MIDI_PROGRAMS;
+    for (u8 program = 0; program < MIDI_PROGRAMS; program++) {
+        u16 candidate = programEnvelopes[program];
+        if (candidate != NO_ENVELOPE && candidate >= offset
+            && (next == MIDI_PROGRAMS || candidate < programEnvelopes[next])) {
+            next = program;
+        }
+    }
+    return next;
 }
 
-static u16 toneForMidiKey(u8 midiKey)
+static void compactEnvelopeBank(void)
 {
-    const u16* tones = region_isPal() ? TONES_PAL : TONES_NTSC;
-    if (midiKey < MIN_MIDI_KEY) {
-        return tones[0];
+    u16 end = 0;
+    for (u8 program = nextEnvelopeFrom(end); program != MIDI_PROGRAMS;
+         program = nextEnvelopeFrom(end)) {
+        u16 offset = programEnvelopes[program];
+        u16 size = envelopeSize(bankEnvelope(offset));
+        if (offset != end) {
+            moveBlock(offset, end, size);
+            programEnvelopes[program] = end;
+        }
+        end += size;
     }
-    if (midiKey > MAX_MIDI_KEY) {
-        return tones[NUM_TONES - 1];
+    envelopeBankEnd = end;
+}
+
+void midi_psg_remove_envelope(u8 program)
+{
+    u16 offset = programEnvelopes[program];
+    if (offset == NO_ENVELOPE) {
+        return;
+    }
+    u16 size = envelopeSize(bankEnvelope(offset));
+    programEnvelopes[program] = NO_ENVELOPE;
+    for (u8 chan = 0; chan < MAX_PSG_CHANS; chan++) {
+        MidiPsgChannel* psgChan = psgChannel(chan);
+        if (isInBlock(psgChan->compiledEnvelope, offset, size)) {
+            resetEnvelope(psgChan);
+        }
     }
-    return tones[midiKey - MIN_MIDI_KEY];
+    envelopeBankUsed -= size;
+    if (offset + size == envelopeBankEnd) {
+        envelopeBankEnd = offset;
+    }
+}
+
+bool midi_psg_store_envelope(u8 program, const u8* eef)
+{
+    PsgEnvelope envelope;
+    if (!compileEnvelope(eef, &envelope)) {
+        return false;
+    }
+    u16 size = envelopeSize(&envelope);
+    u16 offset = programEnvelopes[program];
+    u16 replaced
+        = offset != NO_ENVELOPE ? envelopeSize(bankEnvelope(offset)) : 0;
+    if (envelopeBankUsed - replaced + size > PSG_ENVELOPE_BANK_SIZE) {
+        return false;
+    }
+    midi_psg_remove_envelope(program);
+    if (envelopeBankEnd + size > PSG_ENVELOPE_BANK_SIZE) {
+        compactEnvelopeBank();
+    }
+    memcpy((u8*)envelopeBank + envelopeBankEnd, &envelope,
+        ENVELOPE_HEADER_SIZE + envelope.length);
+    programEnvelopes[program] = envelopeBankEnd;
+    envelopeBankEnd += size;
+    envelopeBankUsed += size;
+    return true;
+}
+
+bool midi_psg_program_envelope(u8 program, u8* eef)
+{
+    u16 offset = programEnvelopes[program];
+    if (offset == NO_ENVELOPE) {
+        return false;
+    }
+    decompileEnvelope(bankEnvelope(offset), eef);
+    return true;
+}
+
+u16 midi_psg_envelope_bank_free(void)
+{
+    return PSG_ENVELOPE_BANK_SIZE - envelopeBankUsed;
 }
 
 static MidiPsgChannel* psgChannel(u8 chan)
@@ -1,4 +1,5 @@
 #pragma once
+#include <stdbool.h>
 #include <stdint.h>
 #include <types.h>
 
@@ -8,6 +9,8 @@
 #define EEF_END 0xFF
 #define EEF_LOOP_START 0xFE
 #define EEF_LOOP_END 0xFD
+#define MAX_EEF_LENGTH 256
+#define PSG_ENVELOPE_BANK_SIZE 1024
 
 #define MAX_PSG_CHANS 4
 
@@ -20,9 +23,14 @@ void midi_psg_note_on(u8 chan, u8 pitch, u8 velocity);
 void midi_psg_note_off(u8 chan, u8 pitch);
 void midi_psg_all_notes_off(u8 chan);
 void midi_psg_channel_volume(u8 chan, u8 volume);
-void midi_psg_pitch_bend(u8 chan, u16 bend);
-void midi_psg_program(u8 chan, u8 program);
+void midi_psg_pitch_bend(u8 chan, s16 bend);
+void midi_psg_program(u8 chan, u8 bank, u8 program);
 void midi_psg_pan(u8 chan, u8 pan);
 void midi_psg_tick(void);
-void midi_psg_load_envelope(const u8* eef);
+bool midi_psg_load_envelope(const u8* eef);
+bool midi_psg_user_envelope(u8* eef);
+bool midi_psg_store_envelope(u8 program, const u8* eef);
+void midi_psg_remove_envelope(u8 program);
+bool midi_psg_program_envelope(u8 program, u8* eef);
+u16 midi_psg_envelope_bank_free(void);
 u8 midi_psg_busy(void);
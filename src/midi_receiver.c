@@ -26,6 +26,8 @@
 #define SYSTEM_SYSEX 0x0
 #define SYSTEM_RESET 0xF
 
+#define SYSEX_CHUNK_LENGTH 32
+
 static void noteOn(u8 status);
 static void noteOff(u8 status);
 static void controlChange(u8 status);
@@ -168,12 +170,17 @@ static void systemMessage(u8 status)
 
 static void readSysEx(void)
 {
-    const u16 BUFFER_LENGTH = 256;
-    u8 buffer[BUFFER_LENGTH];
+    u8 chunk[SYSEX_CHUNK_LENGTH];
     u8 data;
     u16 index = 0;
-    while (index < BUFFER_LENGTH && (data = comm_read()) != SYSEX_END) {
-        buffer[index++] = data;
+    midi_sysex_begin();
+    while ((data = comm_read()) != SYSEX_END) {
+        chunk[index++] = data;
+        if (index == SYSEX_CHUNK_LENGTH) {
+            midi_sysex_data(chunk, index);
+            index = 0;
+        }
     }
-    midi_sysex(buffer, index);
+    midi_sysex_data(chunk, index);
+    midi_sysex_end();
 }
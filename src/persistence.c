@@ -0,0 +1,149 @@
+#include "persistence.h"
+#include "log.h"
+#include <sram.h>
+
+#define VERSION_OFFSET 4
+#define LENGTH_OFFSET 5
+#define CHECKSUM_OFFSET 7
+#define HEADER_LENGTH 9
+#define MAX_PAYLOAD_LENGTH (PERSISTENCE_SIZE - HEADER_LENGTH)
+
+/* The image is a header followed by the payload. Later versions only
+   append to the payload, so an older image restores what it holds and
+   leaves the rest at defaults. */
+static const u8 MAGIC[] = { 'M', 'D', 'M', 'I' };
+
+typedef struct SramImage SramImage;
+
+struct SramImage {
+    u16 position;
+    u16 length;
+    u8 sum1;
+    u8 sum2;
+};
+
+static SramImage image;
+
+static void resetChecksum(void)
+{
+    image.sum1 = 0;
+    image.sum2 = 0;
+}
+
+static u8 addModulo255(u8 a, u8 b)
+{
+    u16 sum = a + b;
+    return sum >= 255 ? sum - 255 : sum;
+}
+
+static void addToChecksum(u8 data)
+{
+    /* Fletcher-16, without a division per byte */
+    image.sum1 = addModulo255(image.sum1, data);
+    image.sum2 = addModulo255(image.sum2, image.sum1);
+}
+
+static u16 checksum(void)
+{
+    return (image.sum2 << 8) | image.sum1;
+}
+
+static u16 readWord(u32 offset)
+{
+    return SRAM_readByte(offset) | (SRAM_readByte(offset + 1) << 8);
+}
+
+static void writeWord(u32 offset, u16 value)
+{
+    SRAM_writeByte(offset, value & 0xFF);
+    SRAM_writeByte(offset + 1, value >> 8);
+}
+
+static bool hasMagic(void)
+{
+    for (u8 i = 0; i < sizeof(MAGIC); i++) {
+        if (SRAM_readByte(i) != MAGIC[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool isValidImage(void)
+{
+    if (!hasMagic()) {
+        return false;
+    }
+    u8 version = SRAM_readByte(VERSION_OFFSET);
+    if (version == 0 || version > PERSISTENCE_VERSION) {
+        log_warn("SRAM: Version %d?", version);
+        return false;
+    }
+    image.length = readWord(LENGTH_OFFSET);
+    if (image.length > MAX_PAYLOAD_LENGTH) {
+        log_warn("SRAM: Corrupt");
+        return false;
+    }
+    resetChecksum();
+    for (u16 i = 0; i < image.length; i++) {
+        addToChecksum(SRAM_readByte(HEADER_LENGTH + i));
+    }
+    if (readWord(CHECKSUM_OFFSET) != checksum()) {
+        log_warn("SRAM: Bad checksum");
+        return false;
+    }
+    return true;
+}
+
+bool persistence_read_begin(void)
+{
+    SRAM_enableRO();
+    bool valid = isValidImage();
+    SRAM_disable();
+    image.position = 0;
+    if (!valid) {
+        image.length = 0;
+    }
+    return valid;
+}
+
+bool persistence_read(u8* data, u16 length)
+{
+    if (length > image.length - image.position) {
+        return false;
+    }
+    SRAM_enableRO();
+    for (u16 i = 0; i < length; i++) {
+        data[i] = SRAM_readByte(HEADER_LENGTH + image.position++);
+    }
+    SRAM_disable();
+    return true;
+}
+
+void persistence_write_begin(void)
+{
+    image.position = 0;
+    resetChecksum();
+}
+
+void persistence_write(const u8* data, u16 length)
+{
+    SRAM_enable();
+    for (u16 i = 0; i < length && image.position < MAX_PAYLOAD_LENGTH; i++) {
+        SRAM_writeByte(HEADER_LENGTH + image.position++, data[i]);
+        addToChecksum(data[i]);
+    }
+    SRAM_disable();
+}
+
+void persistence_write_end(void)
+{
+    SRAM_enable();
+    for (u8 i = 0; i < sizeof(MAGIC); i++) {
+        SRAM_writeByte(i, MAGIC[i]);
+    }
+    SRAM_writeByte(VERSION_OFFSET, PERSISTENCE_VERSION);
+    writeWord(LENGTH_OFFSET, image.position);
+    writeWord(CHECKSUM_OFFSET, checksum());
+    SRAM_disable();
+}
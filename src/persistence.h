@@ -0,0 +1,12 @@
+#pragma once
+#include <stdbool.h>
+#include <types.h>
+
+#define PERSISTENCE_VERSION 1
+#define PERSISTENCE_SIZE 0x8000
+
+bool persistence_read_begin(void);
+bool persistence_read(u8* data, u16 length);
+void persistence_write_begin(void);
+void persistence_write(const u8* data, u16 length);
+void persistence_write_end(void);
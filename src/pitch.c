@@ -0,0 +1,163 @@
+#include "pitch.h"
+#include "midi.h"
+#include "region.h"
+
+#define FM(block, freq) (((block) << 11) | (freq))
+#define FM_BLOCK(blockFreq) ((blockFreq) >> 11)
+#define FM_FREQ(blockFreq) ((blockFreq)&0x7FF)
+#define MIDI_KEYS 128
+#define MAX_MIDI_KEY 127
+#define BEND_RANGE_SHIFT 13
+
+static u16 tuning[MIDI_KEYS];
+
+static u8 keyOf(u16 pitch);
+static u8 fractionOf(u16 pitch);
+static u8 nextKey(u8 key);
+
+/* Notes below the lowest FM block are approximated at half frequency; notes
+   above the highest block are clamped to the largest frequency number. */
+static const u16 FM_PITCHES[MIDI_KEYS] = {
+    FM(0, 322), FM(0, 341), FM(0, 361), FM(0, 383),
+    FM(0, 405), FM(0, 429), FM(0, 455), FM(0, 482),
+    FM(0, 511), FM(0, 541), FM(0, 573), FM(0, 607),
+    FM(0, 644), FM(0, 681), FM(0, 722), FM(0, 765),
+    FM(0, 810), FM(0, 858), FM(0, 910), FM(0, 964),
+    FM(0, 1021), FM(0, 1081), FM(0, 1146), FM(1, 607),
+    FM(1, 644), FM(1, 681), FM(1, 722), FM(1, 765),
+    FM(1, 810), FM(1, 858), FM(1, 910), FM(1, 964),
+    FM(1, 1021), FM(1, 1081), FM(1, 1146), FM(2, 607),
+    FM(2, 644), FM(2, 681), FM(2, 722), FM(2, 765),
+    FM(2, 810), FM(2, 858), FM(2, 910), FM(2, 964),
+    FM(2, 1021), FM(2, 1081), FM(2, 1146), FM(3, 607),
+    FM(3, 644), FM(3, 681), FM(3, 722), FM(3, 765),
+    FM(3, 810), FM(3, 858), FM(3, 910), FM(3, 964),
+    FM(3, 1021), FM(3, 1081), FM(3, 1146), FM(4, 607),
+    FM(4, 644), FM(4, 681), FM(4, 722), FM(4, 765),
+    FM(4, 810), FM(4, 858), FM(4, 910), FM(4, 964),
+    FM(4, 1021), FM(4, 1081), FM(4, 1146), FM(5, 607),
+    FM(5, 644), FM(5, 681), FM(5, 722), FM(5, 765),
+    FM(5, 810), FM(5, 858), FM(5, 910), FM(5, 964),
+    FM(5, 1021), FM(5, 1081), FM(5, 1146), FM(6, 607),
+    FM(6, 644), FM(6, 681), FM(6, 722), FM(6, 765),
+    FM(6, 810), FM(6, 858), FM(6, 910), FM(6, 964),
+    FM(6, 1021), FM(6, 1081), FM(6, 1146), FM(7, 607),
+    FM(7, 644), FM(7, 681), FM(7, 722), FM(7, 765),
+    FM(7, 810), FM(7, 858), FM(7, 910), FM(7, 964),
+    FM(7, 1021), FM(7, 1081), FM(7, 1146), FM(7, 1214),
+    FM(7, 1288), FM(7, 1362), FM(7, 1444), FM(7, 1530),
+    FM(7, 1620), FM(7, 1716), FM(7, 1820), FM(7, 1928),
+    FM(7, 2042), FM(7, 2047), FM(7, 2047), FM(7, 2047),
+    FM(7, 2047), FM(7, 2047), FM(7, 2047), FM(7, 2047),
+    FM(7, 2047), FM(7, 2047), FM(7, 2047), FM(7, 2047),
+};
+
+/* Tones below A2 cannot be represented by the 10-bit PSG counter. */
+static const u16 TONES_NTSC[MIDI_KEYS] = {
+    1016, 1016, 1016, 1016, 1016, 1016, 1016, 1016, 1016, 1016, 1016, 1016,
+    1016, 1016, 1016, 1016, 1016, 1016, 1016, 1016, 1016, 1016, 1016, 1016,
+    1016, 1016, 1016, 1016, 1016, 1016, 1016, 1016, 1016, 1016, 1016, 1016,
+    1016, 1016, 1016, 1016, 1016, 1016, 1016, 1016, 1016, 1016, 959, 905,
+    855, 807, 761, 719, 678, 640, 604, 570, 538, 508, 479, 452,
+    427, 403, 380, 359, 339, 320, 302, 285, 269, 254, 239, 226,
+    213, 201, 190, 179, 169, 160, 151, 142, 134, 127, 119, 113,
+    106, 100, 95, 89, 84, 80, 75, 71, 67, 63, 59, 56,
+    53, 50, 47, 44, 42, 40, 37, 35, 33, 31, 29, 28,
+    26, 25, 23, 22, 21, 20, 18, 17, 16, 15, 14, 14,
+    13, 12, 11, 11, 10, 10, 9, 8,
+};
+
+static const u16 TONES_PAL[MIDI_KEYS] = {
+    1007, 1007, 1007, 1007, 1007, 1007, 1007, 1007, 1007, 1007, 1007, 1007,
+    1007, 1007, 1007, 1007, 1007, 1007, 1007, 1007, 1007, 1007, 1007, 1007,
+    1007, 1007, 1007, 1007, 1007, 1007, 1007, 1007, 1007, 1007, 1007, 1007,
+    1007, 1007, 1007, 1007, 1007, 1007, 1007, 1007, 1007, 1007, 951, 897,
+    847, 799, 754, 712, 672, 634, 599, 565, 533, 503, 475, 448,
+    423, 399, 377, 356, 336, 317, 299, 282, 266, 251, 237, 224,
+    211, 199, 188, 178, 168, 158, 149, 141, 133, 125, 118, 112,
+    105, 99, 94, 89, 84, 79, 74, 70, 66, 62, 59, 56,
+    52, 49, 47, 44, 42, 39, 37, 35, 33, 31, 29, 28,
+    26, 24, 23, 22, 21, 19, 18, 17, 16, 15, 14, 14,
+    13, 12, 11, 11, 10, 9, 9, 8,
+};
+
+void pitch_init(void)
+{
+    for (u8 key = 0; key < MIDI_KEYS; key++) {
+        tuning[key] = (u16)key << PITCH_FRACTION_BITS;
+    }
+}
+
+void pitch_tune(u8 key, u16 pitch)
+{
+    tuning[key] = pitch;
+}
+
+u16 pitch_fromKey(u8 key, s32 offset)
+{
+    s32 pitch = tuning[key] + offset;
+    if (pitch < 0) {
+        return 0;
+    }
+    if (pitch > MAX_PITCH) {
+        return MAX_PITCH;
+    }
+    return pitch;
+}
+
+static u8 keyOf(u16 pitch)
+{
+    return pitch >> PITCH_FRACTION_BITS;
+}
+
+static u8 fractionOf(u16 pitch)
+{
+    return pitch & (PITCH_SEMITONE - 1);
+}
+
+static u8 nextKey(u8 key)
+{
+    return key < MAX_MIDI_KEY ? key + 1 : key;
+}
+
+void pitch_fm(u16 pitch, u8* octave, u16* freqNumber)
+{
+    u16 lower = FM_PITCHES[keyOf(pitch)];
+    *octave = FM_BLOCK(lower);
+    *freqNumber = FM_FREQ(lower);
+    u8 frac = fractionOf(pitch);
+    if (frac == 0) {
+        return;
+    }
+    u16 upper = FM_PITCHES[nextKey(keyOf(pitch))];
+    u16 upperFreq = FM_FREQ(upper);
+    if (FM_BLOCK(upper) != FM_BLOCK(lower)) {
+        upperFreq <<= 1;
+    }
+    *freqNumber
+        += ((u32)(upperFreq - *freqNumber) * frac) >> PITCH_FRACTION_BITS;
+}
+
+u16 pitch_psgTone(u16 pitch)
+{
+    const u16* tones = region_isPal() ? TONES_PAL : TONES_NTSC;
+    u16 tone = tones[keyOf(pitch)];
+    u8 frac = fractionOf(pitch);
+    if (frac == 0) {
+        return tone;
+    }
+    u16 higherTone = tones[nextKey(keyOf(pitch))];
+    return tone - (((u32)(tone - higherTone) * frac) >> PITCH_FRACTION_BITS);
+}
+
+u16 pitch_bendRange(u8 semitones, u8 cents)
+{
+    /* cents * 256 / 100, rounded down */
+    return ((u16)semitones << PITCH_FRACTION_BITS) + ((cents * 41) >> 4);
+}
+
+s16 pitch_bendOffset(u16 bend, u16 range)
+{
+    return ((s32)(s16)(bend - MIDI_PITCH_BEND_CENTRE) * range)
+        >> BEND_RANGE_SHIFT;
+}
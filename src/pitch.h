@@ -0,0 +1,15 @@
+#pragma once
+#include <types.h>
+
+/* Pitches are MIDI keys in 8.8 fixed point, i.e. 1/256ths of a semitone. */
+#define PITCH_FRACTION_BITS 8
+#define PITCH_SEMITONE (1 << PITCH_FRACTION_BITS)
+#define MAX_PITCH 0x7FFF
+
+void pitch_init(void);
+void pitch_tune(u8 key, u16 pitch);
+u16 pitch_fromKey(u8 key, s32 offset);
+void pitch_fm(u16 pitch, u8* octave, u16* freqNumber);
+u16 pitch_psgTone(u16 pitch);
+u16 pitch_bendRange(u8 semitones, u8 cents);
+s16 pitch_bendOffset(u16 bend, u16 range);
@@ -0,0 +1,1437 @@
+/* Generated by utils/preset_images from src/presets.c. Do not edit. */
+#include "presets.h"
+
+static const FmPresetImage M_BANK_0_INST_0_GRANDPIANO_IMAGE
+    = { { 0x01, 0xC0, 0x01, 0x64, 0x72, 0x31, 0x27, 0x24, 0x04, 0x02,
+        0x5A, 0x58, 0xDF, 0x9B, 0x07, 0x09, 0x17, 0x04, 0x04, 0x09,
+        0x0F, 0x04, 0x71, 0x67, 0x91, 0xA6, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_1_BRIGHTPIANO_IMAGE
+    = { { 0x09, 0x40, 0x11, 0x11, 0x11, 0x11, 0x01, 0x01, 0x01, 0x01,
+        0x41, 0x41, 0x41, 0x41, 0x81, 0x81, 0x81, 0x81, 0x01, 0x01,
+        0x01, 0x01, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_2_ELECTRICPIANO_ANIMATICS_IMAGE
+    = { { 0x04, 0xC0, 0x11, 0x11, 0x11, 0x11, 0x01, 0x01, 0x01, 0x01,
+        0x41, 0x41, 0x41, 0x41, 0x81, 0x81, 0x81, 0x81, 0x01, 0x01,
+        0x01, 0x01, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_3_HONKYTONK_SONICMODDED_IMAGE
+    = { { 0x00, 0xC0, 0x11, 0x11, 0x11, 0x11, 0x02, 0x02, 0x02, 0x02,
+        0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+        0x02, 0x02, 0x27, 0x27, 0x27, 0x27, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_4_RHODESPIANO_IMAGE
+    = { { 0x34, 0xC0, 0x4C, 0x41, 0x01, 0x01, 0x39, 0x22, 0x09, 0x09,
+        0x5F, 0x96, 0x9F, 0x9F, 0x07, 0x05, 0x84, 0x84, 0x00, 0x00,
+        0x04, 0x04, 0xB8, 0xB8, 0x18, 0x68, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_5_CHORUSPIANOTINITOON_IMAGE
+    = { { 0x37, 0xC0, 0x7A, 0x51, 0x32, 0x11, 0x1E, 0x0A, 0x0C, 0x14,
+        0x1F, 0x59, 0x1F, 0x19, 0x0A, 0x05, 0x0D, 0x0A, 0x07, 0x02,
+        0x00, 0x02, 0xF6, 0xF6, 0xF8, 0xF6, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_6_HARPSICHORD_ADAMS_IMAGE
+    = { { 0x39, 0xC0, 0x16, 0x50, 0x3A, 0x70, 0x26, 0x23, 0x21, 0x06,
+        0x9F, 0xDF, 0xDF, 0x1F, 0x80, 0x80, 0x00, 0x06, 0x01, 0x00,
+        0x01, 0x06, 0x05, 0x02, 0x06, 0x47, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_7_CLAVINET_IMAGE
+    = { { 0x39, 0xC0, 0x11, 0x51, 0x31, 0x71, 0x1C, 0x1E, 0x21, 0x06,
+        0x9F, 0xDF, 0x9F, 0x1F, 0x80, 0x80, 0x00, 0x06, 0x01, 0x00,
+        0x01, 0x06, 0x06, 0x02, 0x07, 0x47, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_8_CELESTA_IMAGE
+    = { { 0x00, 0xF0, 0x13, 0x3B, 0x71, 0x71, 0x08, 0x22, 0x11, 0x0B,
+        0x53, 0x1D, 0x5B, 0x1F, 0x01, 0x0F, 0x07, 0x00, 0x1B, 0x1F,
+        0x1A, 0x09, 0x40, 0xF8, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_9_GLOCKENSPIEL_IMAGE
+    = { { 0x0C, 0xF0, 0x17, 0x35, 0x71, 0x71, 0x1E, 0x33, 0x00, 0x0F,
+        0x1F, 0x1F, 0x9F, 0x9F, 0x07, 0x0B, 0x07, 0x07, 0x00, 0x00,
+        0x00, 0x00, 0xF2, 0xF6, 0xF3, 0xF3, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_10_MUSICBOX_IMAGE
+    = { { 0x0C, 0xF0, 0x17, 0x3A, 0x71, 0x70, 0x1E, 0x33, 0x00, 0x0F,
+        0x0F, 0x0F, 0x1F, 0x1F, 0x0E, 0x0E, 0x0C, 0x0C, 0x00, 0x00,
+        0x00, 0x00, 0xF7, 0xF5, 0xF6, 0xF6, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_11_VIBRAPHONE_NINEKO_IMAGE
+    = { { 0x3E, 0xE0, 0x38, 0x7A, 0x01, 0x34, 0x28, 0x23, 0x04, 0x04,
+        0x59, 0x5F, 0x59, 0x9C, 0x0F, 0x10, 0x86, 0x0A, 0x06, 0x06,
+        0x05, 0x05, 0xA6, 0x66, 0xA6, 0x65, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_12_MARIMBA_ALADDIN_IMAGE
+    = { { 0x04, 0xC0, 0x45, 0x22, 0x31, 0x01, 0x1B, 0x28, 0x00, 0x0B,
+        0x1F, 0x9F, 0x1E, 0x1F, 0x93, 0x92, 0x0F, 0x0F, 0x07, 0x04,
+        0x07, 0x02, 0x7E, 0x82, 0xF7, 0xF7, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_13_XYLAPHONE_ALADDIN_IMAGE
+    = { { 0x00, 0xC0, 0x70, 0x63, 0x70, 0x70, 0x00, 0x1F, 0x00, 0x00,
+        0x40, 0x5D, 0x5F, 0x1F, 0x9D, 0x0F, 0x80, 0x00, 0x1F, 0x1F,
+        0x18, 0x0C, 0x9F, 0xFF, 0x0F, 0x06, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_14_TUBULARBELLS_ANIMATICS_IMAGE
+    = { { 0x2C, 0xC0, 0x77, 0x37, 0x32, 0x72, 0x1E, 0x1E, 0x08, 0x08,
+        0x16, 0x16, 0x18, 0x13, 0x05, 0x06, 0x03, 0x02, 0x1E, 0x1E,
+        0x1F, 0x1F, 0xF4, 0x84, 0xC4, 0x94, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_15_DULCIMER_IMAGE
+    = { { 0x16, 0xC0, 0x03, 0x0A, 0x01, 0x01, 0x17, 0x2C, 0x03, 0x09,
+        0x4F, 0x53, 0x98, 0x96, 0x0B, 0x0E, 0x08, 0x08, 0x06, 0x06,
+        0x00, 0x00, 0xF5, 0x46, 0xF5, 0xF3, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_16_HAMMOND_NINEKO_IMAGE
+    = { { 0x27, 0xC0, 0x14, 0x51, 0x30, 0x62, 0x11, 0x0F, 0x17, 0x17,
+        0x5C, 0x5C, 0x5C, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04,
+        0x1B, 0x04, 0xFA, 0xF8, 0xF8, 0xFA, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_17_PERCUSIVEORGAIN_ACTION52_IMAGE
+    = { { 0x04, 0xF2, 0x0E, 0x11, 0x06, 0x01, 0x15, 0x11, 0x07, 0x0B,
+        0x1B, 0x15, 0x14, 0x17, 0x17, 0x1C, 0x09, 0x01, 0x0B, 0x05,
+        0x00, 0x1F, 0xB8, 0x2F, 0x28, 0xAF, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_18_ROCKORGAN_IMAGE
+    = { { 0x24, 0xD4, 0x13, 0x01, 0x01, 0x52, 0x19, 0x18, 0x07, 0x0A,
+        0x54, 0x94, 0x94, 0x94, 0x8C, 0x80, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x2A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_19_CHURCHORGAN_IMAGE
+    = { { 0x16, 0xC0, 0x13, 0x04, 0x01, 0x00, 0x1B, 0x06, 0x09, 0x04,
+        0x94, 0x13, 0x0E, 0x0C, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00,
+        0x00, 0x00, 0x23, 0x29, 0x16, 0x16, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_20_REEDORGAN_IMAGE
+    = { { 0x34, 0xD0, 0x11, 0x01, 0x01, 0x02, 0x19, 0x15, 0x07, 0x07,
+        0x98, 0x19, 0x10, 0x8D, 0x10, 0x00, 0x00, 0x80, 0x00, 0x00,
+        0x00, 0x00, 0x17, 0x06, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_21_ACCORDEON_IMAGE
+    = { { 0x32, 0xC2, 0x31, 0x72, 0x37, 0x02, 0x1E, 0x34, 0x15, 0x00,
+        0x15, 0x0E, 0x12, 0x8D, 0x05, 0x09, 0x08, 0x16, 0x00, 0x03,
+        0x00, 0x00, 0x17, 0x29, 0x28, 0x19, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_22_HARMONICA_SONIC_IMAGE
+    = { { 0x38, 0xC0, 0x3A, 0x11, 0x0A, 0x02, 0x2D, 0x27, 0x28, 0x00,
+        0xD4, 0x50, 0x14, 0x10, 0x05, 0x02, 0x08, 0x88, 0x00, 0x00,
+        0x00, 0x00, 0x99, 0x09, 0x09, 0x1A, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_23_TANGO_ACCORDION_IMAGE
+    = { { 0x34, 0xD0, 0x13, 0x03, 0x01, 0x52, 0x19, 0x1A, 0x07, 0x08,
+        0x0F, 0x0E, 0x8D, 0x8E, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00,
+        0x00, 0x00, 0x1A, 0x1A, 0x2A, 0x2A, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_24_NYLONGUITARHELLROLL_IMAGE
+    = { { 0x18, 0xC0, 0x05, 0x31, 0x30, 0x00, 0x30, 0x2D, 0x13, 0x00,
+        0x1F, 0x1F, 0x1F, 0x5F, 0x12, 0x0E, 0x0A, 0x0A, 0x00, 0x04,
+        0x04, 0x03, 0x27, 0x27, 0x27, 0x27, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_25_STEELGUITARHELLROLL_IMAGE
+    = { { 0x18, 0xC0, 0x05, 0x31, 0x30, 0x00, 0x20, 0x2D, 0x13, 0x00,
+        0x1F, 0x1F, 0x1F, 0x5F, 0x12, 0x0E, 0x0A, 0x0A, 0x00, 0x04,
+        0x04, 0x03, 0x27, 0x27, 0x27, 0x27, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_26_JAZZGUITAR_IMAGE
+    = { { 0x28, 0xC0, 0x02, 0x31, 0x33, 0x01, 0x1E, 0x2A, 0x2B, 0x00,
+        0x5F, 0x9F, 0x5F, 0x1F, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00,
+        0x00, 0x00, 0xF7, 0xF7, 0xF7, 0xF7, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_27_CLEANGUITAR_COLUMNS_III_IMAGE
+    = { { 0x38, 0xC0, 0x58, 0x53, 0x33, 0x31, 0x27, 0x22, 0x1D, 0x00,
+        0x5F, 0x5F, 0x5F, 0x5F, 0x07, 0x04, 0x0A, 0x1F, 0x00, 0x00,
+        0x00, 0x04, 0xF6, 0xF8, 0xF9, 0x17, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_28_MUTEDGUITAR_ALADDIN_IMAGE
+    = { { 0x1A, 0xC4, 0x33, 0x31, 0x04, 0x01, 0x1C, 0x05, 0x0B, 0x00,
+        0x54, 0x5B, 0x58, 0x14, 0x17, 0x1B, 0x17, 0x12, 0x09, 0x07,
+        0x01, 0x04, 0x8A, 0x8B, 0xBB, 0x0C, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_29_OVERDRIVE_OPL3_IMAGE
+    = { { 0x00, 0xC4, 0x03, 0x21, 0x02, 0x02, 0x24, 0x20, 0x19, 0x00,
+        0x9F, 0x53, 0x92, 0x91, 0x0C, 0x01, 0x01, 0x01, 0x00, 0x00,
+        0x00, 0x00, 0x8C, 0xB8, 0xDA, 0x47, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_30_DISTORTION_OPL3_IMAGE
+    = { { 0x00, 0xC4, 0x03, 0x21, 0x02, 0x02, 0x24, 0x1A, 0x19, 0x00,
+        0x9F, 0x53, 0x92, 0x91, 0x0C, 0x02, 0x01, 0x01, 0x00, 0x00,
+        0x00, 0x00, 0x8C, 0xB8, 0xF7, 0x46, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_31_GUITAR_HARMONICSHELLFIRE_IMAGE
+    = { { 0x33, 0xC5, 0x0A, 0x32, 0x78, 0x11, 0x1C, 0x14, 0x0D, 0x00,
+        0x90, 0x9F, 0x95, 0x10, 0x06, 0x03, 0x06, 0x02, 0x08, 0x00,
+        0x07, 0x0F, 0xFC, 0xF6, 0x81, 0xF7, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_32_ACOUSTICBASS_SONIC_IMAGE
+    = { { 0x3A, 0xC0, 0x20, 0x60, 0x23, 0x01, 0x21, 0x28, 0x25, 0x00,
+        0x1E, 0x1F, 0x1F, 0x1F, 0x0A, 0x08, 0x0A, 0x07, 0x05, 0x0A,
+        0x07, 0x07, 0xA4, 0x96, 0x85, 0x78, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_33_FINGERBASS_SONIC_IMAGE
+    = { { 0x08, 0xC0, 0x09, 0x30, 0x70, 0x00, 0x25, 0x13, 0x30, 0x00,
+        0x1F, 0x5F, 0x1F, 0x5F, 0x12, 0x0A, 0x0E, 0x0A, 0x00, 0x04,
+        0x04, 0x03, 0x2F, 0x2F, 0x2F, 0x2F, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_34_PICKBASS_IMAGE
+    = { { 0x08, 0xC0, 0x09, 0x30, 0x70, 0x00, 0x1E, 0x0E, 0x31, 0x00,
+        0x1F, 0x5F, 0x1F, 0x5F, 0x15, 0x0D, 0x0E, 0x0A, 0x00, 0x04,
+        0x04, 0x03, 0x8F, 0x2F, 0x3F, 0x2F, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_35_FRETLESSBASSALADDIN_IMAGE
+    = { { 0x06, 0xC4, 0x00, 0x50, 0x00, 0x60, 0x1D, 0x00, 0x05, 0x09,
+        0x1A, 0x92, 0x4D, 0x4A, 0x09, 0x0B, 0x03, 0x0C, 0x07, 0x13,
+        0x00, 0x00, 0x0B, 0xEA, 0x6A, 0xFA, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_36_SLAPBASS1_IMAGE
+    = { { 0x20, 0xC0, 0x3F, 0x00, 0x03, 0x01, 0x13, 0x18, 0x38, 0x00,
+        0x9F, 0x5F, 0x9F, 0x5F, 0x0E, 0x0D, 0x0F, 0x07, 0x08, 0x08,
+        0x08, 0x08, 0x27, 0x27, 0x27, 0x17, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_37_SLAPBASS2_IMAGE
+    = { { 0x20, 0xC0, 0x3F, 0x00, 0x03, 0x01, 0x0E, 0x18, 0x38, 0x00,
+        0x9F, 0x5F, 0x9F, 0x5F, 0x0E, 0x0D, 0x0F, 0x07, 0x06, 0x08,
+        0x08, 0x08, 0x27, 0x27, 0x27, 0x17, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_38_SYNBASS1_DYNABROS_IMAGE
+    = { { 0x3D, 0xC0, 0x44, 0x02, 0x14, 0x33, 0x17, 0x05, 0x00, 0x18,
+        0x55, 0x54, 0x59, 0x54, 0x1E, 0x1E, 0x1E, 0x1E, 0x0D, 0x09,
+        0x0A, 0x05, 0x0B, 0x09, 0x0A, 0x89, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_39_SYNBASS2_NINEKO_IMAGE
+    = { { 0x20, 0xC0, 0x36, 0x30, 0x35, 0x31, 0x19, 0x13, 0x37, 0x00,
+        0xDF, 0x9F, 0xDF, 0x9F, 0x07, 0x09, 0x06, 0x06, 0x07, 0x06,
+        0x06, 0x08, 0x20, 0x17, 0x16, 0xF6, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_40_VIOLIN_IMAGE
+    = { { 0x3A, 0xE3, 0x31, 0x70, 0x37, 0x02, 0x1E, 0x31, 0x1F, 0x03,
+        0x0F, 0x0C, 0x0D, 0x8B, 0x04, 0x09, 0x10, 0x0A, 0x00, 0x03,
+        0x00, 0x00, 0x15, 0x07, 0x04, 0x15, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_41_VIOLA_IMAGE
+    = { { 0x3A, 0xE3, 0x31, 0x70, 0x34, 0x02, 0x1E, 0x3D, 0x1E, 0x03,
+        0x0E, 0x0B, 0x0E, 0x8C, 0x04, 0x09, 0x10, 0x0A, 0x00, 0x03,
+        0x00, 0x00, 0x15, 0x07, 0x04, 0x15, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_42_CELLO_IMAGE
+    = { { 0x3A, 0xE3, 0x31, 0x70, 0x35, 0x02, 0x28, 0x2F, 0x1E, 0x03,
+        0x10, 0x0E, 0x4E, 0x8E, 0x04, 0x09, 0x10, 0x0A, 0x00, 0x03,
+        0x00, 0x00, 0x15, 0x08, 0x04, 0x16, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_43_CONTROLBASS_IMAGE
+    = { { 0x3A, 0xE3, 0x31, 0x70, 0x34, 0x02, 0x2B, 0x1F, 0x2C, 0x00,
+        0x10, 0x0E, 0x0E, 0x8E, 0x04, 0x09, 0x10, 0x0A, 0x00, 0x03,
+        0x00, 0x00, 0x15, 0x07, 0x04, 0x15, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_44_TREMOLOSTRINGS_IMAGE
+    = { { 0x3C, 0xE5, 0x31, 0x01, 0x01, 0x01, 0x15, 0x13, 0x06, 0x00,
+        0xD0, 0x8D, 0x0F, 0x0E, 0x81, 0x0B, 0x0A, 0x0A, 0x00, 0x00,
+        0x00, 0x00, 0x13, 0x44, 0x27, 0x18, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_45_PIZZIKATOSTRINGS_IMAGE
+    = { { 0x35, 0xC0, 0x14, 0x12, 0x11, 0x11, 0x00, 0x05, 0x08, 0x0C,
+        0xD3, 0x53, 0x10, 0x52, 0x13, 0x0F, 0x13, 0x0E, 0x0B, 0x18,
+        0x17, 0x0E, 0xA7, 0xF7, 0xF7, 0xC7, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_46_ORCHESTRALHARP_IMAGE
+    = { { 0x04, 0xC0, 0x02, 0x51, 0x11, 0x50, 0x1B, 0x7F, 0x00, 0x7F,
+        0x1F, 0x5F, 0x1F, 0x4E, 0x0A, 0x0A, 0x0E, 0x0B, 0x00, 0x02,
+        0x05, 0x02, 0x14, 0x74, 0x64, 0xF4, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_47_TIMPANY_IMAGE
+    = { { 0x0C, 0xC0, 0x00, 0x01, 0x01, 0x02, 0x0A, 0x00, 0x00, 0x47,
+        0x54, 0x1F, 0x1F, 0x0F, 0x0F, 0x0E, 0x0B, 0x0D, 0x00, 0x00,
+        0x00, 0x00, 0xF7, 0xFA, 0xF6, 0xFE, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_48_STRINGESSEMBLE1_IMAGE
+    = { { 0x3C, 0xD3, 0x31, 0x01, 0x05, 0x01, 0x1D, 0x1C, 0x06, 0x00,
+        0xCE, 0x8E, 0x0E, 0x0F, 0x0B, 0x8A, 0x8A, 0x0A, 0x00, 0x00,
+        0x00, 0x00, 0x04, 0x15, 0x28, 0x18, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_49_STRINGESSEMBLE2_IMAGE
+    = { { 0x3C, 0xD1, 0x31, 0x01, 0x01, 0x01, 0x1D, 0x1C, 0x06, 0x03,
+        0xCB, 0x8B, 0x0A, 0x0A, 0x0B, 0x8A, 0x08, 0x08, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0x11, 0x26, 0x16, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_50_SYNSTRINGS_1_IMAGE
+    = { { 0x34, 0xC0, 0x11, 0x31, 0x01, 0x01, 0x15, 0x1C, 0x18, 0x02,
+        0x1A, 0x19, 0x0A, 0x0A, 0x82, 0x81, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x62, 0xB3, 0x06, 0x05, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_51_SYNSTRING2_ALADDIN_IMAGE
+    = { { 0x32, 0xD5, 0x30, 0x00, 0x34, 0x00, 0x23, 0x20, 0x34, 0x00,
+        0x08, 0x0F, 0x88, 0x48, 0x04, 0x01, 0x03, 0x8A, 0x00, 0x03,
+        0x00, 0x00, 0x05, 0x73, 0xA4, 0x05, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_52_CHOIR_AAHS_IMAGE
+    = { { 0x04, 0xC4, 0x30, 0x70, 0x30, 0x70, 0x2A, 0x1E, 0x08, 0x08,
+        0x51, 0x8D, 0x4D, 0x8B, 0x80, 0x00, 0x80, 0x80, 0x00, 0x00,
+        0x00, 0x00, 0x51, 0x51, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_53_VOICE_IMAGE
+    = { { 0x34, 0xC0, 0x75, 0x31, 0x03, 0x01, 0x00, 0x0E, 0x25, 0x00,
+        0x14, 0x93, 0x55, 0x4D, 0x0A, 0x0D, 0x0A, 0x84, 0x03, 0x05,
+        0x02, 0x00, 0x17, 0x28, 0x67, 0x18, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_54_SYNTHVOICE_IMAGE
+    = { { 0x20, 0xC4, 0x3A, 0x70, 0x37, 0x70, 0x4C, 0x2E, 0x33, 0x00,
+        0x4C, 0x8C, 0x4E, 0x8B, 0x80, 0x00, 0x80, 0x80, 0x00, 0x00,
+        0x00, 0x00, 0x51, 0x51, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_55_ORCHESTRAHIT_IMAGE
+    = { { 0x38, 0xC0, 0x00, 0x01, 0x01, 0x02, 0x13, 0x15, 0x11, 0x00,
+        0x50, 0x12, 0x16, 0x52, 0x0D, 0x05, 0x09, 0x0A, 0x00, 0x00,
+        0x00, 0x00, 0xF5, 0xF2, 0xF3, 0xF5, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_56_TRUMPET_SONIC_IMAGE
+    = { { 0x3D, 0xC0, 0x02, 0x02, 0x04, 0x02, 0x1B, 0x15, 0x0A, 0x09,
+        0x90, 0x13, 0x10, 0x14, 0x0E, 0x0E, 0x0B, 0x0D, 0x01, 0x00,
+        0x00, 0x00, 0x14, 0x19, 0xFD, 0x0E, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_57_TROMBONE_ALADDIN_IMAGE
+    = { { 0x2D, 0xE3, 0x00, 0x00, 0x00, 0x51, 0x1A, 0x12, 0x09, 0x03,
+        0x8C, 0x8A, 0x97, 0x97, 0x0D, 0x08, 0x87, 0x87, 0x01, 0x00,
+        0x02, 0x00, 0x2A, 0x2A, 0x1A, 0x1A, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_58_TUBA_ALADDIN_IMAGE
+    = { { 0x3D, 0xD2, 0x00, 0x01, 0x00, 0x51, 0x1B, 0x03, 0x04, 0x05,
+        0x8E, 0x8D, 0x8E, 0x91, 0x06, 0x0D, 0x87, 0x87, 0x01, 0x0A,
+        0x02, 0x00, 0x66, 0x25, 0x15, 0x16, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_59_MUTEDTRUMPET_SONIC_IMAGE
+    = { { 0x3D, 0xC0, 0x12, 0x02, 0x02, 0x02, 0x15, 0x4A, 0x1F, 0x00,
+        0x8F, 0x0F, 0x0D, 0x0F, 0x0E, 0x0E, 0x0B, 0x0D, 0x01, 0x00,
+        0x00, 0x00, 0x13, 0x18, 0xFD, 0x0E, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_60_FRENCHHORN_IMAGE
+    = { { 0x3C, 0xC0, 0x01, 0x00, 0x01, 0x00, 0x22, 0x7F, 0x00, 0x7F,
+        0x8B, 0x00, 0x94, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x37, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_61_BRASSSECTION_GREENDOG_IMAGE
+    = { { 0x35, 0xD2, 0x21, 0x20, 0x31, 0x14, 0x1A, 0x09, 0x00, 0x06,
+        0x8E, 0x95, 0x9B, 0x94, 0x00, 0x00, 0x05, 0x80, 0x01, 0x02,
+        0x02, 0x02, 0x47, 0x17, 0x36, 0x08, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_62_SYNBRASS1_IMAGE
+    = { { 0x32, 0xC2, 0x01, 0x71, 0x31, 0x01, 0x14, 0x2A, 0x1C, 0x00,
+        0x16, 0x1F, 0x1F, 0x13, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xF6, 0x0C, 0x0D, 0x08, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_63_SYNBRASS2_IMAGE
+    = { { 0x3A, 0xE3, 0x31, 0x72, 0x37, 0x02, 0x1E, 0x37, 0x1F, 0x00,
+        0x11, 0x11, 0x11, 0x91, 0x04, 0x09, 0x10, 0x0A, 0x00, 0x03,
+        0x00, 0x00, 0x19, 0x09, 0x09, 0x17, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_64_SOPRANOSAX_IMAGE
+    = { { 0x35, 0xD2, 0x21, 0x20, 0x32, 0x12, 0x20, 0x0E, 0x0D, 0x00,
+        0x51, 0x4D, 0x4C, 0x8E, 0x00, 0x00, 0x05, 0x80, 0x01, 0x02,
+        0x02, 0x02, 0x48, 0x18, 0x37, 0x09, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_65_ALTOSAX_IMAGE
+    = { { 0x35, 0xD2, 0x21, 0x20, 0x31, 0x14, 0x1A, 0x0B, 0x05, 0x04,
+        0x8E, 0x53, 0x8C, 0x8E, 0x00, 0x00, 0x05, 0x80, 0x01, 0x02,
+        0x02, 0x02, 0x48, 0x18, 0x37, 0x08, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_66_TENORSAX_IMAGE
+    = { { 0x35, 0xD2, 0x21, 0x20, 0x31, 0x12, 0x1E, 0x0A, 0x05, 0x04,
+        0x8F, 0x52, 0x8B, 0x8D, 0x00, 0x00, 0x05, 0x80, 0x01, 0x02,
+        0x02, 0x02, 0x48, 0x17, 0x36, 0x08, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_67_BARITONESAX_IMAGE
+    = { { 0x35, 0xD2, 0x21, 0x20, 0x31, 0x13, 0x17, 0x0A, 0x05, 0x04,
+        0x8E, 0x91, 0x8E, 0x91, 0x00, 0x00, 0x05, 0x80, 0x01, 0x02,
+        0x02, 0x02, 0x48, 0x17, 0x36, 0x08, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_68_OBOE_ALADDIN_IMAGE
+    = { { 0x38, 0xD2, 0x01, 0x01, 0x01, 0x04, 0x27, 0x28, 0x1E, 0x00,
+        0x18, 0x16, 0x10, 0x18, 0x97, 0x1F, 0x9F, 0x1F, 0x00, 0x00,
+        0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_69_ENGLISHHORN_IMAGE
+    = { { 0x38, 0xD2, 0x01, 0x01, 0x01, 0x02, 0x26, 0x2B, 0x17, 0x05,
+        0x18, 0x16, 0x10, 0x10, 0x97, 0x1F, 0x9F, 0x1F, 0x00, 0x00,
+        0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x08, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_70_BASSOON_ALADDIN_IMAGE
+    = { { 0x38, 0xD2, 0x00, 0x00, 0x01, 0x02, 0x27, 0x24, 0x23, 0x00,
+        0x03, 0x1F, 0x0F, 0x10, 0x97, 0x1F, 0x9F, 0x1F, 0x00, 0x00,
+        0x00, 0x00, 0x0C, 0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_71_CLARINET_ALADDIN_IMAGE
+    = { { 0x0C, 0xE3, 0x12, 0x72, 0x71, 0x11, 0x1E, 0x12, 0x04, 0x0C,
+        0x8D, 0x4F, 0x12, 0x13, 0x00, 0x8B, 0x00, 0x8F, 0x01, 0x1D,
+        0x00, 0x06, 0x0A, 0x8A, 0x0A, 0x2A, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_72_PICCOLO_ALADDIN_IMAGE
+    = { { 0x17, 0xF2, 0x32, 0x32, 0x72, 0x12, 0x09, 0x11, 0x06, 0x0B,
+        0xCA, 0x8C, 0x8A, 0xCA, 0x00, 0x8C, 0x08, 0x8D, 0x00, 0x0A,
+        0x00, 0x00, 0x08, 0xC8, 0x78, 0x78, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_73_FLUTE_IMAGE
+    = { { 0x34, 0xD0, 0x75, 0x31, 0x03, 0x01, 0x00, 0x16, 0x31, 0x00,
+        0x14, 0x93, 0x56, 0x4E, 0x0A, 0x0D, 0x0C, 0x84, 0x03, 0x00,
+        0x02, 0x00, 0x15, 0x45, 0x68, 0x18, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_74_RECORDER_IMAGE
+    = { { 0x3B, 0xC0, 0x71, 0x32, 0x02, 0x02, 0x08, 0x24, 0x37, 0x00,
+        0x54, 0x8D, 0x54, 0x4E, 0x0E, 0x04, 0x10, 0x84, 0x03, 0x00,
+        0x02, 0x00, 0x65, 0x25, 0x55, 0x08, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_75_PANFLUTE_IMAGE
+    = { { 0x34, 0xC0, 0x75, 0x32, 0x03, 0x01, 0x00, 0x13, 0x31, 0x00,
+        0x13, 0x92, 0x56, 0x4E, 0x0A, 0x0D, 0x0C, 0x84, 0x00, 0x00,
+        0x00, 0x00, 0x15, 0x45, 0x15, 0x18, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_76_BOTTLEBLOW_IMAGE
+    = { { 0x3C, 0xC0, 0x75, 0x32, 0x03, 0x01, 0x00, 0x18, 0x29, 0x00,
+        0x12, 0x8C, 0x59, 0x4C, 0x0A, 0x8D, 0x0D, 0x84, 0x00, 0x00,
+        0x00, 0x00, 0x16, 0x56, 0x36, 0x27, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_77_SHAKUHACHI_ALISIA_DRAGOON_IMAGE
+    = { { 0x2C, 0xC0, 0x34, 0x54, 0x72, 0x32, 0x20, 0x23, 0x06, 0x0B,
+        0x12, 0x12, 0x0F, 0x0E, 0x06, 0x06, 0x09, 0x8A, 0x02, 0x02,
+        0x00, 0x00, 0x27, 0x26, 0x78, 0x29, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_78_WHISTLE_ALADDIN_IMAGE
+    = { { 0x17, 0xD3, 0x31, 0x31, 0x01, 0x12, 0x08, 0x7F, 0x08, 0x7F,
+        0x12, 0x80, 0x8F, 0xC0, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x08, 0x48, 0x78, 0x08, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_79_OCARINA_IMAGE
+    = { { 0x34, 0xC0, 0x75, 0x32, 0x03, 0x01, 0x00, 0x29, 0x31, 0x00,
+        0x14, 0x94, 0x56, 0x4E, 0x0A, 0x0D, 0x0C, 0x84, 0x03, 0x00,
+        0x02, 0x00, 0x15, 0x45, 0x68, 0x17, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_80_LEADSQUARE_IMAGE
+    = { { 0x3C, 0xD0, 0x32, 0x02, 0x71, 0x01, 0x18, 0x1A, 0x09, 0x0D,
+        0x5F, 0x1A, 0x1C, 0x5B, 0x80, 0x80, 0x00, 0x80, 0x01, 0x00,
+        0x00, 0x00, 0x8B, 0x2A, 0x1A, 0x0F, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_81_LEADSAW_IMAGE
+    = { { 0x3C, 0xC0, 0x71, 0x31, 0x72, 0x32, 0x1C, 0x1C, 0x04, 0x04,
+        0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_82_LEADCALLIOPE_IMAGE
+    = { { 0x3C, 0xC5, 0x75, 0x32, 0x23, 0x61, 0x00, 0x18, 0x29, 0x05,
+        0x13, 0x8D, 0x99, 0x4E, 0x8A, 0x0D, 0x0D, 0x84, 0x00, 0x00,
+        0x00, 0x00, 0x15, 0x55, 0xD5, 0x2B, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_83_LEAD4CHIF_SONIC_IMAGE
+    = { { 0x3A, 0xC0, 0x01, 0x01, 0x07, 0x01, 0x14, 0x17, 0x2B, 0x04,
+        0x8E, 0x8E, 0x8F, 0x54, 0x0E, 0x0E, 0x0E, 0x03, 0x00, 0x00,
+        0x08, 0x08, 0x5F, 0xBF, 0x5F, 0xBF, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_84_LEAD5CHAR_NINEKO_IMAGE
+    = { { 0x38, 0xC0, 0x72, 0x71, 0x13, 0x11, 0x1E, 0x1E, 0x1E, 0x04,
+        0xD1, 0x14, 0x52, 0x14, 0x01, 0x01, 0x07, 0x01, 0x00, 0x00,
+        0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_85_LEADVOICE_IMAGE
+    = { { 0x0C, 0xE3, 0x12, 0x72, 0x71, 0x11, 0x1E, 0x12, 0x04, 0x0C,
+        0x8F, 0x50, 0x15, 0x13, 0x00, 0x8B, 0x00, 0x8F, 0x01, 0x1D,
+        0x00, 0x06, 0x0A, 0x8A, 0x0A, 0x2A, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_86_LEAD7FIFTS_ANIMATICS_IMAGE
+    = { { 0x3C, 0xC0, 0x34, 0x73, 0x74, 0x33, 0x18, 0x0E, 0x00, 0x0C,
+        0x5B, 0x58, 0x5B, 0x56, 0x05, 0x00, 0x05, 0x00, 0x03, 0x03,
+        0x03, 0x03, 0x07, 0x06, 0x07, 0x06, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_87_LEAD8BASS_GEMS_ANALOG_SOLO_IMAGE
+    = { { 0x04, 0xC1, 0x01, 0x01, 0x72, 0x61, 0x11, 0x1D, 0x06, 0x04,
+        0x53, 0x81, 0x1E, 0x1F, 0x8D, 0x93, 0x85, 0x07, 0x09, 0x02,
+        0x00, 0x00, 0x69, 0x08, 0x48, 0x08, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_88_PAD1NEWAGE_IMAGE
+    = { { 0x0C, 0xC0, 0x07, 0x31, 0x08, 0x01, 0x19, 0x21, 0x16, 0x00,
+        0x0F, 0x89, 0x1F, 0x0E, 0x0B, 0x02, 0x07, 0x05, 0x06, 0x00,
+        0x00, 0x00, 0x76, 0x23, 0xF5, 0x16, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_89_PAD_WARM_PORTED_FROM_DMX_IMAGE
+    = { { 0x07, 0xC0, 0x01, 0x31, 0x01, 0x31, 0x10, 0x10, 0x10, 0x10,
+        0xC7, 0x47, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x03, 0x04, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_90_POLYSYNTH_IMAGE
+    = { { 0x3C, 0xC0, 0x31, 0x50, 0x52, 0x30, 0x1A, 0x16, 0x03, 0x05,
+        0x52, 0x55, 0x51, 0x54, 0x08, 0x08, 0x00, 0x00, 0x04, 0x04,
+        0x00, 0x00, 0x16, 0x15, 0x06, 0x05, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_91_PADCHOIR_IMAGE
+    = { { 0x05, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x22, 0x11, 0x0C, 0x0E,
+        0x4E, 0x8A, 0x4C, 0x89, 0x80, 0x00, 0x80, 0x80, 0x00, 0x00,
+        0x00, 0x00, 0x52, 0x53, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_92_BOWED_IMAGE
+    = { { 0x1C, 0xC0, 0x06, 0x05, 0x01, 0x02, 0x1A, 0x23, 0x06, 0x1D,
+        0xCB, 0x0A, 0x89, 0x0A, 0x03, 0x09, 0x06, 0x06, 0x01, 0x00,
+        0x02, 0x00, 0x61, 0xF3, 0x73, 0xF4, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_93_METALLIC_IMAGE
+    = { { 0x3C, 0xC5, 0x31, 0x01, 0x09, 0x02, 0x1C, 0x16, 0x0E, 0x0B,
+        0xCB, 0x8B, 0x07, 0x07, 0x0B, 0x83, 0x03, 0x01, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0x11, 0xA5, 0xE5, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_94_PADHALO_IMAGE
+    = { { 0x2C, 0xC4, 0x21, 0x71, 0x01, 0x01, 0x0C, 0x00, 0x03, 0x16,
+        0x43, 0x43, 0x09, 0x0A, 0x04, 0x04, 0x87, 0x87, 0x00, 0x01,
+        0x00, 0x00, 0x55, 0x54, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_95_SWEEP_IMAGE
+    = { { 0x2C, 0xC5, 0x22, 0x75, 0x01, 0x02, 0x16, 0x18, 0x03, 0x13,
+        0x06, 0x04, 0x0F, 0x09, 0x06, 0x08, 0x87, 0x87, 0x00, 0x05,
+        0x00, 0x00, 0x54, 0x54, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_96_FX_RAIN_IMAGE
+    = { { 0x3E, 0xE2, 0x06, 0x32, 0x02, 0x71, 0x14, 0x11, 0x15, 0x11,
+        0x1F, 0x0C, 0x1F, 0x0C, 0x12, 0x80, 0x92, 0x80, 0x00, 0x00,
+        0x0D, 0x00, 0x37, 0x05, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_97_FXSNDTRACK_THUNDERFORCE_IV_IMAGE
+    = { { 0x2C, 0xC0, 0x33, 0x52, 0x53, 0x32, 0x1E, 0x1E, 0x09, 0x09,
+        0x06, 0x05, 0x11, 0x0A, 0x06, 0x06, 0x03, 0x03, 0x04, 0x04,
+        0x00, 0x00, 0xF4, 0xF5, 0x24, 0x25, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_98_FXCRYSTAL_ALISIA_DRAGOON_IMAGE
+    = { { 0x3C, 0xC0, 0x45, 0x04, 0x72, 0x32, 0x37, 0x2B, 0x0C, 0x0F,
+        0x1F, 0x1A, 0x1F, 0x18, 0x0D, 0x13, 0x08, 0x08, 0x04, 0x07,
+        0x07, 0x07, 0x76, 0x26, 0x68, 0x25, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_99_ATMOSPHERE_ALISIA_DRAGOON_IMAGE
+    = { { 0x34, 0xD3, 0x72, 0x11, 0x31, 0x51, 0x17, 0x31, 0x05, 0x10,
+        0x96, 0x16, 0x9F, 0x0D, 0x01, 0x04, 0x84, 0x89, 0x00, 0x05,
+        0x00, 0x06, 0x55, 0x06, 0x45, 0x56, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_100_BRIGHTNESS_IMAGE
+    = { { 0x03, 0xC0, 0x32, 0x55, 0x53, 0x32, 0x28, 0x27, 0x2B, 0x06,
+        0x92, 0x54, 0x5F, 0x5F, 0x81, 0x08, 0x00, 0x00, 0x04, 0x04,
+        0x00, 0x00, 0x51, 0x14, 0x06, 0x05, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_101_GOBLINS_IMAGE
+    = { { 0x2C, 0xC4, 0x21, 0x71, 0x01, 0x01, 0x12, 0x00, 0x13, 0x16,
+        0x04, 0x04, 0x43, 0x05, 0x06, 0x81, 0x87, 0x07, 0x00, 0x01,
+        0x00, 0x00, 0x53, 0x03, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_102_ECHOS_IMAGE
+    = { { 0x14, 0xC4, 0x32, 0x01, 0x02, 0x71, 0x29, 0x2D, 0x0C, 0x10,
+        0x50, 0x8B, 0x50, 0x94, 0x80, 0x00, 0x80, 0x80, 0x00, 0x00,
+        0x00, 0x00, 0x55, 0x55, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_103_SCIFI_IMAGE
+    = { { 0x18, 0xC4, 0x31, 0x23, 0x68, 0x01, 0x22, 0x22, 0x24, 0x08,
+        0x94, 0x9F, 0x9F, 0x13, 0x02, 0x03, 0x02, 0x81, 0x00, 0x00,
+        0x00, 0x00, 0x23, 0x43, 0x23, 0x25, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_104_SITAR_IMAGE
+    = { { 0x04, 0xC0, 0x02, 0x02, 0x07, 0x07, 0x2F, 0x08, 0x19, 0x0E,
+        0x5F, 0x92, 0x93, 0x1F, 0x07, 0x03, 0x03, 0x05, 0x05, 0x00,
+        0x00, 0x00, 0x44, 0xF3, 0xF6, 0xF6, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_105_BANJO_IMAGE
+    = { { 0x32, 0xC0, 0x36, 0x52, 0x21, 0x32, 0x19, 0x17, 0x45, 0x00,
+        0x4F, 0x5C, 0x5F, 0x13, 0x14, 0x09, 0x0F, 0x19, 0x08, 0x01,
+        0x17, 0x09, 0x19, 0x10, 0x18, 0x17, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_106_SHAMISEN_IMAGE
+    = { { 0x38, 0xC0, 0x05, 0x01, 0x02, 0x06, 0x1B, 0x18, 0x22, 0x0A,
+        0x9F, 0x5F, 0x9F, 0x5F, 0x0E, 0x05, 0x0E, 0x07, 0x00, 0x00,
+        0x00, 0x00, 0xF8, 0xE4, 0xE2, 0xF5, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_107_KOTO_IMAGE
+    = { { 0x24, 0xC3, 0x53, 0x13, 0x01, 0x03, 0x17, 0x1C, 0x07, 0x0E,
+        0x9B, 0x9B, 0x58, 0x18, 0x08, 0x88, 0x16, 0x16, 0x04, 0x08,
+        0x04, 0x08, 0x33, 0x32, 0x23, 0x15, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_108_KALIMBA_IMAGE
+    = { { 0x36, 0xC0, 0x74, 0x64, 0x71, 0x74, 0x17, 0x15, 0x07, 0x13,
+        0x54, 0x5E, 0x15, 0x15, 0x96, 0x0D, 0x80, 0x0C, 0x15, 0x07,
+        0x0A, 0x09, 0x77, 0x55, 0x06, 0x46, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_109_BAGPIPE_IMAGE
+    = { { 0x18, 0xD0, 0x01, 0x00, 0x04, 0x02, 0x0B, 0x1C, 0x27, 0x08,
+        0x90, 0x11, 0x0C, 0x8C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x36, 0x35, 0x0D, 0x0D, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_110_FIDDLE_IMAGE
+    = { { 0x3A, 0xE3, 0x31, 0x70, 0x37, 0x02, 0x1D, 0x37, 0x1F, 0x03,
+        0x0E, 0x0B, 0x0C, 0x8A, 0x04, 0x09, 0x10, 0x0A, 0x00, 0x03,
+        0x00, 0x00, 0x15, 0x07, 0x04, 0x15, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_111_SHANAI_ALADDIN_IMAGE
+    = { { 0x38, 0xD2, 0x01, 0x01, 0x01, 0x04, 0x27, 0x28, 0x1E, 0x00,
+        0x18, 0x16, 0x10, 0x18, 0x97, 0x1F, 0x9F, 0x1F, 0x00, 0x00,
+        0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_112_TINKLEBELL_IMAGE
+    = { { 0x07, 0xC0, 0x33, 0x32, 0x72, 0x73, 0x19, 0x11, 0x10, 0x0B,
+        0xD4, 0x14, 0xD6, 0x96, 0x04, 0x05, 0x03, 0x07, 0x04, 0x06,
+        0x08, 0x07, 0x03, 0x03, 0x53, 0xB3, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_113_AGOGO_IMAGE
+    = { { 0x3C, 0xC0, 0x06, 0x0B, 0x0E, 0x0E, 0x00, 0x00, 0x0E, 0x0E,
+        0x1F, 0x1F, 0x9F, 0x9F, 0x1F, 0x1F, 0x0E, 0x1F, 0x0E, 0x0E,
+        0x0E, 0x0F, 0x68, 0x48, 0xA7, 0x07, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_114_STEELDRUMS_IMAGE
+    = { { 0x0C, 0xF0, 0x1C, 0x35, 0x71, 0x71, 0x41, 0x22, 0x0C, 0x0C,
+        0x0D, 0x0D, 0x1A, 0x1A, 0x13, 0x10, 0x0C, 0x0E, 0x00, 0x07,
+        0x00, 0x00, 0x57, 0x87, 0xF6, 0xF6, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_115_WOODBLOCK_IMAGE
+    = { { 0x3C, 0xC0, 0x17, 0x1E, 0x15, 0x19, 0x14, 0x0A, 0x00, 0x05,
+        0x1F, 0xDF, 0x1F, 0xDF, 0x16, 0x19, 0x12, 0x14, 0x16, 0x0C,
+        0x1C, 0x0D, 0xC8, 0xE8, 0xB8, 0x18, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_116_TAIKO_DRUM_IMAGE
+    = { { 0x1E, 0xC0, 0x00, 0x00, 0x01, 0x00, 0x06, 0x0C, 0x04, 0x03,
+        0x9F, 0x1F, 0x9F, 0x1F, 0x12, 0x10, 0x10, 0x08, 0x12, 0x10,
+        0x10, 0x0C, 0x08, 0x07, 0x0B, 0x95, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_117_MELODIC_TOM_IMAGE
+    = { { 0x31, 0xC0, 0x02, 0x00, 0x00, 0x00, 0x10, 0x23, 0x02, 0x00,
+        0x1F, 0x1E, 0x1F, 0x1E, 0x00, 0x00, 0x02, 0x00, 0x0D, 0x14,
+        0x12, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_118_SYNDRUM_ALISIA_DRAGOON_IMAGE
+    = { { 0x3B, 0xC0, 0x01, 0x02, 0x01, 0x01, 0x06, 0x0D, 0x08, 0x00,
+        0x1D, 0x5F, 0x1F, 0x1F, 0x12, 0x1B, 0x1A, 0x0E, 0x00, 0x08,
+        0x16, 0x11, 0x56, 0x56, 0x26, 0xC6, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_119_REVERSE_CYMBELL_IMAGE
+    = { { 0x3C, 0xD0, 0x7F, 0x7F, 0x13, 0x00, 0x00, 0x00, 0x09, 0x1D,
+        0x1D, 0x1F, 0x44, 0x84, 0x01, 0x00, 0x8D, 0x1B, 0x00, 0x00,
+        0x16, 0x06, 0x80, 0x14, 0x09, 0xA6, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_120_GUITAR_FRET_NOISE_IMAGE
+    = { { 0x3C, 0xD0, 0x76, 0x73, 0x13, 0x04, 0x0E, 0x21, 0x11, 0x20,
+        0x1B, 0x1F, 0x4E, 0x8C, 0x01, 0x00, 0x87, 0x0E, 0x00, 0x00,
+        0x0E, 0x09, 0x80, 0x14, 0x09, 0xA6, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_121_BREATH_NOISE_IMAGE
+    = { { 0x3C, 0xC0, 0x34, 0x54, 0x72, 0x32, 0x00, 0x08, 0x0B, 0x18,
+        0x1F, 0x1F, 0x0C, 0x0C, 0x00, 0x00, 0x0C, 0x89, 0x00, 0x00,
+        0x07, 0x09, 0x22, 0x22, 0xB7, 0x76, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_122_SEASHORE_IMAGE
+    = { { 0x3D, 0xC0, 0x33, 0x01, 0x01, 0x01, 0x00, 0x16, 0x1A, 0x1C,
+        0x1F, 0x06, 0x06, 0x07, 0x00, 0x08, 0x08, 0x08, 0x00, 0x00,
+        0x00, 0x00, 0xF0, 0xF4, 0xF4, 0xF4, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_123_BIRDTWEET_IMAGE
+    = { { 0x1F, 0xC0, 0x07, 0x15, 0x08, 0x06, 0x19, 0x11, 0x10, 0x00,
+        0xC6, 0x0F, 0xC8, 0x8B, 0x10, 0x0D, 0x0E, 0x0E, 0x0E, 0x0E,
+        0x10, 0x10, 0x07, 0x0A, 0x56, 0xB6, 0x08, 0x00, 0x08, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_124_TELEPHONE_IMAGE
+    = { { 0x3C, 0xC0, 0x3B, 0x00, 0x3D, 0x06, 0x20, 0x32, 0x00, 0x00,
+        0x1F, 0x1F, 0x50, 0x16, 0x02, 0x02, 0x11, 0x13, 0x00, 0x00,
+        0x00, 0x00, 0xF8, 0xF8, 0xF5, 0xF6, 0x00, 0x00, 0x0E, 0x0E } };
+static const FmPresetImage M_BANK_0_INST_125_HELICOPTER_IMAGE
+    = { { 0x34, 0xF0, 0x30, 0x00, 0x02, 0x00, 0x00, 0x7F, 0x14, 0x7F,
+        0x45, 0x05, 0x07, 0x07, 0x01, 0x8D, 0x82, 0x8F, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x09, 0x15, 0x04, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_126_APPLAUSE_IMAGE
+    = { { 0x3D, 0xC0, 0x33, 0x01, 0x11, 0x01, 0x04, 0x16, 0x17, 0x15,
+        0x1F, 0x06, 0x06, 0x06, 0x00, 0x0D, 0x07, 0x0F, 0x00, 0x00,
+        0x00, 0x00, 0xF0, 0x09, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_0_INST_127_GUNSHOT_IMAGE
+    = { { 0x3D, 0xC5, 0x11, 0x11, 0x11, 0x11, 0x01, 0x01, 0x01, 0x01,
+        0x41, 0x41, 0x41, 0x41, 0x81, 0x81, 0x81, 0x81, 0x01, 0x01,
+        0x01, 0x01, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_8_INST_4_DETUNEDEP1_IMAGE
+    = { { 0x34, 0xC0, 0x4C, 0x41, 0x31, 0x71, 0x39, 0x22, 0x09, 0x09,
+        0x5F, 0x96, 0x9F, 0x9F, 0x07, 0x05, 0x84, 0x84, 0x00, 0x00,
+        0x04, 0x04, 0xB8, 0xB8, 0x18, 0x68, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_8_INST_16_DETUNEDORGAN1_IMAGE
+    = { { 0x27, 0xC0, 0x34, 0x11, 0x70, 0x22, 0x11, 0x0F, 0x17, 0x17,
+        0x5C, 0x5C, 0x5C, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04,
+        0x1B, 0x04, 0xFA, 0xF8, 0xF8, 0xFA, 0x00, 0x00, 0x00, 0x00 } };
+static const FmPresetImage M_BANK_8_INST_38_SYNBASS3_IMAGE
+    = { { 0x3D, 0xC0, 0x44, 0x02, 0x14, 0x33, 0x12, 0x05, 0x00, 0x18,
+        0x55, 0x54, 0x59, 0x54, 0x1E, 0x1E, 0x1E, 0x1E, 0x0D, 0x09,
+        0x0A, 0x05, 0x0B, 0x0C, 0x0C, 0x8C, 0x00, 0x00, 0x00, 0x00 } };
+
+const FmPresetImage* M_BANK_0_IMAGES[128] = {
+    &M_BANK_0_INST_0_GRANDPIANO_IMAGE,
+    &M_BANK_0_INST_1_BRIGHTPIANO_IMAGE,
+    &M_BANK_0_INST_2_ELECTRICPIANO_ANIMATICS_IMAGE,
+    &M_BANK_0_INST_3_HONKYTONK_SONICMODDED_IMAGE,
+    &M_BANK_0_INST_4_RHODESPIANO_IMAGE,
+    &M_BANK_0_INST_5_CHORUSPIANOTINITOON_IMAGE,
+    &M_BANK_0_INST_6_HARPSICHORD_ADAMS_IMAGE,
+    &M_BANK_0_INST_7_CLAVINET_IMAGE,
+    &M_BANK_0_INST_8_CELESTA_IMAGE,
+    &M_BANK_0_INST_9_GLOCKENSPIEL_IMAGE,
+    &M_BANK_0_INST_10_MUSICBOX_IMAGE,
+    &M_BANK_0_INST_11_VIBRAPHONE_NINEKO_IMAGE,
+    &M_BANK_0_INST_12_MARIMBA_ALADDIN_IMAGE,
+    &M_BANK_0_INST_13_XYLAPHONE_ALADDIN_IMAGE,
+    &M_BANK_0_INST_14_TUBULARBELLS_ANIMATICS_IMAGE,
+    &M_BANK_0_INST_15_DULCIMER_IMAGE,
+    &M_BANK_0_INST_16_HAMMOND_NINEKO_IMAGE,
+    &M_BANK_0_INST_17_PERCUSIVEORGAIN_ACTION52_IMAGE,
+    &M_BANK_0_INST_18_ROCKORGAN_IMAGE,
+    &M_BANK_0_INST_19_CHURCHORGAN_IMAGE,
+    &M_BANK_0_INST_20_REEDORGAN_IMAGE,
+    &M_BANK_0_INST_21_ACCORDEON_IMAGE,
+    &M_BANK_0_INST_22_HARMONICA_SONIC_IMAGE,
+    &M_BANK_0_INST_23_TANGO_ACCORDION_IMAGE,
+    &M_BANK_0_INST_24_NYLONGUITARHELLROLL_IMAGE,
+    &M_BANK_0_INST_25_STEELGUITARHELLROLL_IMAGE,
+    &M_BANK_0_INST_26_JAZZGUITAR_IMAGE,
+    &M_BANK_0_INST_27_CLEANGUITAR_COLUMNS_III_IMAGE,
+    &M_BANK_0_INST_28_MUTEDGUITAR_ALADDIN_IMAGE,
+    &M_BANK_0_INST_29_OVERDRIVE_OPL3_IMAGE,
+    &M_BANK_0_INST_30_DISTORTION_OPL3_IMAGE,
+    &M_BANK_0_INST_31_GUITAR_HARMONICSHELLFIRE_IMAGE,
+    &M_BANK_0_INST_32_ACOUSTICBASS_SONIC_IMAGE,
+    &M_BANK_0_INST_33_FINGERBASS_SONIC_IMAGE,
+    &M_BANK_0_INST_34_PICKBASS_IMAGE,
+    &M_BANK_0_INST_35_FRETLESSBASSALADDIN_IMAGE,
+    &M_BANK_0_INST_36_SLAPBASS1_IMAGE,
+    &M_BANK_0_INST_37_SLAPBASS2_IMAGE,
+    &M_BANK_0_INST_38_SYNBASS1_DYNABROS_IMAGE,
+    &M_BANK_0_INST_39_SYNBASS2_NINEKO_IMAGE,
+    &M_BANK_0_INST_40_VIOLIN_IMAGE,
+    &M_BANK_0_INST_41_VIOLA_IMAGE,
+    &M_BANK_0_INST_42_CELLO_IMAGE,
+    &M_BANK_0_INST_43_CONTROLBASS_IMAGE,
+    &M_BANK_0_INST_44_TREMOLOSTRINGS_IMAGE,
+    &M_BANK_0_INST_45_PIZZIKATOSTRINGS_IMAGE,
+    &M_BANK_0_INST_46_ORCHESTRALHARP_IMAGE,
+    &M_BANK_0_INST_47_TIMPANY_IMAGE,
+    &M_BANK_0_INST_48_STRINGESSEMBLE1_IMAGE,
+    &M_BANK_0_INST_49_STRINGESSEMBLE2_IMAGE,
+    &M_BANK_0_INST_50_SYNSTRINGS_1_IMAGE,
+    &M_BANK_0_INST_51_SYNSTRING2_ALADDIN_IMAGE,
+    &M_BANK_0_INST_52_CHOIR_AAHS_IMAGE,
+    &M_BANK_0_INST_53_VOICE_IMAGE,
+    &M_BANK_0_INST_54_SYNTHVOICE_IMAGE,
+    &M_BANK_0_INST_55_ORCHESTRAHIT_IMAGE,
+    &M_BANK_0_INST_56_TRUMPET_SONIC_IMAGE,
+    &M_BANK_0_INST_57_TROMBONE_ALADDIN_IMAGE,
+    &M_BANK_0_INST_58_TUBA_ALADDIN_IMAGE,
+    &M_BANK_0_INST_59_MUTEDTRUMPET_SONIC_IMAGE,
+    &M_BANK_0_INST_60_FRENCHHORN_IMAGE,
+    &M_BANK_0_INST_61_BRASSSECTION_GREENDOG_IMAGE,
+    &M_BANK_0_INST_62_SYNBRASS1_IMAGE,
+    &M_BANK_0_INST_63_SYNBRASS2_IMAGE,
+    &M_BANK_0_INST_64_SOPRANOSAX_IMAGE,
+    &M_BANK_0_INST_65_ALTOSAX_IMAGE,
+    &M_BANK_0_INST_66_TENORSAX_IMAGE,
+    &M_BANK_0_INST_67_BARITONESAX_IMAGE,
+    &M_BANK_0_INST_68_OBOE_ALADDIN_IMAGE,
+    &M_BANK_0_INST_69_ENGLISHHORN_IMAGE,
+    &M_BANK_0_INST_70_BASSOON_ALADDIN_IMAGE,
+    &M_BANK_0_INST_71_CLARINET_ALADDIN_IMAGE,
+    &M_BANK_0_INST_72_PICCOLO_ALADDIN_IMAGE,
+    &M_BANK_0_INST_73_FLUTE_IMAGE,
+    &M_BANK_0_INST_74_RECORDER_IMAGE,
+    &M_BANK_0_INST_75_PANFLUTE_IMAGE,
+    &M_BANK_0_INST_76_BOTTLEBLOW_IMAGE,
+    &M_BANK_0_INST_77_SHAKUHACHI_ALISIA_DRAGOON_IMAGE,
+    &M_BANK_0_INST_78_WHISTLE_ALADDIN_IMAGE,
+    &M_BANK_0_INST_79_OCARINA_IMAGE,
+    &M_BANK_0_INST_80_LEADSQUARE_IMAGE,
+    &M_BANK_0_INST_81_LEADSAW_IMAGE,
+    &M_BANK_0_INST_82_LEADCALLIOPE_IMAGE,
+    &M_BANK_0_INST_83_LEAD4CHIF_SONIC_IMAGE,
+    &M_BANK_0_INST_84_LEAD5CHAR_NINEKO_IMAGE,
+    &M_BANK_0_INST_85_LEADVOICE_IMAGE,
+    &M_BANK_0_INST_86_LEAD7FIFTS_ANIMATICS_IMAGE,
+    &M_BANK_0_INST_87_LEAD8BASS_GEMS_ANALOG_SOLO_IMAGE,
+    &M_BANK_0_INST_88_PAD1NEWAGE_IMAGE,
+    &M_BANK_0_INST_89_PAD_WARM_PORTED_FROM_DMX_IMAGE,
+    &M_BANK_0_INST_90_POLYSYNTH_IMAGE,
+    &M_BANK_0_INST_91_PADCHOIR_IMAGE,
+    &M_BANK_0_INST_92_BOWED_IMAGE,
+    &M_BANK_0_INST_93_METALLIC_IMAGE,
+    &M_BANK_0_INST_94_PADHALO_IMAGE,
+    &M_BANK_0_INST_95_SWEEP_IMAGE,
+    &M_BANK_0_INST_96_FX_RAIN_IMAGE,
+    &M_BANK_0_INST_97_FXSNDTRACK_THUNDERFORCE_IV_IMAGE,
+    &M_BANK_0_INST_98_FXCRYSTAL_ALISIA_DRAGOON_IMAGE,
+    &M_BANK_0_INST_99_ATMOSPHERE_ALISIA_DRAGOON_IMAGE,
+    &M_BANK_0_INST_100_BRIGHTNESS_IMAGE,
+    &M_BANK_0_INST_101_GOBLINS_IMAGE,
+    &M_BANK_0_INST_102_ECHOS_IMAGE,
+    &M_BANK_0_INST_103_SCIFI_IMAGE,
+    &M_BANK_0_INST_104_SITAR_IMAGE,
+    &M_BANK_0_INST_105_BANJO_IMAGE,
+    &M_BANK_0_INST_106_SHAMISEN_IMAGE,
+    &M_BANK_0_INST_107_KOTO_IMAGE,
+    &M_BANK_0_INST_108_KALIMBA_IMAGE,
+    &M_BANK_0_INST_109_BAGPIPE_IMAGE,
+    &M_BANK_0_INST_110_FIDDLE_IMAGE,
+    &M_BANK_0_INST_111_SHANAI_ALADDIN_IMAGE,
+    &M_BANK_0_INST_112_TINKLEBELL_IMAGE,
+    &M_BANK_0_INST_113_AGOGO_IMAGE,
+    &M_BANK_0_INST_114_STEELDRUMS_IMAGE,
+    &M_BANK_0_INST_115_WOODBLOCK_IMAGE,
+    &M_BANK_0_INST_116_TAIKO_DRUM_IMAGE,
+    &M_BANK_0_INST_117_MELODIC_TOM_IMAGE,
+    &M_BANK_0_INST_118_SYNDRUM_ALISIA_DRAGOON_IMAGE,
+    &M_BANK_0_INST_119_REVERSE_CYMBELL_IMAGE,
+    &M_BANK_0_INST_120_GUITAR_FRET_NOISE_IMAGE,
+    &M_BANK_0_INST_121_BREATH_NOISE_IMAGE,
+    &M_BANK_0_INST_122_SEASHORE_IMAGE,
+    &M_BANK_0_INST_123_BIRDTWEET_IMAGE,
+    &M_BANK_0_INST_124_TELEPHONE_IMAGE,
+    &M_BANK_0_INST_125_HELICOPTER_IMAGE,
+    &M_BANK_0_INST_126_APPLAUSE_IMAGE,
+    &M_BANK_0_INST_127_GUNSHOT_IMAGE,
+};
+
+const FmPresetImage* M_BANK_8_IMAGES[128] = {
+    &M_BANK_0_INST_0_GRANDPIANO_IMAGE,
+    &M_BANK_0_INST_1_BRIGHTPIANO_IMAGE,
+    &M_BANK_0_INST_2_ELECTRICPIANO_ANIMATICS_IMAGE,
+    &M_BANK_0_INST_3_HONKYTONK_SONICMODDED_IMAGE,
+    &M_BANK_8_INST_4_DETUNEDEP1_IMAGE,
+    &M_BANK_0_INST_5_CHORUSPIANOTINITOON_IMAGE,
+    &M_BANK_0_INST_6_HARPSICHORD_ADAMS_IMAGE,
+    &M_BANK_0_INST_7_CLAVINET_IMAGE,
+    &M_BANK_0_INST_8_CELESTA_IMAGE,
+    &M_BANK_0_INST_9_GLOCKENSPIEL_IMAGE,
+    &M_BANK_0_INST_10_MUSICBOX_IMAGE,
+    &M_BANK_0_INST_11_VIBRAPHONE_NINEKO_IMAGE,
+    &M_BANK_0_INST_12_MARIMBA_ALADDIN_IMAGE,
+    &M_BANK_0_INST_13_XYLAPHONE_ALADDIN_IMAGE,
+    &M_BANK_0_INST_14_TUBULARBELLS_ANIMATICS_IMAGE,
+    &M_BANK_0_INST_15_DULCIMER_IMAGE,
+    &M_BANK_8_INST_16_DETUNEDORGAN1_IMAGE,
+    &M_BANK_0_INST_17_PERCUSIVEORGAIN_ACTION52_IMAGE,
+    &M_BANK_0_INST_18_ROCKORGAN_IMAGE,
+    &M_BANK_0_INST_19_CHURCHORGAN_IMAGE,
+    &M_BANK_0_INST_20_REEDORGAN_IMAGE,
+    &M_BANK_0_INST_21_ACCORDEON_IMAGE,
+    &M_BANK_0_INST_22_HARMONICA_SONIC_IMAGE,
+    &M_BANK_0_INST_23_TANGO_ACCORDION_IMAGE,
+    &M_BANK_0_INST_24_NYLONGUITARHELLROLL_IMAGE,
+    &M_BANK_0_INST_25_STEELGUITARHELLROLL_IMAGE,
+    &M_BANK_0_INST_26_JAZZGUITAR_IMAGE,
+    &M_BANK_0_INST_27_CLEANGUITAR_COLUMNS_III_IMAGE,
+    &M_BANK_0_INST_28_MUTEDGUITAR_ALADDIN_IMAGE,
+    &M_BANK_0_INST_29_OVERDRIVE_OPL3_IMAGE,
+    &M_BANK_0_INST_30_DISTORTION_OPL3_IMAGE,
+    &M_BANK_0_INST_31_GUITAR_HARMONICSHELLFIRE_IMAGE,
+    &M_BANK_0_INST_32_ACOUSTICBASS_SONIC_IMAGE,
+    &M_BANK_0_INST_33_FINGERBASS_SONIC_IMAGE,
+    &M_BANK_0_INST_34_PICKBASS_IMAGE,
+    &M_BANK_0_INST_35_FRETLESSBASSALADDIN_IMAGE,
+    &M_BANK_0_INST_36_SLAPBASS1_IMAGE,
+    &M_BANK_0_INST_37_SLAPBASS2_IMAGE,
+    &M_BANK_8_INST_38_SYNBASS3_IMAGE,
+    &M_BANK_0_INST_39_SYNBASS2_NINEKO_IMAGE,
+    &M_BANK_0_INST_40_VIOLIN_IMAGE,
+    &M_BANK_0_INST_41_VIOLA_IMAGE,
+    &M_BANK_0_INST_42_CELLO_IMAGE,
+    &M_BANK_0_INST_43_CONTROLBASS_IMAGE,
+    &M_BANK_0_INST_44_TREMOLOSTRINGS_IMAGE,
+    &M_BANK_0_INST_45_PIZZIKATOSTRINGS_IMAGE,
+    &M_BANK_0_INST_46_ORCHESTRALHARP_IMAGE,
+    &M_BANK_0_INST_47_TIMPANY_IMAGE,
+    &M_BANK_0_INST_48_STRINGESSEMBLE1_IMAGE,
+    &M_BANK_0_INST_49_STRINGESSEMBLE2_IMAGE,
+    &M_BANK_0_INST_50_SYNSTRINGS_1_IMAGE,
+    &M_BANK_0_INST_51_SYNSTRING2_ALADDIN_IMAGE,
+    &M_BANK_0_INST_52_CHOIR_AAHS_IMAGE,
+    &M_BANK_0_INST_53_VOICE_IMAGE,
+    &M_BANK_0_INST_54_SYNTHVOICE_IMAGE,
+    &M_BANK_0_INST_55_ORCHESTRAHIT_IMAGE,
+    &M_BANK_0_INST_56_TRUMPET_SONIC_IMAGE,
+    &M_BANK_0_INST_57_TROMBONE_ALADDIN_IMAGE,
+    &M_BANK_0_INST_58_TUBA_ALADDIN_IMAGE,
+    &M_BANK_0_INST_59_MUTEDTRUMPET_SONIC_IMAGE,
+    &M_BANK_0_INST_60_FRENCHHORN_IMAGE,
+    &M_BANK_0_INST_61_BRASSSECTION_GREENDOG_IMAGE,
+    &M_BANK_0_INST_62_SYNBRASS1_IMAGE,
+    &M_BANK_0_INST_63_SYNBRASS2_IMAGE,
+    &M_BANK_0_INST_64_SOPRANOSAX_IMAGE,
+    &M_BANK_0_INST_65_ALTOSAX_IMAGE,
+    &M_BANK_0_INST_66_TENORSAX_IMAGE,
+    &M_BANK_0_INST_67_BARITONESAX_IMAGE,
+    &M_BANK_0_INST_68_OBOE_ALADDIN_IMAGE,
+    &M_BANK_0_INST_69_ENGLISHHORN_IMAGE,
+    &M_BANK_0_INST_70_BASSOON_ALADDIN_IMAGE,
+    &M_BANK_0_INST_71_CLARINET_ALADDIN_IMAGE,
+    &M_BANK_0_INST_72_PICCOLO_ALADDIN_IMAGE,
+    &M_BANK_0_INST_73_FLUTE_IMAGE,
+    &M_BANK_0_INST_74_RECORDER_IMAGE,
+    &M_BANK_0_INST_75_PANFLUTE_IMAGE,
+    &M_BANK_0_INST_76_BOTTLEBLOW_IMAGE,
+    &M_BANK_0_INST_77_SHAKUHACHI_ALISIA_DRAGOON_IMAGE,
+    &M_BANK_0_INST_78_WHISTLE_ALADDIN_IMAGE,
+    &M_BANK_0_INST_79_OCARINA_IMAGE,
+    &M_BANK_0_INST_80_LEADSQUARE_IMAGE,
+    &M_BANK_0_INST_81_LEADSAW_IMAGE,
+    &M_BANK_0_INST_82_LEADCALLIOPE_IMAGE,
+    &M_BANK_0_INST_83_LEAD4CHIF_SONIC_IMAGE,
+    &M_BANK_0_INST_84_LEAD5CHAR_NINEKO_IMAGE,
+    &M_BANK_0_INST_85_LEADVOICE_IMAGE,
+    &M_BANK_0_INST_86_LEAD7FIFTS_ANIMATICS_IMAGE,
+    &M_BANK_0_INST_87_LEAD8BASS_GEMS_ANALOG_SOLO_IMAGE,
+    &M_BANK_0_INST_88_PAD1NEWAGE_IMAGE,
+    &M_BANK_0_INST_89_PAD_WARM_PORTED_FROM_DMX_IMAGE,
+    &M_BANK_0_INST_90_POLYSYNTH_IMAGE,
+    &M_BANK_0_INST_91_PADCHOIR_IMAGE,
+    &M_BANK_0_INST_92_BOWED_IMAGE,
+    &M_BANK_0_INST_93_METALLIC_IMAGE,
+    &M_BANK_0_INST_94_PADHALO_IMAGE,
+    &M_BANK_0_INST_95_SWEEP_IMAGE,
+    &M_BANK_0_INST_96_FX_RAIN_IMAGE,
+    &M_BANK_0_INST_97_FXSNDTRACK_THUNDERFORCE_IV_IMAGE,
+    &M_BANK_0_INST_98_FXCRYSTAL_ALISIA_DRAGOON_IMAGE,
+    &M_BANK_0_INST_99_ATMOSPHERE_ALISIA_DRAGOON_IMAGE,
+    &M_BANK_0_INST_100_BRIGHTNESS_IMAGE,
+    &M_BANK_0_INST_101_GOBLINS_IMAGE,
+    &M_BANK_0_INST_102_ECHOS_IMAGE,
+    &M_BANK_0_INST_103_SCIFI_IMAGE,
+    &M_BANK_0_INST_104_SITAR_IMAGE,
+    &M_BANK_0_INST_105_BANJO_IMAGE,
+    &M_BANK_0_INST_106_SHAMISEN_IMAGE,
+    &M_BANK_0_INST_107_KOTO_IMAGE,
+    &M_BANK_0_INST_108_KALIMBA_IMAGE,
+    &M_BANK_0_INST_109_BAGPIPE_IMAGE,
+    &M_BANK_0_INST_110_FIDDLE_IMAGE,
+    &M_BANK_0_INST_111_SHANAI_ALADDIN_IMAGE,
+    &M_BANK_0_INST_112_TINKLEBELL_IMAGE,
+    &M_BANK_0_INST_113_AGOGO_IMAGE,
+    &M_BANK_0_INST_114_STEELDRUMS_IMAGE,
+    &M_BANK_0_INST_115_WOODBLOCK_IMAGE,
+    &M_BANK_0_INST_116_TAIKO_DRUM_IMAGE,
+    &M_BANK_0_INST_117_MELODIC_TOM_IMAGE,
+    &M_BANK_0_INST_118_SYNDRUM_ALISIA_DRAGOON_IMAGE,
+    &M_BANK_0_INST_119_REVERSE_CYMBELL_IMAGE,
+    &M_BANK_0_INST_120_GUITAR_FRET_NOISE_IMAGE,
+    &M_BANK_0_INST_121_BREATH_NOISE_IMAGE,
+    &M_BANK_0_INST_122_SEASHORE_IMAGE,
+    &M_BANK_0_INST_123_BIRDTWEET_IMAGE,
+    &M_BANK_0_INST_124_TELEPHONE_IMAGE,
+    &M_BANK_0_INST_125_HELICOPTER_IMAGE,
+    &M_BANK_0_INST_126_APPLAUSE_IMAGE,
+    &M_BANK_0_INST_127_GUNSHOT_IMAGE,
+};
+
+const FmPresetImage** M_BANKS[128] = {
+    [0] = M_BANK_0_IMAGES,
+    [8] = M_BANK_8_IMAGES,
+};
+
+const PercussionPresetImage P_BANK_0_IMAGES[128] = {
+    /* 0 P_BANK_0_INST_0 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 1 P_BANK_0_INST_1 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 2 P_BANK_0_INST_2 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 3 P_BANK_0_INST_3 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 4 P_BANK_0_INST_4 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 5 P_BANK_0_INST_5 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 6 P_BANK_0_INST_6 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 7 P_BANK_0_INST_7 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 8 P_BANK_0_INST_8 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 9 P_BANK_0_INST_9 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 10 P_BANK_0_INST_10 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 11 P_BANK_0_INST_11 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 12 P_BANK_0_INST_12 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 13 P_BANK_0_INST_13 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 14 P_BANK_0_INST_14 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 15 P_BANK_0_INST_15 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 16 P_BANK_0_INST_16 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 17 P_BANK_0_INST_17 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 18 P_BANK_0_INST_18 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 19 P_BANK_0_INST_19 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 20 P_BANK_0_INST_20 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 21 P_BANK_0_INST_21 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 22 P_BANK_0_INST_22 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 23 P_BANK_0_INST_23 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 24 P_BANK_0_INST_24 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 25 P_BANK_0_INST_25 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 26 P_BANK_0_INST_26 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 27 P_BANK_0_INST_27 */
+    { { { 0x0C, 0xC0, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01,
+        0x12, 0x12, 0x5F, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x1D,
+        0x10, 0x10, 0x0C, 0x0C, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00 } },
+        30 },
+    /* 28 P_BANK_0_INST_28 */
+    { { { 0x3D, 0xC5, 0x33, 0x01, 0x01, 0x01, 0x04, 0x00, 0x00, 0x00,
+        0xDF, 0xDF, 0x9F, 0x9F, 0x06, 0x12, 0x10, 0x10, 0x10, 0x0E,
+        0x1F, 0x0E, 0xF3, 0xF9, 0xF8, 0x76, 0x00, 0x00, 0x00, 0x00 } },
+        49 },
+    /* 29 P_BANK_0_INST_29 */
+    { { { 0x3C, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x08, 0x7F, 0x00, 0x7F,
+        0x1F, 0x00, 0x0F, 0x00, 0x0B, 0x80, 0x8E, 0x00, 0x0A, 0x00,
+        0x10, 0x00, 0x06, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        59 },
+    /* 30 P_BANK_0_INST_30_CASTANETS */
+    { { { 0x1C, 0xC0, 0x09, 0x01, 0x04, 0x02, 0x17, 0x0F, 0x0D, 0x0D,
+        0x1F, 0x1F, 0x9F, 0x9F, 0x0B, 0x13, 0x14, 0x14, 0x00, 0x00,
+        0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00 } },
+        62 },
+    /* 31 P_BANK_0_INST_31_STICKS */
+    { { { 0x18, 0xC0, 0x02, 0x02, 0x02, 0x01, 0x0A, 0x17, 0x2A, 0x00,
+        0x1F, 0x1F, 0x9F, 0x1F, 0x14, 0x12, 0x14, 0x15, 0x00, 0x00,
+        0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00 } },
+        54 },
+    /* 32 P_BANK_0_INST_32_SQUARE_CLICK */
+    { { { 0x1F, 0xC0, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00, 0x27, 0x00,
+        0x1F, 0x1F, 0x9F, 0x12, 0x17, 0x16, 0x17, 0x18, 0x00, 0x00,
+        0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00 } },
+        75 },
+    /* 33 P_BANK_0_INST_33_METRONOMECLICK */
+    { { { 0x18, 0xC0, 0x02, 0x01, 0x02, 0x01, 0x06, 0x05, 0x21, 0x00,
+        0x1F, 0x1F, 0x9F, 0x1F, 0x12, 0x13, 0x16, 0x15, 0x00, 0x00,
+        0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00 } },
+        43 },
+    /* 34 P_BANK_0_INST_34 */
+    { { { 0x3D, 0xC5, 0x33, 0x01, 0x01, 0x01, 0x04, 0x00, 0x00, 0x00,
+        0xDF, 0xDF, 0x9F, 0x9F, 0x06, 0x12, 0x10, 0x10, 0x10, 0x0E,
+        0x1F, 0x0F, 0xF3, 0xF9, 0xF8, 0x78, 0x00, 0x00, 0x00, 0x00 } },
+        46 },
+    /* 35 P_BANK_0_INST_35_BASSDRUM_ */
+    { { { 0x22, 0xC0, 0x00, 0x05, 0x06, 0x01, 0x00, 0x7F, 0x7F, 0x00,
+        0x1B, 0x00, 0x00, 0x5F, 0x00, 0x0B, 0x0F, 0x00, 0x14, 0x0F,
+        0x0C, 0x0E, 0x07, 0xF5, 0xF6, 0x07, 0x00, 0x00, 0x00, 0x00 } },
+        35 },
+    /* 36 P_BANK_0_INST_36_BASSDRUM_ */
+    { { { 0x1A, 0xC0, 0x00, 0x05, 0x06, 0x01, 0x00, 0x7F, 0x7F, 0x00,
+        0x1A, 0x00, 0x00, 0x5F, 0x00, 0x0B, 0x0F, 0x00, 0x14, 0x0F,
+        0x0D, 0x0C, 0x07, 0xF4, 0xF6, 0x07, 0x00, 0x00, 0x00, 0x00 } },
+        35 },
+    /* 37 P_BANK_0_INST_37_STICKSIDE */
+    { { { 0x18, 0xC0, 0x02, 0x01, 0x02, 0x01, 0x15, 0x0E, 0x21, 0x00,
+        0x1F, 0x1F, 0x9F, 0x1F, 0x13, 0x13, 0x14, 0x14, 0x00, 0x00,
+        0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00 } },
+        44 },
+    /* 38 P_BANK_0_INST_38_ACUSTICSNARE_ACTION52 */
+    { { { 0x35, 0xC5, 0x33, 0x01, 0x01, 0x01, 0x04, 0x00, 0x00, 0x00,
+        0xDF, 0xDF, 0x9F, 0x9F, 0x06, 0x12, 0x10, 0x10, 0x10, 0x0E,
+        0x1F, 0x0D, 0xF3, 0xF9, 0xF8, 0x76, 0x00, 0x00, 0x00, 0x00 } },
+        39 },
+    /* 39 P_BANK_0_INST_39_HANDCLAP_OPL3 */
+    { { { 0x3C, 0xC0, 0x0F, 0x00, 0x0F, 0x01, 0x0D, 0x03, 0x1B, 0x00,
+        0x9F, 0x1F, 0x1F, 0x1F, 0x00, 0x14, 0x11, 0x03, 0x00, 0x10,
+        0x0F, 0x12, 0x05, 0x08, 0x27, 0x09, 0x00, 0x00, 0x00, 0x00 } },
+        58 },
+    /* 40 P_BANK_0_INST_40_ACUSTICSNARE_ACTION52 */
+    { { { 0x35, 0xC5, 0x33, 0x01, 0x01, 0x01, 0x04, 0x00, 0x00, 0x00,
+        0xDF, 0xDF, 0x9F, 0x9F, 0x05, 0x14, 0x10, 0x10, 0x0F, 0x0E,
+        0x1F, 0x0C, 0xF3, 0xF9, 0xF7, 0x76, 0x00, 0x00, 0x00, 0x00 } },
+        39 },
+    /* 41 P_BANK_0_INST_41_LOW_FLOOR_TOM */
+    { { { 0x3D, 0xC0, 0x31, 0x13, 0x70, 0x10, 0x15, 0x03, 0x00, 0x03,
+        0x1E, 0x5E, 0x1E, 0x1E, 0x1A, 0x0C, 0x11, 0x11, 0x03, 0x01,
+        0x03, 0x03, 0xF6, 0xF6, 0xF6, 0xF6, 0x00, 0x00, 0x00, 0x00 } },
+        20 },
+    /* 42 P_BANK_0_INST_42_CLOSED_HAT */
+    { { { 0x3A, 0xF3, 0x3F, 0x33, 0x7F, 0x71, 0x19, 0x00, 0x14, 0x00,
+        0x1F, 0x5F, 0x1F, 0xDF, 0x8E, 0x0A, 0x8E, 0x09, 0x0D, 0x08,
+        0x0D, 0x09, 0x84, 0x64, 0x94, 0x25, 0x00, 0x00, 0x00, 0x00 } },
+        70 },
+    /* 43 P_BANK_0_INST_43_HIGH_FLOOR_TOM */
+    { { { 0x3D, 0xC0, 0x31, 0x14, 0x70, 0x10, 0x16, 0x03, 0x00, 0x03,
+        0x1E, 0x5E, 0x1E, 0x1E, 0x1A, 0x0C, 0x11, 0x11, 0x03, 0x01,
+        0x0E, 0x09, 0xF6, 0xF6, 0xF6, 0xF6, 0x00, 0x00, 0x00, 0x00 } },
+        20 },
+    /* 44 P_BANK_0_INST_44_PEDALHIHAT */
+    { { { 0x38, 0xC0, 0x3C, 0x13, 0x7A, 0x75, 0x00, 0x00, 0x00, 0x07,
+        0x47, 0xDF, 0xC3, 0xC4, 0x0A, 0x00, 0x8A, 0x0D, 0x1C, 0x00,
+        0x10, 0x1D, 0xB4, 0x04, 0xB7, 0x59, 0x00, 0x00, 0x00, 0x00 } },
+        100 },
+    /* 45 P_BANK_0_INST_45_LOW_TOM */
+    { { { 0x3D, 0xC0, 0x31, 0x14, 0x70, 0x10, 0x16, 0x03, 0x00, 0x03,
+        0x1E, 0x5E, 0x1E, 0x1E, 0x1A, 0x0C, 0x11, 0x11, 0x03, 0x01,
+        0x03, 0x03, 0xF6, 0xF6, 0xF6, 0xF6, 0x00, 0x00, 0x00, 0x00 } },
+        24 },
+    /* 46 P_BANK_0_INST_46_OPENHIHAT */
+    { { { 0x2C, 0xC0, 0x09, 0x00, 0x02, 0x00, 0x00, 0x7F, 0x08, 0x7F,
+        0x1F, 0x00, 0x1F, 0x00, 0x0E, 0x00, 0x17, 0x00, 0x00, 0x00,
+        0x08, 0x00, 0x10, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        69 },
+    /* 47 P_BANK_0_INST_47_LOWMED_TOM */
+    { { { 0x3D, 0xC0, 0x30, 0x14, 0x70, 0x10, 0x16, 0x03, 0x00, 0x03,
+        0x1E, 0x5E, 0x1E, 0x1E, 0x1A, 0x0C, 0x11, 0x11, 0x03, 0x01,
+        0x03, 0x03, 0xF6, 0xF6, 0xF6, 0xF6, 0x00, 0x00, 0x00, 0x00 } },
+        29 },
+    /* 48 P_BANK_0_INST_48_HIGHMED_TOM */
+    { { { 0x3D, 0xC0, 0x30, 0x14, 0x70, 0x10, 0x16, 0x03, 0x00, 0x03,
+        0x1E, 0x5E, 0x1E, 0x1E, 0x18, 0x0C, 0x11, 0x11, 0x13, 0x01,
+        0x03, 0x03, 0xF6, 0xF6, 0xF6, 0xF6, 0x00, 0x00, 0x00, 0x00 } },
+        33 },
+    /* 49 P_BANK_0_INST_49_CRASH_ANIMATICS */
+    { { { 0x3C, 0xD0, 0x7F, 0x71, 0x13, 0x07, 0x00, 0x00, 0x00, 0x00,
+        0x1F, 0x1F, 0x1F, 0x9F, 0x0B, 0x16, 0x8B, 0x1B, 0x00, 0x07,
+        0x00, 0x07, 0x40, 0x34, 0xF6, 0xA6, 0x00, 0x00, 0x00, 0x00 } },
+        68 },
+    /* 50 P_BANK_0_INST_50_HIGH_TOM_ */
+    { { { 0x3D, 0xC0, 0x31, 0x14, 0x70, 0x10, 0x16, 0x03, 0x00, 0x03,
+        0x1E, 0x5E, 0x1E, 0x1E, 0x1A, 0x0C, 0x11, 0x11, 0x03, 0x01,
+        0x03, 0x03, 0xF6, 0xF6, 0xF6, 0xF6, 0x00, 0x00, 0x00, 0x00 } },
+        36 },
+    /* 51 P_BANK_0_INST_51_RIDECYMBELL1 */
+    { { { 0x2C, 0xC0, 0x0C, 0x00, 0x03, 0x00, 0x00, 0x7F, 0x0C, 0x7F,
+        0x1F, 0x00, 0x18, 0x00, 0x0D, 0x00, 0x15, 0x00, 0x00, 0x00,
+        0x07, 0x00, 0x10, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        76 },
+    /* 52 P_BANK_0_INST_52_CHINESE_CRASH_ANIMATICS */
+    { { { 0x2C, 0xC0, 0x7F, 0x71, 0x13, 0x07, 0x00, 0x00, 0x00, 0x00,
+        0x1F, 0x1F, 0x1F, 0x9F, 0x07, 0x15, 0x0C, 0x19, 0x00, 0x06,
+        0x04, 0x06, 0x52, 0x33, 0x84, 0xA3, 0x00, 0x00, 0x00, 0x00 } },
+        65 },
+    /* 53 P_BANK_0_INST_53_RIDE_BELL */
+    { { { 0x1C, 0xC0, 0x0D, 0x00, 0x0D, 0x00, 0x00, 0x7F, 0x11, 0x7F,
+        0x1F, 0x00, 0x1F, 0x00, 0x07, 0x00, 0x0A, 0x00, 0x07, 0x00,
+        0x12, 0x00, 0xE1, 0x00, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        76 },
+    /* 54 P_BANK_0_INST_54_TAMBORINE */
+    { { { 0x39, 0xF5, 0x22, 0x75, 0x04, 0x3E, 0x06, 0x00, 0x01, 0x08,
+        0x5F, 0x96, 0x9F, 0x92, 0x05, 0x0F, 0x05, 0x0D, 0x02, 0x0C,
+        0x02, 0x0D, 0x81, 0xA1, 0x53, 0xA6, 0x00, 0x00, 0x00, 0x00 } },
+        61 },
+    /* 55 P_BANK_0_INST_55_SPLASH_CRASH_ANIMATICS */
+    { { { 0x2C, 0xC0, 0x7F, 0x71, 0x13, 0x07, 0x00, 0x00, 0x00, 0x00,
+        0x1F, 0x1F, 0x1F, 0x9F, 0x05, 0x15, 0x0B, 0x1A, 0x06, 0x06,
+        0x04, 0x06, 0x50, 0x33, 0x85, 0xA5, 0x00, 0x00, 0x00, 0x00 } },
+        84 },
+    /* 56 P_BANK_0_INST_56_COWBELL */
+    { { { 0x04, 0xC0, 0x02, 0x00, 0x07, 0x00, 0x10, 0x7F, 0x00, 0x7F,
+        0x1F, 0x00, 0x1F, 0x00, 0x12, 0x00, 0x10, 0x00, 0x11, 0x00,
+        0x10, 0x00, 0xD8, 0x00, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        64 },
+    /* 57 P_BANK_0_INST_57_CRASH_2_ANIMATICS */
+    { { { 0x2C, 0xC0, 0x7F, 0x71, 0x13, 0x07, 0x00, 0x00, 0x00, 0x00,
+        0x1F, 0x1F, 0x1F, 0x9F, 0x00, 0x14, 0x0A, 0x19, 0x00, 0x06,
+        0x04, 0x06, 0x50, 0x33, 0x84, 0xA4, 0x00, 0x00, 0x00, 0x00 } },
+        70 },
+    /* 58 P_BANK_0_INST_58_VIBESLAP */
+    { { { 0x34, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x15,
+        0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x05, 0x0A, 0x0A, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xF5, 0xF5, 0x00, 0x00, 0x00, 0x00 } },
+        28 },
+    /* 59 P_BANK_0_INST_59_RIDECYMBELL2 */
+    { { { 0x2C, 0xC0, 0x0C, 0x00, 0x03, 0x00, 0x00, 0x7F, 0x0B, 0x7F,
+        0x1F, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x14, 0x00, 0x00, 0x00,
+        0x08, 0x00, 0x10, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        81 },
+    /* 60 P_BANK_0_INST_60_HIBO */
+    { { { 0x36, 0xC0, 0x01, 0x72, 0x00, 0x33, 0x05, 0x00, 0x00, 0x04,
+        0x9C, 0x17, 0x9C, 0x12, 0x0F, 0x12, 0x14, 0x12, 0x00, 0x0A,
+        0x00, 0x0A, 0xF9, 0xF9, 0xF9, 0xF9, 0x00, 0x00, 0x00, 0x00 } },
+        65 },
+    /* 61 P_BANK_0_INST_61_LOBO */
+    { { { 0x36, 0xC0, 0x01, 0x72, 0x00, 0x33, 0x05, 0x00, 0x00, 0x04,
+        0x9C, 0x17, 0x9C, 0x12, 0x0F, 0x12, 0x14, 0x12, 0x00, 0x0A,
+        0x00, 0x0A, 0xF9, 0xF9, 0xF9, 0xF9, 0x00, 0x00, 0x00, 0x00 } },
+        60 },
+    /* 62 P_BANK_0_INST_62_MUHICO */
+    { { { 0x36, 0xC0, 0x01, 0x72, 0x01, 0x12, 0x07, 0x00, 0x00, 0x00,
+        0x9F, 0x1E, 0x9F, 0x12, 0x0F, 0x12, 0x12, 0x16, 0x00, 0x0A,
+        0x00, 0x0A, 0xF9, 0xF9, 0xF9, 0xFA, 0x00, 0x00, 0x00, 0x00 } },
+        44 },
+    /* 63 P_BANK_0_INST_63_OPHICO */
+    { { { 0x36, 0xC0, 0x01, 0x71, 0x00, 0x11, 0x05, 0x00, 0x00, 0x00,
+        0x9C, 0x17, 0x9C, 0x12, 0x0F, 0x14, 0x17, 0x10, 0x00, 0x0C,
+        0x00, 0x0C, 0xF9, 0xFB, 0xFA, 0xF8, 0x00, 0x00, 0x00, 0x00 } },
+        62 },
+    /* 64 P_BANK_0_INST_64_LOWCO */
+    { { { 0x36, 0xC0, 0x01, 0x72, 0x00, 0x31, 0x05, 0x0D, 0x00, 0x06,
+        0x9C, 0x17, 0x9C, 0x12, 0x0F, 0x14, 0x16, 0x0F, 0x00, 0x0A,
+        0x00, 0x0A, 0xF9, 0xF9, 0xFA, 0xF8, 0x00, 0x00, 0x00, 0x00 } },
+        56 },
+    /* 65 P_BANK_0_INST_65_HIGHTIMBALE */
+    { { { 0x2A, 0xC5, 0x13, 0x00, 0x36, 0x02, 0x06, 0x0D, 0x05, 0x00,
+        0x9F, 0x5F, 0x5F, 0x5F, 0x19, 0x13, 0x19, 0x0F, 0x08, 0x05,
+        0x06, 0x11, 0xC6, 0xBC, 0xA6, 0x86, 0x00, 0x00, 0x00, 0x00 } },
+        67 },
+    /* 66 P_BANK_0_INST_66_LOWTIMBALE */
+    { { { 0x2A, 0xC5, 0x13, 0x00, 0x36, 0x02, 0x06, 0x0A, 0x05, 0x00,
+        0x9F, 0x5F, 0x5F, 0x5F, 0x19, 0x13, 0x19, 0x0F, 0x08, 0x05,
+        0x06, 0x11, 0xCA, 0xBC, 0xAC, 0x8C, 0x00, 0x00, 0x00, 0x00 } },
+        60 },
+    /* 67 P_BANK_0_INST_67_HIAGOGO */
+    { { { 0x3C, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x0D, 0x7F, 0x00, 0x7F,
+        0x9F, 0x00, 0x1F, 0x00, 0x10, 0x00, 0x0C, 0x00, 0x10, 0x00,
+        0x0C, 0x00, 0x86, 0x00, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        58 },
+    /* 68 P_BANK_0_INST_68_LOAGOGO */
+    { { { 0x3C, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x0D, 0x7F, 0x00, 0x7F,
+        0x9F, 0x00, 0x1F, 0x00, 0x10, 0x00, 0x0C, 0x00, 0x10, 0x00,
+        0x0C, 0x00, 0x86, 0x00, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        53 },
+    /* 69 P_BANK_0_INST_69_CABASA */
+    { { { 0x31, 0xF5, 0x2F, 0x7D, 0x0F, 0x33, 0x06, 0x02, 0x01, 0x00,
+        0x5F, 0x99, 0x9F, 0x8D, 0x05, 0x05, 0x05, 0x11, 0x02, 0x02,
+        0x02, 0x0B, 0x81, 0x71, 0x53, 0xA9, 0x00, 0x00, 0x00, 0x00 } },
+        67 },
+    /* 70 P_BANK_0_INST_70_MARACAS */
+    { { { 0x3C, 0xC0, 0x0F, 0x0F, 0x02, 0x0F, 0x00, 0x00, 0x00, 0x1F,
+        0x58, 0xD8, 0x8E, 0x12, 0x0E, 0x10, 0x16, 0x12, 0x18, 0x12,
+        0x19, 0x12, 0x49, 0x49, 0x8D, 0x69, 0x00, 0x00, 0x00, 0x00 } },
+        71 },
+    /* 71 P_BANK_0_INST_71_SHORTWHISTLE */
+    { { { 0x04, 0xC0, 0x00, 0x00, 0x0E, 0x00, 0x25, 0x7F, 0x00, 0x7F,
+        0x12, 0x00, 0x12, 0x00, 0x0A, 0x00, 0x0B, 0x00, 0x00, 0x00,
+        0x16, 0x00, 0x0B, 0xF0, 0x2B, 0xF0, 0x00, 0x00, 0x00, 0x00 } },
+        55 },
+    /* 72 P_BANK_0_INST_72_LONGWHISTLE */
+    { { { 0x04, 0xC0, 0x00, 0x00, 0x0E, 0x00, 0x25, 0x7F, 0x00, 0x7F,
+        0x12, 0x00, 0x12, 0x00, 0x0A, 0x00, 0x08, 0x00, 0x00, 0x00,
+        0x16, 0x00, 0x0B, 0xF0, 0x2B, 0xF0, 0x00, 0x00, 0x00, 0x00 } },
+        51 },
+    /* 73 P_BANK_0_INST_73_SHORT_GUIRO */
+    { { { 0x3C, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x02, 0x7F,
+        0x1F, 0x00, 0x0F, 0x00, 0x0B, 0x00, 0x0E, 0x00, 0x0A, 0x00,
+        0x10, 0x00, 0x06, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        62 },
+    /* 74 P_BANK_0_INST_74_LONG_GUIRO */
+    { { { 0x3C, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x07, 0x7F,
+        0x1F, 0x00, 0x0C, 0x00, 0x09, 0x00, 0x0E, 0x00, 0x09, 0x00,
+        0x10, 0x00, 0x06, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        62 },
+    /* 75 P_BANK_0_INST_75_WOODBLOCK */
+    { { { 0x3C, 0xC0, 0x17, 0x1E, 0x15, 0x19, 0x14, 0x0A, 0x00, 0x05,
+        0x1F, 0xDF, 0x1F, 0xDF, 0x16, 0x19, 0x12, 0x14, 0x16, 0x0C,
+        0x1C, 0x0D, 0xC8, 0xE8, 0xB8, 0x18, 0x00, 0x00, 0x00, 0x00 } },
+        69 },
+    /* 76 P_BANK_0_INST_76_WOODBLOCK */
+    { { { 0x3C, 0xC0, 0x17, 0x1E, 0x15, 0x19, 0x14, 0x0A, 0x00, 0x06,
+        0x1F, 0xDF, 0x1F, 0xDF, 0x16, 0x19, 0x12, 0x14, 0x16, 0x0C,
+        0x1C, 0x0D, 0xC8, 0xE8, 0xB8, 0x18, 0x00, 0x00, 0x00, 0x00 } },
+        59 },
+    /* 77 P_BANK_0_INST_77_WOODBLOCK */
+    { { { 0x3C, 0xC0, 0x17, 0x1E, 0x15, 0x19, 0x14, 0x0A, 0x00, 0x06,
+        0x1F, 0xDF, 0x1F, 0xDF, 0x16, 0x19, 0x12, 0x14, 0x16, 0x0C,
+        0x1C, 0x0D, 0xC8, 0xE8, 0xB8, 0x18, 0x00, 0x00, 0x00, 0x00 } },
+        53 },
+    /* 78 P_BANK_0_INST_78_MUTE_CUIKA */
+    { { { 0x3C, 0xC0, 0x72, 0x01, 0x78, 0x08, 0x27, 0x1B, 0x00, 0x00,
+        0x0C, 0x0C, 0x4E, 0x8E, 0x0F, 0x0F, 0x06, 0x06, 0x0F, 0x0F,
+        0x11, 0x11, 0x07, 0x07, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00 } },
+        45 },
+    /* 79 P_BANK_0_INST_79_OPEN_CUIKA */
+    { { { 0x3C, 0xC0, 0x01, 0x01, 0x04, 0x01, 0x26, 0x1E, 0x00, 0x17,
+        0x0C, 0x0C, 0x0E, 0x0E, 0x0F, 0x00, 0x06, 0x0F, 0x0F, 0x00,
+        0x11, 0x0E, 0x07, 0x07, 0x06, 0xB6, 0x00, 0x00, 0x00, 0x00 } },
+        39 },
+    /* 80 P_BANK_0_INST_80_MUTETRIANGLE */
+    { { { 0x24, 0xC0, 0x03, 0x00, 0x02, 0x00, 0x1A, 0x7F, 0x00, 0x7F,
+        0x1F, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
+        0x0D, 0x00, 0x80, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        99 },
+    /* 81 P_BANK_0_INST_81_OPENTRIANGLE */
+    { { { 0x24, 0xC0, 0x03, 0x00, 0x02, 0x00, 0x1A, 0x7F, 0x00, 0x7F,
+        0x1F, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+        0x08, 0x00, 0x80, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        99 },
+    /* 82 P_BANK_0_INST_82_SHAKER */
+    { { { 0x3C, 0xC0, 0x0F, 0x0F, 0x02, 0x0F, 0x00, 0x00, 0x0E, 0x12,
+        0x58, 0xD8, 0x8C, 0x12, 0x0E, 0x10, 0x16, 0x12, 0x18, 0x12,
+        0x19, 0x12, 0x49, 0x49, 0x8D, 0x69, 0x00, 0x00, 0x00, 0x00 } },
+        71 },
+    /* 83 P_BANK_0_INST_83_JINGLEBELLS */
+    { { { 0x3C, 0xC0, 0x05, 0x05, 0x04, 0x04, 0x18, 0x1C, 0x09, 0x0E,
+        0x1F, 0x1F, 0x51, 0x51, 0x04, 0x09, 0x0B, 0x0B, 0x0F, 0x10,
+        0x07, 0x07, 0xF4, 0xF0, 0xA6, 0xA5, 0x00, 0x00, 0x00, 0x00 } },
+        79 },
+    /* 84 P_BANK_0_INST_84_BELLTREE */
+    { { { 0x2C, 0xC0, 0x05, 0x05, 0x09, 0x08, 0x09, 0x7F, 0x00, 0x7F,
+        0x14, 0x00, 0x14, 0x00, 0x0D, 0x00, 0x15, 0x00, 0x00, 0x00,
+        0x08, 0x00, 0x10, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        83 },
+    /* 85 P_BANK_0_INST_85_CASTANETS */
+    { { { 0x1C, 0xC0, 0x09, 0x01, 0x04, 0x02, 0x17, 0x0F, 0x0D, 0x0D,
+        0x1F, 0x1F, 0x9F, 0x9F, 0x0B, 0x13, 0x14, 0x14, 0x00, 0x00,
+        0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00 } },
+        62 },
+    /* 86 P_BANK_0_INST_86_MUTESURDO */
+    { { { 0x36, 0xC0, 0x01, 0x71, 0x00, 0x31, 0x05, 0x00, 0x00, 0x00,
+        0x9C, 0x10, 0xD3, 0x0E, 0x0F, 0x12, 0x14, 0x0E, 0x00, 0x0A,
+        0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00 } },
+        48 },
+    /* 87 P_BANK_0_INST_87_OPENSURDO */
+    { { { 0x36, 0xC0, 0x01, 0x71, 0x00, 0x31, 0x05, 0x00, 0x00, 0x00,
+        0x9C, 0x10, 0xD3, 0x0E, 0x0F, 0x12, 0x14, 0x0B, 0x00, 0x0A,
+        0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00 } },
+        41 },
+    /* 88 P_BANK_0_INST_88 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 89 P_BANK_0_INST_89 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 90 P_BANK_0_INST_90 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 91 P_BANK_0_INST_91 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 92 P_BANK_0_INST_92 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 93 P_BANK_0_INST_93 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 94 P_BANK_0_INST_94 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 95 P_BANK_0_INST_95 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 96 P_BANK_0_INST_96 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 97 P_BANK_0_INST_97 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 98 P_BANK_0_INST_98 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 99 P_BANK_0_INST_99 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 100 P_BANK_0_INST_100 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 101 P_BANK_0_INST_101 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 102 P_BANK_0_INST_102 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 103 P_BANK_0_INST_103 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 104 P_BANK_0_INST_104 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 105 P_BANK_0_INST_105 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 106 P_BANK_0_INST_106 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 107 P_BANK_0_INST_107 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 108 P_BANK_0_INST_108 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 109 P_BANK_0_INST_109 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 110 P_BANK_0_INST_110 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 111 P_BANK_0_INST_111 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 112 P_BANK_0_INST_112 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 113 P_BANK_0_INST_113 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 114 P_BANK_0_INST_114 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 115 P_BANK_0_INST_115 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 116 P_BANK_0_INST_116 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 117 P_BANK_0_INST_117 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 118 P_BANK_0_INST_118 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 119 P_BANK_0_INST_119 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 120 P_BANK_0_INST_120 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 121 P_BANK_0_INST_121 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 122 P_BANK_0_INST_122 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 123 P_BANK_0_INST_123 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 124 P_BANK_0_INST_124 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 125 P_BANK_0_INST_125 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 126 P_BANK_0_INST_126 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+    /* 127 P_BANK_0_INST_127 */
+    { { { 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+        0 },
+};
@@ -871,6 +871,96 @@ const FmChannel* M_BANK_0[128] = { &M_BANK_0_INST_0_GRANDPIANO,
     &M_BANK_0_INST_125_HELICOPTER, &M_BANK_0_INST_126_APPLAUSE,
     &M_BANK_0_INST_127_GUNSHOT };
 
+/* GS variation bank, selected with bank select MSB 8 */
+static const FmChannel M_BANK_8_INST_4_DETUNEDEP1 = { 4, 6, 3, 0, 0, 0, 0,
+    { { 12, 4, 31, 1, 7, 0, 11, 0, 8, 57, 0 },
+        { 1, 3, 31, 2, 4, 1, 1, 4, 8, 9, 0 },
+        { 1, 4, 22, 2, 5, 0, 11, 0, 8, 34, 0 },
+        { 1, 7, 31, 2, 4, 1, 6, 4, 8, 9, 0 } } };
+
+static const FmChannel M_BANK_8_INST_16_DETUNEDORGAN1
+    = { 7, 4, 3, 0, 0, 0, 0,
+          { { 4, 3, 28, 1, 0, 0, 15, 4, 10, 17, 0 },
+              { 0, 7, 28, 1, 0, 0, 15, 27, 8, 23, 0 },
+              { 1, 1, 28, 1, 0, 0, 15, 4, 8, 15, 0 },
+              { 2, 2, 28, 1, 0, 0, 15, 4, 10, 23, 0 } } };
+
+static const FmChannel M_BANK_8_INST_38_SYNBASS3 = { 5, 7, 3, 0, 0, 0, 0,
+    { { 4, 4, 21, 1, 30, 0, 0, 13, 11, 18, 0 },
+        { 4, 1, 25, 1, 30, 0, 0, 10, 12, 0, 0 },
+        { 2, 0, 20, 1, 30, 0, 0, 9, 12, 5, 0 },
+        { 3, 3, 20, 1, 30, 0, 8, 5, 12, 24, 0 } } };
+
+const FmChannel* M_BANK_8[128] = { &M_BANK_0_INST_0_GRANDPIANO,
+    &M_BANK_0_INST_1_BRIGHTPIANO, &M_BANK_0_INST_2_ELECTRICPIANO_ANIMATICS,
+    &M_BANK_0_INST_3_HONKYTONK_SONICMODDED, &M_BANK_8_INST_4_DETUNEDEP1,
+    &M_BANK_0_INST_5_CHORUSPIANOTINITOON, &M_BANK_0_INST_6_HARPSICHORD_ADAMS,
+    &M_BANK_0_INST_7_CLAVINET, &M_BANK_0_INST_8_CELESTA,
+    &M_BANK_0_INST_9_GLOCKENSPIEL, &M_BANK_0_INST_10_MUSICBOX,
+    &M_BANK_0_INST_11_VIBRAPHONE_NINEKO, &M_BANK_0_INST_12_MARIMBA_ALADDIN,
+    &M_BANK_0_INST_13_XYLAPHONE_ALADDIN,
+    &M_BANK_0_INST_14_TUBULARBELLS_ANIMATICS, &M_BANK_0_INST_15_DULCIMER,
+    &M_BANK_8_INST_16_DETUNEDORGAN1, &M_BANK_0_INST_17_PERCUSIVEORGAIN_ACTION52,
+    &M_BANK_0_INST_18_ROCKORGAN, &M_BANK_0_INST_19_CHURCHORGAN,
+    &M_BANK_0_INST_20_REEDORGAN, &M_BANK_0_INST_21_ACCORDEON,
+    &M_BANK_0_INST_22_HARMONICA_SONIC, &M_BANK_0_INST_23_TANGO_ACCORDION,
+    &M_BANK_0_INST_24_NYLONGUITARHELLROLL,
+    &M_BANK_0_INST_25_STEELGUITARHELLROLL, &M_BANK_0_INST_26_JAZZGUITAR,
+    &M_BANK_0_INST_27_CLEANGUITAR_COLUMNS_III,
+    &M_BANK_0_INST_28_MUTEDGUITAR_ALADDIN, &M_BANK_0_INST_29_OVERDRIVE_OPL3,
+    &M_BANK_0_INST_30_DISTORTION_OPL3,
+    &M_BANK_0_INST_31_GUITAR_HARMONICSHELLFIRE,
+    &M_BANK_0_INST_32_ACOUSTICBASS_SONIC, &M_BANK_0_INST_33_FINGERBASS_SONIC,
+    &M_BANK_0_INST_34_PICKBASS, &M_BANK_0_INST_35_FRETLESSBASSALADDIN,
+    &M_BANK_0_INST_36_SLAPBASS1, &M_BANK_0_INST_37_SLAPBASS2,
+    &M_BANK_8_INST_38_SYNBASS3, &M_BANK_0_INST_39_SYNBASS2_NINEKO,
+    &M_BANK_0_INST_40_VIOLIN, &M_BANK_0_INST_41_VIOLA, &M_BANK_0_INST_42_CELLO,
+    &M_BANK_0_INST_43_CONTROLBASS, &M_BANK_0_INST_44_TREMOLOSTRINGS,
+    &M_BANK_0_INST_45_PIZZIKATOSTRINGS, &M_BANK_0_INST_46_ORCHESTRALHARP,
+    &M_BANK_0_INST_47_TIMPANY, &M_BANK_0_INST_48_STRINGESSEMBLE1,
+    &M_BANK_0_INST_49_STRINGESSEMBLE2, &M_BANK_0_INST_50_SYNSTRINGS_1,
+    &M_BANK_0_INST_51_SYNSTRING2_ALADDIN, &M_BANK_0_INST_52_CHOIR_AAHS,
+    &M_BANK_0_INST_53_VOICE, &M_BANK_0_INST_54_SYNTHVOICE,
+    &M_BANK_0_INST_55_ORCHESTRAHIT, &M_BANK_0_INST_56_TRUMPET_SONIC,
+    &M_BANK_0_INST_57_TROMBONE_ALADDIN, &M_BANK_0_INST_58_TUBA_ALADDIN,
+    &M_BANK_0_INST_59_MUTEDTRUMPET_SONIC, &M_BANK_0_INST_60_FRENCHHORN,
+    &M_BANK_0_INST_61_BRASSSECTION_GREENDOG, &M_BANK_0_INST_62_SYNBRASS1,
+    &M_BANK_0_INST_63_SYNBRASS2, &M_BANK_0_INST_64_SOPRANOSAX,
+    &M_BANK_0_INST_65_ALTOSAX, &M_BANK_0_INST_66_TENORSAX,
+    &M_BANK_0_INST_67_BARITONESAX, &M_BANK_0_INST_68_OBOE_ALADDIN,
+    &M_BANK_0_INST_69_ENGLISHHORN, &M_BANK_0_INST_70_BASSOON_ALADDIN,
+    &M_BANK_0_INST_71_CLARINET_ALADDIN, &M_BANK_0_INST_72_PICCOLO_ALADDIN,
+    &M_BANK_0_INST_73_FLUTE, &M_BANK_0_INST_74_RECORDER,
+    &M_BANK_0_INST_75_PANFLUTE, &M_BANK_0_INST_76_BOTTLEBLOW,
+    &M_BANK_0_INST_77_SHAKUHACHI_ALISIA_DRAGOON,
+    &M_BANK_0_INST_78_WHISTLE_ALADDIN, &M_BANK_0_INST_79_OCARINA,
+    &M_BANK_0_INST_80_LEADSQUARE, &M_BANK_0_INST_81_LEADSAW,
+    &M_BANK_0_INST_82_LEADCALLIOPE, &M_BANK_0_INST_83_LEAD4CHIF_SONIC,
+    &M_BANK_0_INST_84_LEAD5CHAR_NINEKO, &M_BANK_0_INST_85_LEADVOICE,
+    &M_BANK_0_INST_86_LEAD7FIFTS_ANIMATICS,
+    &M_BANK_0_INST_87_LEAD8BASS_GEMS_ANALOG_SOLO, &M_BANK_0_INST_88_PAD1NEWAGE,
+    &M_BANK_0_INST_89_PAD_WARM_PORTED_FROM_DMX, &M_BANK_0_INST_90_POLYSYNTH,
+    &M_BANK_0_INST_91_PADCHOIR, &M_BANK_0_INST_92_BOWED,
+    &M_BANK_0_INST_93_METALLIC, &M_BANK_0_INST_94_PADHALO,
+    &M_BANK_0_INST_95_SWEEP, &M_BANK_0_INST_96_FX_RAIN,
+    &M_BANK_0_INST_97_FXSNDTRACK_THUNDERFORCE_IV,
+    &M_BANK_0_INST_98_FXCRYSTAL_ALISIA_DRAGOON,
+    &M_BANK_0_INST_99_ATMOSPHERE_ALISIA_DRAGOON, &M_BANK_0_INST_100_BRIGHTNESS,
+    &M_BANK_0_INST_101_GOBLINS, &M_BANK_0_INST_102_ECHOS,
+    &M_BANK_0_INST_103_SCIFI, &M_BANK_0_INST_104_SITAR,
+    &M_BANK_0_INST_105_BANJO, &M_BANK_0_INST_106_SHAMISEN,
+    &M_BANK_0_INST_107_KOTO, &M_BANK_0_INST_108_KALIMBA,
+    &M_BANK_0_INST_109_BAGPIPE, &M_BANK_0_INST_110_FIDDLE,
+    &M_BANK_0_INST_111_SHANAI_ALADDIN, &M_BANK_0_INST_112_TINKLEBELL,
+    &M_BANK_0_INST_113_AGOGO, &M_BANK_0_INST_114_STEELDRUMS,
+    &M_BANK_0_INST_115_WOODBLOCK, &M_BANK_0_INST_116_TAIKO_DRUM,
+    &M_BANK_0_INST_117_MELODIC_TOM, &M_BANK_0_INST_118_SYNDRUM_ALISIA_DRAGOON,
+    &M_BANK_0_INST_119_REVERSE_CYMBELL, &M_BANK_0_INST_120_GUITAR_FRET_NOISE,
+    &M_BANK_0_INST_121_BREATH_NOISE, &M_BANK_0_INST_122_SEASHORE,
+    &M_BANK_0_INST_123_BIRDTWEET, &M_BANK_0_INST_124_TELEPHONE,
+    &M_BANK_0_INST_125_HELICOPTER, &M_BANK_0_INST_126_APPLAUSE,
+    &M_BANK_0_INST_127_GUNSHOT };
+
 static const PercussionPreset P_BANK_0_INST_0
     = { { 0, 0, 3, 0, 0, 0, 0,
             { { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
@@ -3,4 +3,11 @@
 #include "synth.h"
 
 extern const FmChannel* M_BANK_0[128];
+extern const FmChannel* M_BANK_8[128];
 extern const PercussionPreset* P_BANK_0[128];
+extern const FmPresetImage* M_BANK_0_IMAGES[128];
+/* Banks are selected by their bank select MSB. Unlisted banks fall back to
+   bank 0, so a variation bank only needs its entries filled in from the
+   bank 0 instruments it doesn't replace. */
+extern const FmPresetImage** M_BANKS[128];
+extern const PercussionPresetImage P_BANK_0_IMAGES[128];
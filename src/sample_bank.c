@@ -0,0 +1,315 @@
+#include "sample_bank.h"
+#include "log.h"
+#include "synth.h"
+#include "z80_ym.h"
+
+#define MIDI_KEYS 128
+#define NO_SLOT 0xFF
+#define FREE_BLOCKS (SAMPLE_BANK_SLOTS + 1)
+#define PACKED_GROUP_LENGTH 7
+#define ENCODED_CHUNK_LENGTH                                                   \
+    (SAMPLE_UPLOAD_CHUNK_LENGTH                                                \
+        + SAMPLE_UPLOAD_CHUNK_LENGTH / PACKED_GROUP_LENGTH + 1)
+
+typedef struct FreeBlock FreeBlock;
+
+struct FreeBlock {
+    u16 offset;
+    u16 length;
+};
+
+typedef struct Upload Upload;
+
+struct Upload {
+    bool active;
+    u8 key;
+    u8 slot;
+    u16 received;
+    u8 headerIndex;
+    u8 header[SAMPLE_UPLOAD_HEADER_LENGTH];
+    u8 chunkIndex;
+    u8 chunk[ENCODED_CHUNK_LENGTH];
+};
+
+static UploadedSample samples[SAMPLE_BANK_SLOTS];
+static bool slotUsed[SAMPLE_BANK_SLOTS];
+static u8 keySlots[MIDI_KEYS];
+static FreeBlock freeBlocks[FREE_BLOCKS];
+static u8 freeBlockCount;
+static Upload upload;
+/* The slot the DAC is streaming, so that freeing any other slot leaves the
+   sample that is playing alone */
+static u8 playingSlot;
+
+static void freeSlot(u8 slot);
+static void uploadByte(u8 data);
+
+void sample_bank_init(void)
+{
+    for (u8 i = 0; i < SAMPLE_BANK_SLOTS; i++) {
+        slotUsed[i] = false;
+    }
+    for (u8 key = 0; key < MIDI_KEYS; key++) {
+        keySlots[key] = NO_SLOT;
+    }
+    freeBlocks[0].offset = 0;
+    freeBlocks[0].length = Z80_SAMPLE_ARENA_SIZE;
+    freeBlockCount = 1;
+    upload.active = false;
+    playingSlot = NO_SLOT;
+}
+
+const UploadedSample* sample_bank_find(u8 key)
+{
+    u8 slot = keySlots[key];
+    return slot == NO_SLOT ? NULL : &samples[slot];
+}
+
+bool sample_bank_play(u8 key)
+{
+    u8 slot = keySlots[key];
+    if (slot == NO_SLOT) {
+        return false;
+    }
+    const UploadedSample* sample = &samples[slot];
+    synth_dacPlayLoaded(sample->offset, sample->length, sample->rate,
+        sample->loopStart, sample->loopLength);
+    playingSlot = slot;
+    return true;
+}
+
+void sample_bank_stopped(void)
+{
+    playingSlot = NO_SLOT;
+}
+
+void sample_bank_delete(u8 key)
+{
+    u8 slot = keySlots[key];
+    if (slot == NO_SLOT) {
+        return;
+    }
+    if (slot == playingSlot) {
+        synth_dacStop();
+        playingSlot = NO_SLOT;
+    }
+    keySlots[key] = NO_SLOT;
+    freeSlot(slot);
+}
+
+u16 sample_bank_largest_free_block(void)
+{
+    u16 largest = 0;
+    for (u8 i = 0; i < freeBlockCount; i++) {
+        if (freeBlocks[i].length > largest) {
+            largest = freeBlocks[i].length;
+        }
+    }
+    return largest;
+}
+
+static bool allocate(u16 length, u16* offset)
+{
+    for (u8 i = 0; i < freeBlockCount; i++) {
+        FreeBlock* block = &freeBlocks[i];
+        if (block->length < length) {
+            continue;
+        }
+        *offset = block->offset;
+        block->offset += length;
+        block->length -= length;
+        if (block->length == 0) {
+            freeBlockCount--;
+            for (u8 j = i; j < freeBlockCount; j++) {
+                freeBlocks[j] = freeBlocks[j + 1];
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+static void release(u16 offset, u16 length)
+{
+    u8 i = 0;
+    while (i < freeBlockCount && freeBlocks[i].offset < offset) {
+        i++;
+    }
+    FreeBlock* previous = i > 0 ? &freeBlocks[i - 1] : NULL;
+    bool joinsPrevious
+        = previous != NULL && previous->offset + previous->length == offset;
+    bool joinsNext
+        = i < freeBlockCount && offset + length == freeBlocks[i].offset;
+    if (joinsPrevious && joinsNext) {
+        previous->length += length + freeBlocks[i].length;
+        freeBlockCount--;
+        for (u8 j = i; j < freeBlockCount; j++) {
+            freeBlocks[j] = freeBlocks[j + 1];
+        }
+    } else if (joinsPrevious) {
+        previous->length += length;
+    } else if (joinsNext) {
+        freeBlocks[i].offset = offset;
+        freeBlocks[i].length += length;
+    } else {
+        for (u8 j = freeBlockCount; j > i; j--) {
+            freeBlocks[j] = freeBlocks[j - 1];
+        }
+        freeBlocks[i].offset = offset;
+        freeBlocks[i].length = length;
+        freeBlockCount++;
+    }
+}
+
+static void freeSlot(u8 slot)
+{
+    release(samples[slot].offset, samples[slot].length);
+    slotUsed[slot] = false;
+}
+
+static u8 findFreeSlot(void)
+{
+    for (u8 i = 0; i < SAMPLE_BANK_SLOTS; i++) {
+        if (!slotUsed[i]) {
+            return i;
+        }
+    }
+    return NO_SLOT;
+}
+
+void sample_bank_upload_begin(void)
+{
+    upload.active = true;
+    upload.key = 0;
+    upload.slot = NO_SLOT;
+    upload.received = 0;
+    upload.headerIndex = 0;
+    upload.chunkIndex = 0;
+}
+
+void sample_bank_upload_data(const u8* data, u16 length)
+{
+    for (u16 i = 0; i < length && upload.active; i++) {
+        uploadByte(data[i]);
+    }
+}
+
+static void failUpload(const char* reason)
+{
+    log_warn("Sample %d: %s", upload.key, reason);
+    if (upload.slot != NO_SLOT) {
+        freeSlot(upload.slot);
+    }
+    upload.active = false;
+}
+
+bool sample_bank_upload_end(void)
+{
+    if (!upload.active) {
+        return false;
+    }
+    if (upload.slot == NO_SLOT
+        || upload.received != samples[upload.slot].length) {
+        failUpload("Truncated");
+        return false;
+    }
+    sample_bank_delete(upload.key);
+    keySlots[upload.key] = upload.slot;
+    upload.active = false;
+    return true;
+}
+
+static u16 read16bitValue(const u8* data)
+{
+    return data[0] | (data[1] << 7) | ((data[2] & 0x03) << 14);
+}
+
+static void applyHeader(void)
+{
+    const u8* header = upload.header;
+    upload.key = header[0];
+    UploadedSample sample = { .rate = read16bitValue(&header[1]),
+        .length = read16bitValue(&header[4]),
+        .loopStart = read16bitValue(&header[7]),
+        .loopLength = read16bitValue(&header[10]) };
+    if (sample.length == 0
+        || sample.loopStart + sample.loopLength > sample.length) {
+        failUpload("Invalid header");
+        return;
+    }
+    upload.slot = findFreeSlot();
+    if (upload.slot == NO_SLOT) {
+        failUpload("No free slots");
+        return;
+    }
+    if (!allocate(sample.length, &sample.offset)) {
+        upload.slot = NO_SLOT;
+        failUpload("Out of memory");
+        return;
+    }
+    samples[upload.slot] = sample;
+    slotUsed[upload.slot] = true;
+}
+
+static u8 chunkLength(void)
+{
+    u16 remaining = samples[upload.slot].length - upload.received;
+    return remaining < SAMPLE_UPLOAD_CHUNK_LENGTH ? remaining
+                                                  : SAMPLE_UPLOAD_CHUNK_LENGTH;
+}
+
+static u8 encodedLength(u8 length)
+{
+    return length + (length + PACKED_GROUP_LENGTH - 1) / PACKED_GROUP_LENGTH;
+}
+
+static u8 unpack(const u8* encoded, u8 encodedLength, u8* decoded)
+{
+    u8 length = 0;
+    for (u8 i = 0; i < encodedLength; i += PACKED_GROUP_LENGTH + 1) {
+        u8 msbs = encoded[i];
+        for (u8 j = 1; j <= PACKED_GROUP_LENGTH && i + j < encodedLength;
+             j++) {
+            decoded[length++] = encoded[i + j] | ((msbs << (8 - j)) & 0x80);
+        }
+    }
+    return length;
+}
+
+static void applyChunk(void)
+{
+    u8 length = upload.chunkIndex - 1;
+    u8 checksum = 0;
+    for (u8 i = 0; i < length; i++) {
+        checksum ^= upload.chunk[i];
+    }
+    if (checksum != upload.chunk[length]) {
+        failUpload("Bad checksum");
+        return;
+    }
+    u8 decoded[SAMPLE_UPLOAD_CHUNK_LENGTH];
+    u8 decodedLength = unpack(upload.chunk, length, decoded);
+    synth_dacLoad(samples[upload.slot].offset + upload.received, decoded,
+        decodedLength);
+    upload.received += decodedLength;
+    upload.chunkIndex = 0;
+}
+
+static void uploadByte(u8 data)
+{
+    if (upload.headerIndex < SAMPLE_UPLOAD_HEADER_LENGTH) {
+        upload.header[upload.headerIndex++] = data;
+        if (upload.headerIndex == SAMPLE_UPLOAD_HEADER_LENGTH) {
+            applyHeader();
+        }
+        return;
+    }
+    if (upload.received == samples[upload.slot].length) {
+        failUpload("Too long");
+        return;
+    }
+    upload.chunk[upload.chunkIndex++] = data;
+    if (upload.chunkIndex == encodedLength(chunkLength()) + 1) {
+        applyChunk();
+    }
+}
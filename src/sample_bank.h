@@ -0,0 +1,27 @@
+#pragma once
+#include <stdbool.h>
+#include <types.h>
+
+#define SAMPLE_BANK_SLOTS 16
+#define SAMPLE_UPLOAD_HEADER_LENGTH 13
+#define SAMPLE_UPLOAD_CHUNK_LENGTH 56
+
+typedef struct UploadedSample UploadedSample;
+
+struct UploadedSample {
+    u16 offset;
+    u16 length;
+    u16 rate;
+    u16 loopStart;
+    u16 loopLength;
+};
+
+void sample_bank_init(void);
+const UploadedSample* sample_bank_find(u8 key);
+bool sample_bank_play(u8 key);
+void sample_bank_stopped(void);
+void sample_bank_delete(u8 key);
+u16 sample_bank_largest_free_block(void);
+void sample_bank_upload_begin(void);
+void sample_bank_upload_data(const u8* data, u16 length);
+bool sample_bank_upload_end(void);
@@ -0,0 +1,508 @@
+/* Generated by utils/dac_samples. Do not edit. */
+#include "samples.h"
+#include <stddef.h>
+
+static const u8 KICK_DATA[] = {
+    0x80, 0x8F, 0x9D, 0xAC, 0xB9, 0xC5, 0xD1, 0xDB, 0xE4, 0xEC, 0xF2, 0xF7,
+    0xFA, 0xFB, 0xFB, 0xFA, 0xF6, 0xF2, 0xEB, 0xE4, 0xDB, 0xD2, 0xC7, 0xBC,
+    0xB0, 0xA3, 0x96, 0x89, 0x7C, 0x6F, 0x62, 0x56, 0x4A, 0x3F, 0x35, 0x2C,
+    0x24, 0x1D, 0x17, 0x12, 0x0F, 0x0D, 0x0C, 0x0C, 0x0E, 0x11, 0x15, 0x1A,
+    0x20, 0x28, 0x30, 0x39, 0x43, 0x4D, 0x58, 0x63, 0x6E, 0x79, 0x85, 0x90,
+    0x9B, 0xA6, 0xB0, 0xBA, 0xC3, 0xCB, 0xD2, 0xD9, 0xDF, 0xE4, 0xE8, 0xEA,
+    0xEC, 0xED, 0xED, 0xEB, 0xE9, 0xE6, 0xE2, 0xDD, 0xD7, 0xD0, 0xC9, 0xC1,
+    0xB9, 0xB0, 0xA6, 0x9D, 0x93, 0x89, 0x80, 0x76, 0x6C, 0x63, 0x5A, 0x51,
+    0x49, 0x41, 0x3A, 0x33, 0x2E, 0x29, 0x24, 0x21, 0x1E, 0x1C, 0x1B, 0x1A,
+    0x1B, 0x1C, 0x1E, 0x21, 0x25, 0x29, 0x2E, 0x33, 0x39, 0x40, 0x47, 0x4E,
+    0x56, 0x5E, 0x66, 0x6F, 0x77, 0x7F, 0x88, 0x90, 0x98, 0xA0, 0xA8, 0xAF,
+    0xB6, 0xBC, 0xC2, 0xC8, 0xCD, 0xD1, 0xD5, 0xD8, 0xDA, 0xDC, 0xDE, 0xDE,
+    0xDE, 0xDD, 0xDC, 0xDA, 0xD8, 0xD5, 0xD1, 0xCD, 0xC8, 0xC3, 0xBE, 0xB8,
+    0xB2, 0xAB, 0xA5, 0x9E, 0x97, 0x90, 0x89, 0x81, 0x7A, 0x73, 0x6C, 0x65,
+    0x5F, 0x59, 0x53, 0x4D, 0x47, 0x42, 0x3E, 0x3A, 0x36, 0x33, 0x30, 0x2E,
+    0x2C, 0x2A, 0x2A, 0x29, 0x2A, 0x2A, 0x2B, 0x2D, 0x2F, 0x32, 0x35, 0x38,
+    0x3C, 0x40, 0x44, 0x49, 0x4E, 0x53, 0x59, 0x5E, 0x64, 0x6A, 0x70, 0x76,
+    0x7C, 0x82, 0x88, 0x8E, 0x94, 0x9A, 0x9F, 0xA4, 0xA9, 0xAE, 0xB3, 0xB7,
+    0xBB, 0xBF, 0xC2, 0xC5, 0xC8, 0xCA, 0xCC, 0xCD, 0xCE, 0xCF, 0xCF, 0xCF,
+    0xCF, 0xCE, 0xCD, 0xCB, 0xC9, 0xC7, 0xC4, 0xC1, 0xBE, 0xBB, 0xB7, 0xB3,
+    0xAF, 0xAA, 0xA6, 0xA1, 0x9C, 0x97, 0x92, 0x8D, 0x88, 0x83, 0x7E, 0x79,
+    0x74, 0x6F, 0x6A, 0x66, 0x61, 0x5D, 0x59, 0x55, 0x51, 0x4E, 0x4A, 0x47,
+    0x44, 0x42, 0x40, 0x3E, 0x3C, 0x3B, 0x3A, 0x39, 0x38, 0x38, 0x38, 0x39,
+    0x39, 0x3A, 0x3C, 0x3D, 0x3F, 0x41, 0x43, 0x46, 0x49, 0x4C, 0x4F, 0x52,
+    0x56, 0x59, 0x5D, 0x61, 0x65, 0x69, 0x6D, 0x71, 0x76, 0x7A, 0x7E, 0x82,
+    0x87, 0x8B, 0x8F, 0x93, 0x97, 0x9B, 0x9E, 0xA2, 0xA5, 0xA8, 0xAB, 0xAE,
+    0xB1, 0xB4, 0xB6, 0xB8, 0xBA, 0xBB, 0xBD, 0xBE, 0xBF, 0xC0, 0xC0, 0xC1,
+    0xC1, 0xC0, 0xC0, 0xBF, 0xBF, 0xBE, 0xBC, 0xBB, 0xB9, 0xB7, 0xB5, 0xB3,
+    0xB1, 0xAE, 0xAB, 0xA9, 0xA6, 0xA3, 0x9F, 0x9C, 0x99, 0x95, 0x92, 0x8F,
+    0x8B, 0x88, 0x84, 0x80, 0x7D, 0x79, 0x76, 0x73, 0x6F, 0x6C, 0x69, 0x66,
+    0x63, 0x60, 0x5D, 0x5B, 0x58, 0x56, 0x54, 0x52, 0x50, 0x4E, 0x4C, 0x4B,
+    0x4A, 0x49, 0x48, 0x47, 0x47, 0x46, 0x46, 0x46, 0x47, 0x47, 0x48, 0x48,
+    0x49, 0x4A, 0x4B, 0x4D, 0x4E, 0x50, 0x52, 0x54, 0x56, 0x58, 0x5A, 0x5D,
+    0x5F, 0x62, 0x64, 0x67, 0x6A, 0x6C, 0x6F, 0x72, 0x75, 0x78, 0x7B, 0x7E,
+    0x81, 0x84, 0x86, 0x89, 0x8C, 0x8F, 0x92, 0x94, 0x97, 0x99, 0x9C, 0x9E,
+    0xA0, 0xA2, 0xA4, 0xA6, 0xA8, 0xAA, 0xAB, 0xAC, 0xAE, 0xAF, 0xB0, 0xB1,
+    0xB2, 0xB2, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB2, 0xB2, 0xB1, 0xB0,
+    0xB0, 0xAF, 0xAD, 0xAC, 0xAB, 0xA9, 0xA8, 0xA6, 0xA4, 0xA3, 0xA1, 0x9F,
+    0x9D, 0x9A, 0x98, 0x96, 0x94, 0x91, 0x8F, 0x8D, 0x8A, 0x88, 0x85, 0x83,
+    0x81, 0x7E, 0x7C, 0x79, 0x77, 0x75, 0x72, 0x70, 0x6E, 0x6C, 0x6A, 0x68,
+    0x66, 0x64, 0x62, 0x61, 0x5F, 0x5E, 0x5C, 0x5B, 0x5A, 0x59, 0x57, 0x57,
+    0x56, 0x55, 0x54, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x54,
+    0x54, 0x55, 0x56, 0x57, 0x57, 0x58, 0x59, 0x5B, 0x5C, 0x5D, 0x5E, 0x60,
+    0x61, 0x63, 0x65, 0x66, 0x68, 0x6A, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x75,
+    0x77, 0x79, 0x7B, 0x7D, 0x7F, 0x81, 0x83, 0x85, 0x87, 0x89, 0x8B, 0x8D,
+    0x8F, 0x91, 0x92, 0x94, 0x96, 0x97, 0x99, 0x9A, 0x9C, 0x9D, 0x9E, 0x9F,
+    0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA5, 0xA6, 0xA6, 0xA7, 0xA7, 0xA7,
+    0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA6, 0xA6, 0xA5, 0xA5, 0xA4, 0xA3, 0xA3,
+    0xA2, 0xA1, 0xA0, 0x9F, 0x9E, 0x9C, 0x9B, 0x9A, 0x99, 0x97, 0x96, 0x94,
+    0x93, 0x91, 0x90, 0x8E, 0x8C, 0x8B, 0x89, 0x87, 0x86, 0x84, 0x82, 0x81,
+    0x7F, 0x7D, 0x7C, 0x7A, 0x79, 0x77, 0x75, 0x74, 0x72, 0x71, 0x70, 0x6E,
+    0x6D, 0x6C, 0x6A, 0x69, 0x68, 0x67, 0x66, 0x65, 0x64, 0x63, 0x62, 0x62,
+    0x61, 0x60, 0x60, 0x5F, 0x5F, 0x5F, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+    0x5E, 0x5F, 0x5F, 0x5F, 0x60, 0x60, 0x61, 0x61, 0x62, 0x63, 0x63, 0x64,
+    0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6D, 0x6E, 0x6F, 0x70, 0x72,
+    0x73, 0x74, 0x76, 0x77, 0x78, 0x7A, 0x7B, 0x7D, 0x7E, 0x7F, 0x81, 0x82,
+    0x83, 0x85, 0x86, 0x87, 0x89, 0x8A, 0x8B, 0x8D, 0x8E, 0x8F, 0x90, 0x91,
+    0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x98, 0x99, 0x9A, 0x9A, 0x9B,
+    0x9B, 0x9C, 0x9C, 0x9C, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+    0x9D, 0x9D, 0x9C, 0x9C, 0x9C, 0x9B, 0x9B, 0x9A, 0x9A, 0x99, 0x98, 0x98,
+    0x97, 0x96, 0x95, 0x94, 0x93, 0x93, 0x92, 0x91, 0x90, 0x8F, 0x8D, 0x8C,
+    0x8B, 0x8A, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x81, 0x80, 0x7F,
+    0x7D, 0x7C, 0x7B, 0x7A, 0x79, 0x78, 0x77, 0x76, 0x75, 0x74, 0x73, 0x72,
+    0x71, 0x70, 0x6F, 0x6F, 0x6E, 0x6D, 0x6C, 0x6C, 0x6B, 0x6A, 0x6A, 0x69,
+    0x69, 0x69, 0x68, 0x68, 0x68, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+    0x67, 0x67, 0x67, 0x68, 0x68, 0x68, 0x68, 0x69, 0x69, 0x6A, 0x6A, 0x6B,
+    0x6B, 0x6C, 0x6D, 0x6D, 0x6E, 0x6F, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74,
+    0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x87, 0x88, 0x89, 0x8A,
+    0x8B, 0x8C, 0x8C, 0x8D, 0x8E, 0x8F, 0x8F, 0x90, 0x90, 0x91, 0x92, 0x92,
+    0x93, 0x93, 0x93, 0x94, 0x94, 0x94, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x94, 0x94, 0x94, 0x93,
+    0x93, 0x93, 0x92, 0x92, 0x91, 0x91, 0x90, 0x90, 0x8F, 0x8E, 0x8E, 0x8D,
+    0x8C, 0x8C, 0x8B, 0x8A, 0x89, 0x89, 0x88, 0x87, 0x86, 0x85, 0x85, 0x84,
+    0x83, 0x82, 0x81, 0x81, 0x80, 0x7F, 0x7E, 0x7D, 0x7D, 0x7C, 0x7B, 0x7A,
+    0x79, 0x79, 0x78, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x73, 0x72,
+    0x72, 0x71, 0x71, 0x71, 0x70, 0x70, 0x6F, 0x6F, 0x6F, 0x6F, 0x6E, 0x6E,
+    0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E,
+    0x6E, 0x6F, 0x6F, 0x6F, 0x70, 0x70, 0x70, 0x71, 0x71, 0x72, 0x72, 0x72,
+    0x73, 0x73, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x78, 0x79, 0x7A,
+    0x7A, 0x7B, 0x7C, 0x7C, 0x7D, 0x7E, 0x7E, 0x7F, 0x80, 0x80, 0x81, 0x82,
+    0x82, 0x83, 0x84, 0x84, 0x85, 0x86, 0x86, 0x87, 0x87, 0x88, 0x89, 0x89,
+    0x8A, 0x8A, 0x8B, 0x8B, 0x8C, 0x8C, 0x8C, 0x8D, 0x8D, 0x8D, 0x8E, 0x8E,
+    0x8E, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x90, 0x90, 0x90, 0x90,
+    0x90, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8E, 0x8E, 0x8E, 0x8E,
+    0x8D, 0x8D, 0x8C, 0x8C, 0x8C, 0x8B, 0x8B, 0x8A, 0x8A, 0x89, 0x89, 0x88,
+    0x88, 0x87, 0x87, 0x86, 0x86, 0x85, 0x85, 0x84, 0x84, 0x83, 0x82, 0x82,
+    0x81, 0x81, 0x80, 0x80, 0x7F, 0x7E, 0x7E, 0x7D, 0x7D, 0x7C, 0x7C, 0x7B,
+    0x7B, 0x7A, 0x7A, 0x79, 0x79, 0x78, 0x78, 0x77, 0x77, 0x76, 0x76, 0x76,
+    0x75, 0x75, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x73, 0x73, 0x73, 0x73,
+    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+    0x73, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x75, 0x76, 0x76, 0x76,
+    0x77, 0x77, 0x77, 0x78, 0x78, 0x79, 0x79, 0x7A, 0x7A, 0x7A, 0x7B, 0x7B,
+    0x7C, 0x7C, 0x7D, 0x7D, 0x7E, 0x7E, 0x7F, 0x7F, 0x80, 0x80, 0x81, 0x81,
+    0x82, 0x82, 0x83, 0x83, 0x84, 0x84, 0x84, 0x85, 0x85, 0x86, 0x86, 0x87,
+    0x87, 0x87, 0x88, 0x88, 0x88, 0x89, 0x89, 0x89, 0x89, 0x8A, 0x8A, 0x8A,
+    0x8A, 0x8A, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B,
+    0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8A, 0x8A, 0x8A, 0x8A,
+    0x8A, 0x89, 0x89, 0x89, 0x89, 0x88, 0x88, 0x88, 0x87, 0x87, 0x87, 0x86,
+    0x86, 0x86, 0x85, 0x85, 0x85, 0x84, 0x84, 0x83, 0x83, 0x83, 0x82, 0x82,
+};
+
+static const DacSample KICK = { KICK_DATA, sizeof(KICK_DATA), 8000 };
+
+static const u8 SNARE_DATA[] = {
+    0x82, 0x56, 0x5A, 0x5F, 0x7A, 0xE1, 0x5C, 0xE3, 0x77, 0x86, 0x90, 0xDC,
+    0xA3, 0xB5, 0xE7, 0xA1, 0x77, 0x96, 0xCC, 0x7D, 0x6B, 0x97, 0x4A, 0xBD,
+    0x7D, 0x9C, 0x74, 0x20, 0x80, 0x97, 0x69, 0x4C, 0x6B, 0x8E, 0x73, 0x96,
+    0x58, 0x6E, 0x48, 0x78, 0x89, 0x4E, 0x31, 0x63, 0xAA, 0xA4, 0x83, 0x59,
+    0x54, 0x6C, 0x80, 0xD2, 0xBA, 0xE2, 0xC5, 0x7A, 0x75, 0x8A, 0xE1, 0x79,
+    0xC1, 0x6D, 0x88, 0xC2, 0x7F, 0x5F, 0x76, 0xAD, 0x98, 0x90, 0x90, 0x9B,
+    0x43, 0x80, 0x8B, 0x96, 0x43, 0x5F, 0x4F, 0x73, 0x44, 0x8C, 0x49, 0x78,
+    0x35, 0x51, 0x6A, 0x3F, 0x56, 0xAF, 0xA6, 0xB7, 0xA5, 0xBC, 0x7E, 0xBD,
+    0x70, 0x7E, 0xA1, 0x87, 0xA1, 0xC6, 0x7E, 0xCE, 0x71, 0x6D, 0xB7, 0x6C,
+    0x6A, 0xA3, 0x61, 0x73, 0x55, 0x4B, 0x96, 0x83, 0x89, 0x90, 0x8C, 0x44,
+    0x5A, 0x91, 0x7C, 0x52, 0x6D, 0x54, 0x34, 0x7A, 0x48, 0x71, 0x66, 0xA4,
+    0x6A, 0xA9, 0x99, 0x57, 0xB5, 0xA9, 0x8C, 0xB7, 0xBD, 0xA2, 0x8A, 0x76,
+    0x78, 0xAF, 0xA6, 0x89, 0xC2, 0x76, 0xA6, 0x70, 0x68, 0x9E, 0x9D, 0x67,
+    0x7B, 0x85, 0x4D, 0x83, 0x6E, 0x58, 0x5F, 0x50, 0x66, 0x69, 0x46, 0x88,
+    0x5F, 0x7B, 0x4A, 0x50, 0x51, 0x94, 0x7C, 0x91, 0x92, 0xA6, 0x70, 0x6E,
+    0x92, 0xAF, 0xAC, 0x83, 0xB5, 0xA8, 0xBA, 0xB1, 0x75, 0x9B, 0x7A, 0xAA,
+    0x7F, 0x9C, 0x75, 0x71, 0x64, 0x64, 0x65, 0x86, 0x70, 0x8B, 0x70, 0x97,
+    0x95, 0x53, 0x60, 0x6B, 0x61, 0x5C, 0x45, 0x53, 0x81, 0x83, 0x64, 0x77,
+    0x75, 0x6C, 0x7C, 0x73, 0x9A, 0x69, 0x68, 0x94, 0x76, 0x8C, 0xA9, 0x96,
+    0x84, 0x6F, 0xB0, 0x9F, 0xB6, 0xB6, 0x80, 0xAE, 0x7C, 0xB3, 0x92, 0x8D,
+    0x73, 0x71, 0xA4, 0x9E, 0x65, 0x91, 0x92, 0x9B, 0x83, 0x7E, 0x59, 0x5F,
+    0x75, 0x76, 0x8F, 0x6C, 0x5C, 0x66, 0x73, 0x7F, 0x7C, 0x90, 0x60, 0x7F,
+    0x8B, 0x5B, 0x87, 0x87, 0x71, 0x74, 0xA0, 0xA9, 0xA5, 0x94, 0xAC, 0x75,
+    0x8E, 0x80, 0x99, 0x9A, 0xA7, 0x99, 0x9B, 0x8B, 0xA8, 0x80, 0x9D, 0x9A,
+    0xA1, 0x93, 0x72, 0x6A, 0x8D, 0x7E, 0x92, 0x61, 0x7F, 0x7E, 0x66, 0x5A,
+    0x5D, 0x88, 0x6A, 0x73, 0x7D, 0x5E, 0x82, 0x77, 0x90, 0x73, 0x7A, 0x82,
+    0x9A, 0x7B, 0x93, 0x8B, 0x84, 0x8F, 0x73, 0x8D, 0x8A, 0x84, 0x9E, 0xA0,
+    0x8B, 0x93, 0x81, 0x97, 0x8B, 0x80, 0x71, 0x97, 0x6E, 0x86, 0x7B, 0x7C,
+    0x86, 0x92, 0x79, 0x74, 0x7E, 0x6A, 0x5C, 0x84, 0x8D, 0x6A, 0x67, 0x7F,
+    0x86, 0x5E, 0x81, 0x61, 0x80, 0x7B, 0x7D, 0x94, 0x93, 0x9A, 0x6C, 0x9B,
+    0x8C, 0x9E, 0x82, 0xA1, 0x9A, 0xA2, 0x74, 0x91, 0xA0, 0x83, 0x99, 0x9F,
+    0x88, 0x95, 0x93, 0x80, 0x75, 0x86, 0x78, 0x6C, 0x6C, 0x71, 0x8D, 0x69,
+    0x65, 0x7D, 0x6F, 0x73, 0x74, 0x64, 0x8B, 0x7B, 0x79, 0x7B, 0x63, 0x86,
+    0x89, 0x87, 0x85, 0x6B, 0x8B, 0x76, 0x95, 0x97, 0x94, 0x7C, 0x7B, 0x82,
+    0x97, 0x76, 0x8F, 0x97, 0x83, 0x77, 0x76, 0x8E, 0x7A, 0x84, 0x79, 0x75,
+    0x80, 0x92, 0x8A, 0x6F, 0x84, 0x76, 0x78, 0x76, 0x85, 0x79, 0x6A, 0x6F,
+    0x76, 0x77, 0x87, 0x75, 0x84, 0x6F, 0x7F, 0x89, 0x8B, 0x76, 0x6F, 0x6E,
+    0x8C, 0x88, 0x88, 0x73, 0x71, 0x87, 0x73, 0x97, 0x86, 0x75, 0x78, 0x85,
+    0x84, 0x76, 0x7B, 0x78, 0x7A, 0x82, 0x8B, 0x75, 0x8F, 0x77, 0x74, 0x78,
+    0x8B, 0x76, 0x78, 0x71, 0x74, 0x6E, 0x85, 0x7B, 0x70, 0x6B, 0x85, 0x6C,
+    0x6D, 0x74, 0x88, 0x79, 0x81, 0x78, 0x8A, 0x8D, 0x85, 0x7D, 0x89, 0x7D,
+    0x93, 0x8D, 0x92, 0x8D, 0x8F, 0x78, 0x84, 0x8F, 0x7F, 0x7D, 0x77, 0x83,
+    0x84, 0x7F, 0x79, 0x7B, 0x74, 0x79, 0x7B, 0x7C, 0x82, 0x85, 0x6E, 0x73,
+    0x83, 0x79, 0x79, 0x7D, 0x6B, 0x85, 0x86, 0x7F, 0x6D, 0x7D, 0x7E, 0x86,
+    0x71, 0x71, 0x84, 0x7B, 0x73, 0x84, 0x7E, 0x84, 0x76, 0x8A, 0x8E, 0x78,
+    0x79, 0x86, 0x7E, 0x85, 0x8F, 0x92, 0x78, 0x8B, 0x78, 0x7E, 0x81, 0x80,
+    0x79, 0x76, 0x8E, 0x7F, 0x73, 0x7D, 0x81, 0x89, 0x86, 0x74, 0x89, 0x82,
+    0x7D, 0x72, 0x87, 0x71, 0x7F, 0x79, 0x6F, 0x7D, 0x89, 0x74, 0x84, 0x88,
+    0x8A, 0x83, 0x80, 0x8B, 0x7B, 0x83, 0x89, 0x79, 0x85, 0x89, 0x8B, 0x84,
+    0x90, 0x79, 0x84, 0x8A, 0x79, 0x89, 0x8A, 0x7F, 0x8C, 0x80, 0x7C, 0x8A,
+    0x7A, 0x77, 0x75, 0x7A, 0x7E, 0x7E, 0x80, 0x7B, 0x7B, 0x76, 0x74, 0x71,
+    0x73, 0x83, 0x76, 0x86, 0x84, 0x84, 0x89, 0x7D, 0x88, 0x7C, 0x75, 0x78,
+    0x78, 0x82, 0x79, 0x78, 0x86, 0x8A, 0x82, 0x83, 0x8D, 0x7D, 0x89, 0x7A,
+    0x83, 0x81, 0x7E, 0x8C, 0x8B, 0x8B, 0x86, 0x77, 0x88, 0x81, 0x7B, 0x7C,
+    0x81, 0x81, 0x86, 0x84, 0x74, 0x85, 0x73, 0x7B, 0x75, 0x73, 0x85, 0x87,
+    0x77, 0x7C, 0x75, 0x79, 0x7E, 0x77, 0x77, 0x80, 0x7F, 0x89, 0x88, 0x86,
+    0x84, 0x89, 0x7E, 0x7C, 0x7D, 0x7E, 0x89, 0x8B, 0x89, 0x8A, 0x84, 0x89,
+    0x87, 0x81, 0x7C, 0x87, 0x7E, 0x82, 0x80, 0x7F, 0x86, 0x77, 0x78, 0x82,
+    0x7B, 0x7D, 0x7A, 0x84, 0x77, 0x7E, 0x81, 0x82, 0x86, 0x76, 0x80, 0x79,
+    0x81, 0x7C, 0x80, 0x82, 0x85, 0x87, 0x7F, 0x82, 0x86, 0x8A, 0x7B, 0x85,
+    0x85, 0x86, 0x7C, 0x82, 0x7E, 0x85, 0x7D, 0x83, 0x82, 0x87, 0x88, 0x7B,
+    0x7D, 0x86, 0x7B, 0x85, 0x7B, 0x7E, 0x78, 0x79, 0x7F, 0x85, 0x78, 0x7F,
+    0x7B, 0x77, 0x80, 0x77, 0x85, 0x83, 0x86, 0x7A, 0x78, 0x7A, 0x80, 0x7F,
+    0x7C, 0x7C, 0x7A, 0x7C, 0x84, 0x7C, 0x80, 0x85, 0x7B, 0x88, 0x7E, 0x83,
+    0x7E, 0x80, 0x85, 0x7C, 0x7F, 0x86, 0x86, 0x86, 0x81, 0x7A, 0x7A, 0x85,
+    0x84, 0x83, 0x7F, 0x7F, 0x84, 0x82, 0x7E, 0x78, 0x78, 0x7D, 0x7C, 0x7D,
+    0x79, 0x84, 0x7B, 0x7B, 0x7D, 0x7F, 0x80, 0x7B, 0x7A, 0x82, 0x82, 0x81,
+    0x7C, 0x81, 0x84, 0x81, 0x84, 0x7D, 0x86, 0x87, 0x82, 0x7D, 0x81, 0x87,
+    0x84, 0x84, 0x87, 0x7B, 0x7B, 0x7B, 0x82, 0x81, 0x7A, 0x7A, 0x82, 0x84,
+    0x7C, 0x7B, 0x79, 0x81, 0x7B, 0x82, 0x7B, 0x83, 0x83, 0x82, 0x7C, 0x84,
+    0x83, 0x7F, 0x7F, 0x7E, 0x81, 0x7F, 0x80, 0x7F, 0x81, 0x7C, 0x81, 0x7C,
+    0x86, 0x7E, 0x81, 0x7E, 0x84, 0x7E, 0x86, 0x80, 0x86, 0x7E, 0x7C, 0x83,
+    0x85, 0x7B, 0x7D, 0x7F, 0x81, 0x7E, 0x84, 0x7E, 0x7C, 0x7E, 0x7E, 0x7E,
+    0x7F, 0x7F, 0x80, 0x7D, 0x81, 0x83, 0x82, 0x82, 0x83, 0x82, 0x81, 0x84,
+    0x7D, 0x7C, 0x84, 0x81, 0x7C, 0x85, 0x84, 0x85, 0x80, 0x7E, 0x7D, 0x82,
+    0x82, 0x85, 0x80, 0x82, 0x7F, 0x80, 0x82, 0x84, 0x81, 0x84, 0x84, 0x7C,
+    0x7C, 0x7C, 0x7C, 0x7F, 0x83, 0x82, 0x81, 0x7D, 0x80, 0x7B, 0x7E, 0x7D,
+    0x7D, 0x7B, 0x81, 0x7F, 0x81, 0x7C, 0x7F, 0x80, 0x81, 0x84, 0x84, 0x82,
+    0x80, 0x82, 0x7D, 0x7F, 0x81, 0x80, 0x82, 0x83, 0x7F, 0x84, 0x82, 0x81,
+    0x7E, 0x7D, 0x7E, 0x7E, 0x7E, 0x7F, 0x84, 0x7C, 0x80, 0x83, 0x81, 0x83,
+    0x7F, 0x7E, 0x83, 0x82, 0x83, 0x81, 0x7E, 0x7D, 0x7F, 0x82, 0x7D, 0x7C,
+    0x7E, 0x7D, 0x7D, 0x7D, 0x83, 0x7D, 0x7D, 0x7E, 0x84, 0x81, 0x82, 0x84,
+    0x82, 0x82, 0x81, 0x82, 0x82, 0x83, 0x82, 0x7F, 0x82, 0x81, 0x7F, 0x7E,
+    0x84, 0x82, 0x80, 0x83,
+};
+
+static const DacSample SNARE = { SNARE_DATA, sizeof(SNARE_DATA), 8000 };
+
+static const u8 CLOSED_HAT_DATA[] = {
+    0x84, 0x78, 0x4E, 0xD0, 0x46, 0x6C, 0xE8, 0x4B, 0x83, 0xB3, 0x3B, 0xB6,
+    0x2B, 0xCC, 0x86, 0x4A, 0x94, 0x87, 0x47, 0x85, 0xCD, 0x7C, 0x59, 0xBD,
+    0x2F, 0x9F, 0x8A, 0x6A, 0x7A, 0xB0, 0x73, 0x6F, 0x93, 0x64, 0x6F, 0x90,
+    0x6E, 0xB8, 0x6E, 0x79, 0x85, 0x90, 0x89, 0x6F, 0x68, 0x63, 0x96, 0x6F,
+    0xA1, 0x67, 0x95, 0x74, 0x9C, 0x6A, 0x9C, 0x4C, 0x7A, 0xBD, 0x76, 0x91,
+    0x50, 0xA7, 0x92, 0x3C, 0x86, 0x8C, 0x7D, 0xAD, 0x54, 0x86, 0x7B, 0xAC,
+    0x43, 0xA8, 0x85, 0x6C, 0x69, 0xBD, 0x78, 0x74, 0x8F, 0x71, 0x84, 0x84,
+    0x7F, 0x6B, 0x7F, 0x74, 0x92, 0x68, 0xB2, 0x50, 0x91, 0x75, 0x92, 0x7A,
+    0x6D, 0x97, 0x94, 0x60, 0x87, 0x76, 0x95, 0x71, 0x96, 0x63, 0x76, 0x8E,
+    0x79, 0x90, 0x73, 0x7B, 0x9D, 0x6E, 0xA0, 0x71, 0x7A, 0x79, 0x7A, 0x81,
+    0x81, 0x90, 0x6C, 0x7E, 0x83, 0x7D, 0x9F, 0x77, 0x65, 0x8E, 0x87, 0x77,
+    0x94, 0x80, 0x79, 0x72, 0x8A, 0x81, 0x7B, 0x75, 0x84, 0x82, 0x7D, 0x81,
+    0x8C, 0x70, 0x83, 0x90, 0x84, 0x67, 0x88, 0x94, 0x72, 0x91, 0x7E, 0x79,
+    0x6E, 0x82, 0x92, 0x67, 0x9E, 0x6C, 0x93, 0x6F, 0x91, 0x66, 0x7E, 0x9D,
+    0x7A, 0x79, 0x89, 0x7F, 0x7D, 0x6A, 0x8B, 0x78, 0x82, 0x8F, 0x6F, 0x82,
+    0x8F, 0x7E, 0x89, 0x71, 0x81, 0x79, 0x85, 0x80, 0x81, 0x8D, 0x6D, 0x87,
+    0x82, 0x8A, 0x7F, 0x7D, 0x85, 0x7C, 0x78, 0x76, 0x89, 0x89, 0x85, 0x75,
+    0x76, 0x94, 0x6D, 0x8D, 0x76, 0x90, 0x7B, 0x80, 0x79, 0x7A, 0x8F, 0x7A,
+    0x87, 0x70, 0x90, 0x7A, 0x84, 0x70, 0x88, 0x7B, 0x8A, 0x80, 0x7B, 0x85,
+    0x74, 0x91, 0x70, 0x87, 0x79, 0x82, 0x7F, 0x8B, 0x82, 0x80, 0x7E, 0x82,
+    0x77, 0x88, 0x79, 0x7E, 0x88, 0x82, 0x79, 0x7E, 0x7D, 0x7E, 0x87, 0x85,
+    0x75, 0x89, 0x7F, 0x80, 0x77, 0x86, 0x7E, 0x7C, 0x86, 0x7A, 0x85, 0x83,
+    0x82, 0x7E, 0x7A, 0x8B, 0x7A, 0x7C, 0x80, 0x89, 0x76, 0x8A, 0x74, 0x8A,
+    0x81, 0x7B, 0x7E, 0x80, 0x84, 0x78, 0x8A, 0x80, 0x7B, 0x85, 0x7C, 0x85,
+    0x76, 0x89, 0x7F, 0x7F, 0x7B, 0x82, 0x81, 0x81, 0x79, 0x80, 0x80, 0x86,
+    0x7A, 0x88, 0x7D, 0x82, 0x7D, 0x80, 0x7D, 0x80, 0x89, 0x7D, 0x80, 0x7C,
+    0x7E, 0x87, 0x81, 0x7F, 0x78, 0x80, 0x87, 0x7B, 0x86, 0x80, 0x7E, 0x7F,
+    0x7E, 0x85, 0x7D, 0x81, 0x80, 0x81, 0x80, 0x7C, 0x85, 0x7F, 0x80, 0x7D,
+    0x7F, 0x82, 0x82, 0x81, 0x7C, 0x80, 0x81, 0x81, 0x81, 0x7E, 0x81, 0x7D,
+    0x81, 0x84, 0x7B, 0x86, 0x7F, 0x7F, 0x81, 0x7C, 0x80, 0x7F, 0x84, 0x7D,
+    0x84, 0x7C, 0x7F, 0x82, 0x7D, 0x83, 0x7E, 0x84, 0x7D, 0x7D, 0x82, 0x82,
+    0x80, 0x7F, 0x80, 0x82, 0x80, 0x7E, 0x81, 0x7F, 0x7F, 0x81, 0x81, 0x80,
+    0x7D, 0x83, 0x81, 0x7C, 0x80, 0x82, 0x80, 0x80, 0x7F, 0x81, 0x83, 0x7F,
+    0x7E, 0x7F, 0x83, 0x7F,
+};
+
+static const DacSample CLOSED_HAT
+    = { CLOSED_HAT_DATA, sizeof(CLOSED_HAT_DATA), 8000 };
+
+static const u8 OPEN_HAT_DATA[] = {
+    0x68, 0x85, 0x5A, 0xD9, 0x6B, 0x4D, 0x7E, 0x99, 0x91, 0x6E, 0xAC, 0x74,
+    0x9D, 0x43, 0xC0, 0x6B, 0x33, 0xA9, 0x44, 0xC4, 0xA0, 0x35, 0xD7, 0x38,
+    0x9F, 0x91, 0x94, 0x52, 0x6D, 0x98, 0x90, 0xA6, 0x4B, 0x9B, 0x67, 0x89,
+    0x6C, 0x65, 0x83, 0xB5, 0x2C, 0xE5, 0x48, 0x6A, 0xDC, 0x13, 0x8C, 0xB4,
+    0x73, 0x85, 0x89, 0x7B, 0x82, 0xA5, 0x7B, 0x70, 0x2F, 0xB7, 0x4E, 0xE2,
+    0x76, 0x5B, 0x6F, 0x7C, 0x66, 0xAA, 0x97, 0x9B, 0x7F, 0x6C, 0x4C, 0x6D,
+    0xB8, 0x8F, 0x34, 0x8F, 0xB0, 0x3F, 0x95, 0xD8, 0x75, 0x54, 0x8C, 0x82,
+    0x45, 0x76, 0xDF, 0x42, 0xBD, 0x73, 0x66, 0x69, 0x7A, 0x6C, 0x8A, 0xA3,
+    0x6E, 0x65, 0xD6, 0x2D, 0x85, 0x87, 0xBD, 0x7C, 0x6F, 0xA1, 0x61, 0x9C,
+    0x4F, 0x82, 0xA1, 0x89, 0x3C, 0xBE, 0x83, 0x5D, 0x6E, 0xBF, 0x76, 0x38,
+    0x79, 0xC3, 0x3F, 0x7C, 0xBD, 0x73, 0xA3, 0x4F, 0x68, 0xA4, 0xB2, 0x3D,
+    0x92, 0x93, 0x52, 0xC1, 0x41, 0xCF, 0x25, 0xC7, 0x53, 0x7E, 0xBC, 0x3F,
+    0x87, 0xA4, 0x89, 0x37, 0xDB, 0x66, 0x46, 0xD5, 0x3E, 0x8B, 0x95, 0x44,
+    0xD0, 0x76, 0x90, 0x64, 0x77, 0x7C, 0x99, 0x36, 0xCE, 0x6C, 0x95, 0x84,
+    0x5C, 0xA5, 0x4C, 0xB7, 0x37, 0xBD, 0x4E, 0xA8, 0x53, 0x91, 0x97, 0x96,
+    0x55, 0x71, 0x9B, 0x93, 0x7A, 0x6B, 0x96, 0x7D, 0x82, 0x67, 0xA1, 0x6A,
+    0x71, 0x75, 0xC7, 0x7B, 0x2B, 0xB6, 0x49, 0x82, 0xC7, 0x79, 0x44, 0x7A,
+    0x96, 0x9A, 0x6B, 0xB1, 0x5A, 0x72, 0xA6, 0x9B, 0x38, 0xB0, 0x66, 0xA1,
+    0x5B, 0x69, 0xA7, 0x4E, 0xC9, 0x72, 0x62, 0x66, 0x81, 0x7C, 0xB6, 0x55,
+    0xBA, 0x88, 0x7A, 0x83, 0x82, 0x82, 0x3A, 0xCC, 0x60, 0x58, 0xAA, 0x6E,
+    0x76, 0xB8, 0x3B, 0x88, 0x93, 0xAA, 0x38, 0xC0, 0x64, 0x9B, 0x7E, 0x8E,
+    0x83, 0x72, 0x86, 0x86, 0x30, 0xA0, 0xAE, 0x4D, 0xA2, 0x49, 0x9A, 0x8F,
+    0x72, 0x97, 0x93, 0x5C, 0xA7, 0x6E, 0x6D, 0xAA, 0x54, 0x81, 0x5B, 0xA1,
+    0xAA, 0x4B, 0x7A, 0x81, 0x81, 0xB4, 0x60, 0x74, 0x98, 0x98, 0x4D, 0x74,
+    0x81, 0xB0, 0x53, 0xB1, 0x68, 0x70, 0x91, 0x64, 0x94, 0x7A, 0x66, 0xAD,
+    0x55, 0x82, 0x7E, 0xC5, 0x3C, 0xA8, 0x67, 0xB6, 0x65, 0x9A, 0x82, 0x76,
+    0x48, 0x8C, 0xB1, 0x45, 0x85, 0x99, 0x7A, 0x71, 0xA7, 0x7E, 0x79, 0x91,
+    0x7A, 0x77, 0x8E, 0x6C, 0x66, 0xA4, 0x98, 0x41, 0xA6, 0x5C, 0xB5, 0x4D,
+    0xB7, 0x74, 0x48, 0x95, 0x69, 0xC5, 0x5B, 0x65, 0xB4, 0x4C, 0xBC, 0x41,
+    0x87, 0x7E, 0xA7, 0x7B, 0x90, 0x82, 0x5D, 0xA8, 0x85, 0x76, 0x8A, 0x4C,
+    0x80, 0x73, 0xA9, 0x8F, 0x61, 0x87, 0x94, 0x60, 0x6C, 0xB3, 0x47, 0x8E,
+    0x7E, 0xA6, 0x81, 0x6D, 0x89, 0x71, 0x6D, 0xBB, 0x4A, 0x7C, 0x93, 0xA6,
+    0x7F, 0x63, 0x9F, 0x5D, 0x8B, 0x8D, 0x64, 0x7F, 0xA7, 0x7F, 0x54, 0xA6,
+    0x70, 0x60, 0x7C, 0x87, 0x98, 0x95, 0x5D, 0x86, 0x6C, 0xB8, 0x72, 0x5E,
+    0x8E, 0x7C, 0x90, 0x8A, 0x7D, 0x88, 0x65, 0x6B, 0x93, 0x68, 0xB8, 0x45,
+    0x81, 0xA4, 0x81, 0x8E, 0x5D, 0x9D, 0x6B, 0x74, 0xA3, 0x86, 0x67, 0x87,
+    0x5E, 0xBF, 0x4D, 0x7B, 0x9F, 0x97, 0x57, 0xA5, 0x56, 0x8C, 0x89, 0x82,
+    0x72, 0x96, 0x71, 0x8C, 0x72, 0x9E, 0x59, 0xA9, 0x55, 0x8B, 0x67, 0xAD,
+    0x51, 0xAE, 0x6E, 0x89, 0x87, 0x83, 0x86, 0x73, 0x75, 0x81, 0x84, 0x91,
+    0x65, 0x94, 0x5A, 0x98, 0x65, 0xA6, 0x81, 0x8C, 0x7E, 0x8A, 0x60, 0x88,
+    0x7A, 0x72, 0x81, 0x8B, 0x7D, 0x83, 0x76, 0x73, 0x9C, 0x62, 0x9C, 0x7C,
+    0x7B, 0xA3, 0x4D, 0x9C, 0x8D, 0x84, 0x6A, 0x7A, 0x8B, 0x95, 0x4C, 0x8A,
+    0x87, 0x8F, 0x6D, 0x74, 0x7D, 0x8B, 0x97, 0x63, 0x84, 0x82, 0x85, 0x78,
+    0xAD, 0x59, 0x88, 0x8D, 0x64, 0x87, 0x98, 0x74, 0x87, 0x70, 0x77, 0x8E,
+    0x97, 0x79, 0x76, 0x77, 0x8E, 0x81, 0x71, 0x9F, 0x83, 0x4E, 0xB0, 0x78,
+    0x74, 0x63, 0xAC, 0x7F, 0x5A, 0x90, 0x9B, 0x5D, 0x93, 0x96, 0x5F, 0x8E,
+    0x7A, 0x76, 0xA3, 0x4D, 0x9A, 0x6D, 0xA2, 0x7B, 0x70, 0x8E, 0x5F, 0x9F,
+    0x76, 0x78, 0x99, 0x82, 0x5B, 0xAA, 0x82, 0x72, 0x74, 0x96, 0x5E, 0x9B,
+    0x70, 0x6C, 0x7E, 0x82, 0x98, 0x73, 0xA4, 0x72, 0x64, 0x81, 0x91, 0x80,
+    0x8F, 0x85, 0x61, 0x75, 0x83, 0x9A, 0x7D, 0x73, 0x8E, 0x85, 0x8C, 0x74,
+    0x77, 0x81, 0x7E, 0x87, 0x6F, 0x9A, 0x7A, 0x85, 0x82, 0x7F, 0x5E, 0x95,
+    0x65, 0x94, 0x6D, 0x8C, 0x92, 0x75, 0x86, 0x67, 0x96, 0x7A, 0x80, 0x92,
+    0x8A, 0x74, 0x64, 0xA8, 0x6A, 0x6D, 0xA3, 0x70, 0x85, 0x69, 0x9F, 0x7A,
+    0x7F, 0x67, 0x87, 0x9A, 0x5B, 0xAD, 0x54, 0x9A, 0x8F, 0x81, 0x70, 0x64,
+    0x96, 0x6D, 0x8C, 0x73, 0x89, 0x83, 0x80, 0x7A, 0x81, 0x99, 0x7E, 0x6D,
+    0x99, 0x80, 0x78, 0x6B, 0x7A, 0x90, 0x92, 0x79, 0x69, 0x8F, 0x7C, 0x95,
+    0x81, 0x5C, 0x84, 0x96, 0x66, 0x9A, 0x79, 0x7F, 0x8C, 0x76, 0x83, 0x89,
+    0x7F, 0x79, 0x84, 0x75, 0x91, 0x7E, 0x63, 0x7E, 0x9E, 0x62, 0x89, 0x7B,
+    0x8E, 0x8E, 0x76, 0x92, 0x63, 0x81, 0x90, 0x62, 0x89, 0x86, 0x7A, 0x7E,
+    0x9B, 0x74, 0x85, 0x64, 0x8E, 0x7D, 0x90, 0x77, 0x96, 0x65, 0x7D, 0x95,
+    0x73, 0x7A, 0x79, 0x88, 0x77, 0x96, 0x71, 0x84, 0x90, 0x72, 0x71, 0x80,
+    0x89, 0x9B, 0x72, 0x8A, 0x84, 0x7A, 0x7C, 0x86, 0x65, 0x7F, 0x9A, 0x63,
+    0xA0, 0x7B, 0x87, 0x72, 0x71, 0x93, 0x87, 0x7C, 0x88, 0x5D, 0x9E, 0x76,
+    0x92, 0x61, 0x95, 0x71, 0x90, 0x7A, 0x80, 0x75, 0x82, 0x75, 0x7F, 0xA0,
+    0x79, 0x72, 0x89, 0x89, 0x79, 0x68, 0x91, 0x82, 0x86, 0x7E, 0x87, 0x83,
+    0x66, 0x8C, 0x8C, 0x76, 0x6F, 0x93, 0x6C, 0x8F, 0x77, 0x8A, 0x8B, 0x67,
+    0x9F, 0x61, 0x98, 0x6B, 0x98, 0x6E, 0x94, 0x7B, 0x73, 0x7A, 0x7F, 0x80,
+    0x93, 0x65, 0xA1, 0x81, 0x74, 0x8B, 0x69, 0x81, 0x84, 0x84, 0x71, 0x9D,
+    0x61, 0x7D, 0x96, 0x73, 0x96, 0x84, 0x78, 0x73, 0x83, 0x90, 0x6E, 0x7E,
+    0x86, 0x80, 0x7A, 0x90, 0x68, 0x96, 0x89, 0x66, 0x89, 0x88, 0x79, 0x7E,
+    0x81, 0x74, 0x91, 0x70, 0x97, 0x7C, 0x73, 0x7A, 0x80, 0x9A, 0x6F, 0x90,
+    0x79, 0x6E, 0x84, 0x7F, 0x91, 0x6F, 0x7A, 0x8C, 0x75, 0x80, 0x8A, 0x81,
+    0x8A, 0x76, 0x79, 0x7E, 0x9B, 0x75, 0x89, 0x66, 0x83, 0x8E, 0x84, 0x84,
+    0x6A, 0x94, 0x81, 0x79, 0x71, 0x87, 0x7C, 0x92, 0x72, 0x93, 0x7E, 0x64,
+    0x96, 0x7A, 0x77, 0x8B, 0x82, 0x73, 0x7D, 0x8D, 0x7F, 0x78, 0x8D, 0x72,
+    0x8C, 0x85, 0x6B, 0x7F, 0x90, 0x74, 0x8F, 0x6C, 0x82, 0x94, 0x72, 0x95,
+    0x7E, 0x65, 0x9D, 0x71, 0x78, 0x83, 0x81, 0x8B, 0x82, 0x81, 0x78, 0x73,
+    0x8A, 0x75, 0x88, 0x8A, 0x71, 0x91, 0x7C, 0x71, 0x8A, 0x8B, 0x7E, 0x6F,
+    0x84, 0x82, 0x91, 0x80, 0x7D, 0x6A, 0x96, 0x76, 0x75, 0x80, 0x9A, 0x70,
+    0x87, 0x75, 0x8F, 0x7A, 0x7C, 0x80, 0x88, 0x80, 0x76, 0x92, 0x68, 0x96,
+    0x7D, 0x75, 0x8B, 0x75, 0x75, 0x96, 0x7C, 0x6D, 0x87, 0x95, 0x7F, 0x6A,
+    0x7C, 0x99, 0x83, 0x67, 0x88, 0x83, 0x78, 0x8C, 0x85, 0x6A, 0x8F, 0x7B,
+    0x76, 0x95, 0x7C, 0x7C, 0x72, 0x8F, 0x82, 0x7E, 0x7E, 0x88, 0x83, 0x6C,
+    0x82, 0x7F, 0x7D, 0x83, 0x84, 0x87, 0x7D, 0x76, 0x7F, 0x8D, 0x72, 0x95,
+    0x79, 0x86, 0x73, 0x7E, 0x7E, 0x88, 0x81, 0x79, 0x8D, 0x76, 0x79, 0x97,
+    0x7F, 0x6C, 0x84, 0x90, 0x74, 0x8C, 0x72, 0x7B, 0x8E, 0x84, 0x83, 0x6C,
+    0x92, 0x6C, 0x88, 0x8E, 0x81, 0x72, 0x86, 0x85, 0x6C, 0x8C, 0x76, 0x80,
+    0x8E, 0x71, 0x82, 0x7D, 0x89, 0x80, 0x78, 0x95, 0x6B, 0x97, 0x6A, 0x85,
+    0x8A, 0x78, 0x82, 0x7F, 0x79, 0x87, 0x87, 0x72, 0x84, 0x89, 0x73, 0x81,
+    0x8E, 0x7D, 0x7C, 0x7E, 0x83, 0x80, 0x7B, 0x81, 0x7E, 0x85, 0x8D, 0x7A,
+    0x84, 0x74, 0x87, 0x7D, 0x7C, 0x88, 0x74, 0x8E, 0x7F, 0x7C, 0x85, 0x7A,
+    0x85, 0x82, 0x7F, 0x80, 0x78, 0x79, 0x82, 0x89, 0x77, 0x80, 0x8D, 0x73,
+    0x84, 0x87, 0x71, 0x87, 0x7F, 0x85, 0x78, 0x7F, 0x90, 0x84, 0x7F, 0x7E,
+    0x7A, 0x86, 0x6F, 0x85, 0x7A, 0x8B, 0x7E, 0x7B, 0x8A, 0x7C, 0x7B, 0x7E,
+    0x90, 0x71, 0x7F, 0x8D, 0x82, 0x7E, 0x75, 0x85, 0x78, 0x80, 0x82, 0x7D,
+    0x91, 0x7F, 0x79, 0x89, 0x7D, 0x76, 0x8C, 0x6F, 0x88, 0x7F, 0x78, 0x87,
+    0x79, 0x90, 0x7F, 0x83, 0x7E, 0x73, 0x8D, 0x77, 0x8B, 0x6E, 0x8C, 0x75,
+    0x93, 0x76, 0x81, 0x87, 0x7F, 0x83, 0x82, 0x6E, 0x8F, 0x7C, 0x76, 0x81,
+    0x7C, 0x86, 0x7B, 0x85, 0x8B, 0x7D, 0x77, 0x7D, 0x84, 0x85, 0x75, 0x83,
+    0x83, 0x84, 0x89, 0x6E, 0x90, 0x7D, 0x7F, 0x84, 0x75, 0x8A, 0x82, 0x81,
+    0x72, 0x8A, 0x7C, 0x82, 0x82, 0x82, 0x73, 0x8B, 0x81, 0x7C, 0x82, 0x77,
+    0x82, 0x83, 0x7C, 0x80, 0x8B, 0x72, 0x7E, 0x87, 0x81, 0x7D, 0x8B, 0x74,
+    0x87, 0x85, 0x7F, 0x70, 0x8D, 0x7C, 0x89, 0x72, 0x7D, 0x8B, 0x77, 0x8F,
+    0x7D, 0x76, 0x87, 0x7A, 0x8C, 0x6E, 0x82, 0x8D, 0x83, 0x7D, 0x82, 0x73,
+    0x8E, 0x7D, 0x7E, 0x78, 0x8B, 0x79, 0x7A, 0x8D, 0x7D, 0x74, 0x8B, 0x82,
+    0x7A, 0x87, 0x75, 0x7C, 0x86, 0x7D, 0x85, 0x79, 0x8C, 0x80, 0x7D, 0x7B,
+    0x8A, 0x79, 0x86, 0x82, 0x7D, 0x79, 0x82, 0x89, 0x7E, 0x74, 0x85, 0x80,
+    0x8A, 0x71, 0x85, 0x82, 0x85, 0x74, 0x8E, 0x7C, 0x7B, 0x7B, 0x8D, 0x7F,
+    0x7F, 0x81, 0x77, 0x83, 0x88, 0x71, 0x8D, 0x7A, 0x7A, 0x87, 0x7A, 0x89,
+    0x7E, 0x7A, 0x8B, 0x7F, 0x7D, 0x7C, 0x7E, 0x80, 0x87, 0x84, 0x7A, 0x80,
+    0x7E, 0x85, 0x7C, 0x7C, 0x81, 0x8B, 0x75, 0x8D, 0x78, 0x7A, 0x84, 0x88,
+    0x75, 0x87, 0x77, 0x8A, 0x7B, 0x80, 0x83, 0x82, 0x82, 0x72, 0x89, 0x7F,
+    0x87, 0x72, 0x8C, 0x76, 0x86, 0x80, 0x7B, 0x7D, 0x81, 0x7F, 0x89, 0x76,
+    0x88, 0x84, 0x7B, 0x84, 0x78, 0x81, 0x7D, 0x88, 0x7D, 0x7A, 0x85, 0x7F,
+    0x80, 0x85, 0x7A, 0x85, 0x7F, 0x84, 0x79, 0x88, 0x80, 0x77, 0x7D, 0x86,
+    0x7A, 0x8B, 0x77, 0x7E, 0x82, 0x86, 0x82, 0x75, 0x81, 0x7F, 0x89, 0x82,
+    0x81, 0x78, 0x84, 0x78, 0x82, 0x80, 0x80, 0x83, 0x84, 0x84, 0x7C, 0x83,
+    0x7C, 0x85, 0x74, 0x83, 0x88, 0x75, 0x8B, 0x81, 0x75, 0x8A, 0x80, 0x7F,
+    0x76, 0x82, 0x89, 0x7B, 0x7B, 0x82, 0x81, 0x85, 0x79, 0x7C, 0x8A, 0x76,
+    0x86, 0x80, 0x7C, 0x7D, 0x8A, 0x82, 0x79, 0x82, 0x80, 0x81, 0x7E, 0x80,
+    0x85, 0x77, 0x8C, 0x7A, 0x7D, 0x80, 0x83, 0x7B, 0x87, 0x7D, 0x88, 0x77,
+    0x7D, 0x87, 0x84, 0x7A, 0x7A, 0x89, 0x82, 0x75, 0x86, 0x83, 0x81, 0x76,
+    0x83, 0x82, 0x7E, 0x82, 0x86, 0x79, 0x80, 0x87, 0x7A, 0x84, 0x80, 0x7B,
+    0x7D, 0x83, 0x7E, 0x81, 0x81, 0x7D, 0x87, 0x82, 0x7B, 0x80, 0x7B, 0x82,
+    0x7F, 0x80, 0x7F, 0x7E, 0x80, 0x87, 0x81, 0x83, 0x7C, 0x7F, 0x80, 0x7F,
+    0x82, 0x80, 0x82, 0x80, 0x7D, 0x7D, 0x7F, 0x89, 0x80, 0x77, 0x86, 0x78,
+    0x8B, 0x7B, 0x7C, 0x80, 0x82, 0x7D, 0x84, 0x81, 0x82, 0x79, 0x84, 0x81,
+    0x7F, 0x7C, 0x81, 0x82, 0x7F, 0x80, 0x89, 0x7B, 0x82, 0x81, 0x7E, 0x84,
+    0x78, 0x86, 0x7D, 0x80, 0x83, 0x7B, 0x86, 0x7E, 0x7A, 0x82, 0x87, 0x77,
+    0x83, 0x83, 0x7A, 0x81, 0x80, 0x81, 0x7F, 0x83, 0x81, 0x7A, 0x80, 0x80,
+    0x8A, 0x7A, 0x7C, 0x89, 0x7E, 0x7B, 0x85, 0x7D, 0x7E, 0x80, 0x80, 0x7E,
+    0x85, 0x7C, 0x87, 0x78, 0x84, 0x7F, 0x7C, 0x81, 0x88, 0x7A, 0x7F, 0x84,
+    0x7D, 0x82, 0x85, 0x7C, 0x7A, 0x83, 0x80, 0x7D, 0x86, 0x7D, 0x83, 0x81,
+    0x7A, 0x80, 0x89, 0x7A,
+};
+
+static const DacSample OPEN_HAT
+    = { OPEN_HAT_DATA, sizeof(OPEN_HAT_DATA), 8000 };
+
+const DacSample* const DAC_DRUM_SAMPLES[128] = {
+    /* 0 */ NULL,
+    /* 1 */ NULL,
+    /* 2 */ NULL,
+    /* 3 */ NULL,
+    /* 4 */ NULL,
+    /* 5 */ NULL,
+    /* 6 */ NULL,
+    /* 7 */ NULL,
+    /* 8 */ NULL,
+    /* 9 */ NULL,
+    /* 10 */ NULL,
+    /* 11 */ NULL,
+    /* 12 */ NULL,
+    /* 13 */ NULL,
+    /* 14 */ NULL,
+    /* 15 */ NULL,
+    /* 16 */ NULL,
+    /* 17 */ NULL,
+    /* 18 */ NULL,
+    /* 19 */ NULL,
+    /* 20 */ NULL,
+    /* 21 */ NULL,
+    /* 22 */ NULL,
+    /* 23 */ NULL,
+    /* 24 */ NULL,
+    /* 25 */ NULL,
+    /* 26 */ NULL,
+    /* 27 */ NULL,
+    /* 28 */ NULL,
+    /* 29 */ NULL,
+    /* 30 */ NULL,
+    /* 31 */ NULL,
+    /* 32 */ NULL,
+    /* 33 */ NULL,
+    /* 34 */ NULL,
+    /* 35 */ &KICK,
+    /* 36 */ &KICK,
+    /* 37 */ NULL,
+    /* 38 */ &SNARE,
+    /* 39 */ NULL,
+    /* 40 */ &SNARE,
+    /* 41 */ NULL,
+    /* 42 */ &CLOSED_HAT,
+    /* 43 */ NULL,
+    /* 44 */ &CLOSED_HAT,
+    /* 45 */ NULL,
+    /* 46 */ &OPEN_HAT,
+    /* 47 */ NULL,
+    /* 48 */ NULL,
+    /* 49 */ NULL,
+    /* 50 */ NULL,
+    /* 51 */ NULL,
+    /* 52 */ NULL,
+    /* 53 */ NULL,
+    /* 54 */ NULL,
+    /* 55 */ NULL,
+    /* 56 */ NULL,
+    /* 57 */ NULL,
+    /* 58 */ NULL,
+    /* 59 */ NULL,
+    /* 60 */ NULL,
+    /* 61 */ NULL,
+    /* 62 */ NULL,
+    /* 63 */ NULL,
+    /* 64 */ NULL,
+    /* 65 */ NULL,
+    /* 66 */ NULL,
+    /* 67 */ NULL,
+    /* 68 */ NULL,
+    /* 69 */ NULL,
+    /* 70 */ NULL,
+    /* 71 */ NULL,
+    /* 72 */ NULL,
+    /* 73 */ NULL,
+    /* 74 */ NULL,
+    /* 75 */ NULL,
+    /* 76 */ NULL,
+    /* 77 */ NULL,
+    /* 78 */ NULL,
+    /* 79 */ NULL,
+    /* 80 */ NULL,
+    /* 81 */ NULL,
+    /* 82 */ NULL,
+    /* 83 */ NULL,
+    /* 84 */ NULL,
+    /* 85 */ NULL,
+    /* 86 */ NULL,
+    /* 87 */ NULL,
+    /* 88 */ NULL,
+    /* 89 */ NULL,
+    /* 90 */ NULL,
+    /* 91 */ NULL,
+    /* 92 */ NULL,
+    /* 93 */ NULL,
+    /* 94 */ NULL,
+    /* 95 */ NULL,
+    /* 96 */ NULL,
+    /* 97 */ NULL,
+    /* 98 */ NULL,
+    /* 99 */ NULL,
+    /* 100 */ NULL,
+    /* 101 */ NULL,
+    /* 102 */ NULL,
+    /* 103 */ NULL,
+    /* 104 */ NULL,
+    /* 105 */ NULL,
+    /* 106 */ NULL,
+    /* 107 */ NULL,
+    /* 108 */ NULL,
+    /* 109 */ NULL,
+    /* 110 */ NULL,
+    /* 111 */ NULL,
+    /* 112 */ NULL,
+    /* 113 */ NULL,
+    /* 114 */ NULL,
+    /* 115 */ NULL,
+    /* 116 */ NULL,
+    /* 117 */ NULL,
+    /* 118 */ NULL,
+    /* 119 */ NULL,
+    /* 120 */ NULL,
+    /* 121 */ NULL,
+    /* 122 */ NULL,
+    /* 123 */ NULL,
+    /* 124 */ NULL,
+    /* 125 */ NULL,
+    /* 126 */ NULL,
+    /* 127 */ NULL,
+};
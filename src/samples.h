@@ -0,0 +1,12 @@
+#pragma once
+#include <types.h>
+
+typedef struct DacSample DacSample;
+
+struct DacSample {
+    const u8* data;
+    u16 length;
+    u16 rate;
+};
+
+extern const DacSample* const DAC_DRUM_SAMPLES[128];
@@ -1,5 +1,6 @@
 #include "scheduler.h"
 #include "everdrive_led.h"
+#include "midi.h"
 #include "midi_psg.h"
 #include "ui.h"
 #include "midi_receiver.h"
@@ -26,6 +27,7 @@ void scheduler_vsync(void)
 
 static void onFrame(void)
 {
+    midi_tick();
     midi_psg_tick();
     ui_update();
     everdrive_led_tick();
@@ -12,6 +12,9 @@ bool settings_debug_ticks(void);
 #define COMM_SERIAL 1
 #define COMM_MEGAWIFI 1
 
+/* Also streams the DAC drum samples; without it DAC drums are refused */
+#define YM2612_Z80_DRIVER 0
+
 #define DEBUG_MEGAWIFI_SEND 0
 #define DEBUG_MEGAWIFI_INIT 0
 #define DEBUG_MEGAWIFI_SYNC 0
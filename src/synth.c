@@ -1,19 +1,63 @@
 #include "synth.h"
 #include "bits.h"
+#include "settings.h"
+#include "ym_port.h"
+#include "z80_ym.h"
 #include <memory.h>
 #include <stdbool.h>
 #include <z80_ctrl.h>
-#include <ym2612.h>
+
+#define YM2612_WRITE_QUEUE_LENGTH 32
+
+#define CHANGED_ALGORITHM_FEEDBACK 0x01
+#define CHANGED_STEREO_AMS_FMS 0x02
+
+#define CHANGED_MULTIPLE_DETUNE 0x01
+#define CHANGED_RATE_SCALING_ATTACK_RATE 0x02
+#define CHANGED_AMPLITUDE_MODULATION_FIRST_DECAY_RATE 0x04
+#define CHANGED_SECONDARY_DECAY_RATE 0x08
+#define CHANGED_RELEASE_RATE_SECONDARY_AMPLITUDE 0x10
+#define CHANGED_TOTAL_LEVEL 0x20
+#define CHANGED_SSG_EG 0x40
+
+typedef struct YmWrite YmWrite;
+
+struct YmWrite {
+    u8 part;
+    u8 reg;
+    u8 data;
+};
 
 static Global global = { .lfoEnable = 1, .lfoFrequency = 0 };
 static FmChannel fmChannels[MAX_FM_CHANS];
 static u8 noteOn;
 static u8 volumes[MAX_FM_CHANS];
+static bool specialMode;
+static u8 specialModeKeys;
+static u8 specialModeVolumes[MAX_FM_OPERATORS];
+static u8 registers[YM2612_PARTS][YM2612_REGISTERS];
+static u8 knownRegisters[YM2612_PARTS][YM2612_REGISTERS / 8];
+static u16 writeCount;
+static YmWrite writeQueue[YM2612_WRITE_QUEUE_LENGTH];
+static u8 queuedWrites;
+static u8 batchDepth;
+static u16 batchCount;
 
 static ParameterUpdatedCallback* parameterUpdatedCallback = NULL;
 
 static const u8 MAX_VOLUME = 0x7F;
 
+/* Frequency registers of the channel 3 operators in special mode, indexed by
+   operator. Operator 4 uses the normal channel 3 registers. */
+static const u8 SPECIAL_MODE_FREQ_REGS[MAX_FM_OPERATORS]
+    = { 0xA9, 0xAA, 0xA8, 0xA2 };
+
+static const u8 ALGORITHM_CARRIERS[FM_ALGORITHMS]
+    = { 0x08, 0x08, 0x08, 0x08, 0x0C, 0x0E, 0x0E, 0x0F };
+
+/* x / 0x7F == (x * RECIPROCAL_0x7F) >> 20 for x <= 0x7F * 0x7F */
+static const u16 RECIPROCAL_0x7F = 8257;
+
 static const u8 VOLUME_TO_TOTAL_LEVELS[] = { 127, 122, 117, 113, 108, 104, 100,
     97, 93, 89, 86, 83, 80, 77, 74, 71, 68, 66, 63, 61, 58, 56, 54, 52, 50, 48,
     46, 44, 43, 41, 40, 38, 37, 35, 34, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23,
@@ -23,6 +67,9 @@ static const u8 VOLUME_TO_TOTAL_LEVELS[] = { 127, 122, 117, 113, 108, 104, 100,
     1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
 
 static void updateChannel(u8 chan);
+static u8 channelChanges(const FmChannel* from, const FmChannel* to);
+static u8 operatorChanges(const Operator* from, const Operator* to);
+static void updateChangedOperator(u8 channel, u8 op, u8 changes);
 static void updateGlobalLfo(void);
 static void updateAlgorithmAndFeedback(u8 channel);
 static void updateOperatorMultipleAndDetune(u8 channel, u8 op);
@@ -35,28 +82,53 @@ static void updateOperatorTotalLevel(u8 channel, u8 operator);
 static void updateOperatorSecondaryDecayRate(u8 channel, u8 operator);
 static void updateOperatorSsgEg(u8 channel, u8 operator);
 static void updateStereoAmsFms(u8 channel);
+static void beginWriteBatch(void);
+static void endWriteBatch(void);
+static void flushWriteQueue(void);
+static void queueWrite(u8 part, u8 reg, u8 data);
+static void ymWrite(u8 part, u8 reg, u8 data);
+static void writeReg(u8 part, u8 reg, u8 data);
+static void writeFrequencyRegs(u8 part, u8 lowReg, u16 freqNumber, u8 octave);
 static void writeChannelReg(u8 channel, u8 baseReg, u8 data);
+static void writeKeyOnOff(u8 data);
 static void writeOperatorReg(u8 channel, u8 op, u8 baseReg, u8 data);
+static u8 regOperatorIndex(u8 op);
 static void updateOctaveAndFrequency(u8 channel);
 static u8 keyOnOffRegOffset(u8 channel);
 static FmChannel* fmChannel(u8 channel);
 static Operator* getOperator(u8 channel, u8 operator);
 static u8 effectiveTotalLevel(u8 channel, u8 operator, u8 totalLevel);
 static bool isOutputOperator(u8 algorithm, u8 operator);
-static u8 volumeAdjustedTotalLevel(u8 channel, u8 totalLevel);
+static u8 volumeAdjustedTotalLevel(u8 volume, u8 totalLevel);
+static u8 operatorVolume(u8 channel, u8 operator);
+static void writeSpecialModeKeys(void);
 static void channelParameterUpdated(u8 channel);
 static void otherParameterUpdated(
     u8 channel, ParameterUpdated parameterUpdated);
 
 void synth_init(const FmChannel* initialPreset)
 {
+#if YM2612_Z80_DRIVER
+    z80_ym_init();
+#else
     Z80_requestBus(TRUE);
-    YM2612_writeReg(0, 0x27, 0); // Ch 3 Normal
+#endif
+    writeCount = 0;
+    batchCount = 0;
+    queuedWrites = 0;
+    batchDepth = 0;
+    memset(knownRegisters, 0, sizeof(knownRegisters));
+    specialMode = false;
+    specialModeKeys = 0;
+    memset(specialModeVolumes, MAX_VOLUME, sizeof(specialModeVolumes));
+    writeReg(0, 0x27, 0); // Ch 3 Normal
     for (u8 chan = 0; chan < MAX_FM_CHANS; chan++) {
         volumes[chan] = MAX_VOLUME;
         synth_noteOff(chan);
         memcpy(&fmChannels[chan], initialPreset, sizeof(FmChannel));
+        beginWriteBatch();
         updateChannel(chan);
+        endWriteBatch();
     }
     updateGlobalLfo();
 }
@@ -78,13 +150,13 @@ static void updateChannel(u8 chan)
 
 void synth_noteOn(u8 channel)
 {
-    YM2612_writeReg(0, 0x28, 0xF0 + keyOnOffRegOffset(channel));
+    writeKeyOnOff(0xF0 + keyOnOffRegOffset(channel));
     SET_BIT(noteOn, channel);
 }
 
 void synth_noteOff(u8 channel)
 {
-    YM2612_writeReg(0, 0x28, keyOnOffRegOffset(channel));
+    writeKeyOnOff(keyOnOffRegOffset(channel));
     CLEAR_BIT(noteOn, channel);
 }
 
@@ -102,11 +174,120 @@ void synth_volume(u8 channel, u8 volume)
         return;
     }
     volumes[channel] = volume;
+    u8 carriers = ALGORITHM_CARRIERS[fmChannel(channel)->algorithm];
+    beginWriteBatch();
+    for (u8 op = 0; carriers != 0; op++, carriers >>= 1) {
+        if (carriers & 1) {
+            updateOperatorTotalLevel(channel, op);
+        }
+    }
+    endWriteBatch();
+}
+
+void synth_specialMode(bool enable)
+{
+    specialMode = enable;
+    specialModeKeys = 0;
+    beginWriteBatch();
+    writeReg(0, 0x27, enable ? 0x40 : 0);
     for (u8 op = 0; op < MAX_FM_OPERATORS; op++) {
-        updateOperatorTotalLevel(channel, op);
+        updateOperatorTotalLevel(SPECIAL_MODE_CHANNEL, op);
+    }
+    endWriteBatch();
+}
+
+void synth_specialModePitch(u8 op, u8 octave, u16 freqNumber)
+{
+    beginWriteBatch();
+    writeFrequencyRegs(0, SPECIAL_MODE_FREQ_REGS[op], freqNumber, octave);
+    endWriteBatch();
+}
+
+void synth_specialModeVolume(u8 op, u8 volume)
+{
+    if (specialModeVolumes[op] == volume) {
+        return;
+    }
+    specialModeVolumes[op] = volume;
+    updateOperatorTotalLevel(SPECIAL_MODE_CHANNEL, op);
+}
+
+void synth_specialModeNoteOn(u8 op)
+{
+    SET_BIT(specialModeKeys, op);
+    writeSpecialModeKeys();
+}
+
+void synth_specialModeNoteOff(u8 op)
+{
+    CLEAR_BIT(specialModeKeys, op);
+    writeSpecialModeKeys();
+}
+
+static void writeSpecialModeKeys(void)
+{
+    u8 channel = SPECIAL_MODE_CHANNEL;
+    writeKeyOnOff((specialModeKeys << 4) + keyOnOffRegOffset(channel));
+    if (specialModeKeys) {
+        SET_BIT(noteOn, channel);
+    } else {
+        CLEAR_BIT(noteOn, channel);
     }
 }
 
+void synth_dacEnable(bool enable)
+{
+    writeReg(0, 0x2B, enable ? 0x80 : 0);
+}
+
+bool synth_dacAvailable(void)
+{
+    return YM2612_Z80_DRIVER;
+}
+
+void synth_dacPlay(const u8* data, u16 length, u16 rate)
+{
+#if YM2612_Z80_DRIVER
+    z80_ym_playSample(data, length, rate);
+#else
+    (void)data;
+    (void)length;
+    (void)rate;
+#endif
+}
+
+void synth_dacStop(void)
+{
+#if YM2612_Z80_DRIVER
+    z80_ym_stopSample();
+#endif
+}
+
+void synth_dacLoad(u16 offset, const u8* data, u16 length)
+{
+#if YM2612_Z80_DRIVER
+    z80_ym_writeSampleArena(offset, data, length);
+#else
+    (void)offset;
+    (void)data;
+    (void)length;
+#endif
+}
+
+void synth_dacPlayLoaded(
+    u16 offset, u16 length, u16 rate, u16 loopStart, u16 loopLength)
+{
+#if YM2612_Z80_DRIVER
+    z80_ym_playArenaSample(offset, length, rate, loopStart, loopLength);
+#else
+    (void)offset;
+    (void)length;
+    (void)rate;
+    (void)loopStart;
+    (void)loopLength;
+#endif
+}
+
 void synth_stereo(u8 channel, u8 stereo)
 {
     fmChannel(channel)->stereo = stereo;
@@ -245,11 +426,143 @@ u8 synth_busy(void)
 
 void synth_preset(u8 channel, const FmChannel* preset)
 {
-    memcpy(&fmChannels[channel], preset, sizeof(FmChannel));
-    updateChannel(channel);
+    FmChannel* chan = fmChannel(channel);
+    u8 changes = channelChanges(chan, preset);
+    u8 opChanges[MAX_FM_OPERATORS];
+    for (u8 op = 0; op < MAX_FM_OPERATORS; op++) {
+        opChanges[op]
+            = operatorChanges(&chan->operators[op], &preset->operators[op]);
+        if (changes & CHANGED_ALGORITHM_FEEDBACK) {
+            opChanges[op] |= CHANGED_TOTAL_LEVEL;
+        }
+    }
+    memcpy(chan, preset, sizeof(FmChannel));
+    beginWriteBatch();
+    if (changes & CHANGED_ALGORITHM_FEEDBACK) {
+        updateAlgorithmAndFeedback(channel);
+    }
+    if (changes & CHANGED_STEREO_AMS_FMS) {
+        updateStereoAmsFms(channel);
+    }
+    for (u8 op = 0; op < MAX_FM_OPERATORS; op++) {
+        updateChangedOperator(channel, op, opChanges[op]);
+    }
+    endWriteBatch();
     channelParameterUpdated(channel);
 }
 
+void synth_presetImage(u8 channel, const FmPresetImage* image)
+{
+    const u8* data = image->registers;
+    synth_unpackPresetImage(fmChannel(channel), image);
+    beginWriteBatch();
+    writeChannelReg(channel, 0xB0, *data++);
+    writeChannelReg(channel, 0xB4, *data++);
+    for (u8 reg = 0x30; reg < 0xA0; reg += 4) {
+        u8 value = *data++;
+        if ((reg & 0xF0) == 0x40) {
+            value = effectiveTotalLevel(
+                channel, regOperatorIndex((reg >> 2) & 3), value);
+        }
+        writeChannelReg(channel, reg, value);
+    }
+    endWriteBatch();
+    channelParameterUpdated(channel);
+}
+
+void synth_unpackPresetImage(FmChannel* chan, const FmPresetImage* image)
+{
+    const u8* data = image->registers;
+    chan->algorithm = data[0] & 7;
+    chan->feedback = (data[0] >> 3) & 7;
+    chan->stereo = data[1] >> 6;
+    chan->ams = (data[1] >> 4) & 3;
+    chan->fms = data[1] & 7;
+    for (u8 op = 0; op < MAX_FM_OPERATORS; op++) {
+        const u8* reg = &data[2 + regOperatorIndex(op)];
+        Operator* oper = &chan->operators[op];
+        oper->multiple = reg[0] & 15;
+        oper->detune = (reg[0] >> 4) & 7;
+        oper->totalLevel = reg[4] & 127;
+        oper->attackRate = reg[8] & 31;
+        oper->rateScaling = reg[8] >> 6;
+        oper->firstDecayRate = reg[12] & 31;
+        oper->amplitudeModulation = reg[12] >> 7;
+        oper->secondaryDecayRate = reg[16] & 31;
+        oper->releaseRate = reg[20] & 15;
+        oper->secondaryAmplitude = reg[20] >> 4;
+        oper->ssgEg = reg[24] & 15;
+    }
+}
+
+static u8 channelChanges(const FmChannel* from, const FmChannel* to)
+{
+    u8 changes = 0;
+    if (from->algorithm != to->algorithm || from->feedback != to->feedback) {
+        changes |= CHANGED_ALGORITHM_FEEDBACK;
+    }
+    if (from->stereo != to->stereo || from->ams != to->ams
+        || from->fms != to->fms) {
+        changes |= CHANGED_STEREO_AMS_FMS;
+    }
+    return changes;
+}
+
+static u8 operatorChanges(const Operator* from, const Operator* to)
+{
+    u8 changes = 0;
+    if (from->multiple != to->multiple || from->detune != to->detune) {
+        changes |= CHANGED_MULTIPLE_DETUNE;
+    }
+    if (from->attackRate != to->attackRate
+        || from->rateScaling != to->rateScaling) {
+        changes |= CHANGED_RATE_SCALING_ATTACK_RATE;
+    }
+    if (from->firstDecayRate != to->firstDecayRate
+        || from->amplitudeModulation != to->amplitudeModulation) {
+        changes |= CHANGED_AMPLITUDE_MODULATION_FIRST_DECAY_RATE;
+    }
+    if (from->secondaryDecayRate != to->secondaryDecayRate) {
+        changes |= CHANGED_SECONDARY_DECAY_RATE;
+    }
+    if (from->releaseRate != to->releaseRate
+        || from->secondaryAmplitude != to->secondaryAmplitude) {
+        changes |= CHANGED_RELEASE_RATE_SECONDARY_AMPLITUDE;
+    }
+    if (from->totalLevel != to->totalLevel) {
+        changes |= CHANGED_TOTAL_LEVEL;
+    }
+    if (from->ssgEg != to->ssgEg) {
+        changes |= CHANGED_SSG_EG;
+    }
+    return changes;
+}
+
+static void updateChangedOperator(u8 channel, u8 op, u8 changes)
+{
+    if (changes & CHANGED_MULTIPLE_DETUNE) {
+        updateOperatorMultipleAndDetune(channel, op);
+    }
+    if (changes & CHANGED_RATE_SCALING_ATTACK_RATE) {
+        updateOperatorRateScalingAndAttackRate(channel, op);
+    }
+    if (changes & CHANGED_AMPLITUDE_MODULATION_FIRST_DECAY_RATE) {
+        updateOperatorAmplitudeModulationAndFirstDecayRate(channel, op);
+    }
+    if (changes & CHANGED_SECONDARY_DECAY_RATE) {
+        updateOperatorSecondaryDecayRate(channel, op);
+    }
+    if (changes & CHANGED_RELEASE_RATE_SECONDARY_AMPLITUDE) {
+        updateOperatorReleaseRateAndSecondaryAmplitude(channel, op);
+    }
+    if (changes & CHANGED_TOTAL_LEVEL) {
+        updateOperatorTotalLevel(channel, op);
+    }
+    if (changes & CHANGED_SSG_EG) {
+        updateOperatorSsgEg(channel, op);
+    }
+}
+
 static void otherParameterUpdated(u8 channel, ParameterUpdated parameterUpdated)
 {
     if (parameterUpdatedCallback) {
@@ -264,9 +577,107 @@ static void channelParameterUpdated(u8 channel)
     }
 }
 
+static bool isRegUnchanged(u8 part, u8 reg, u8 data)
+{
+    return registers[part][reg] == data
+        && CHECK_BIT(knownRegisters[part][reg >> 3], reg & 7);
+}
+
+static void forceWriteReg(u8 part, u8 reg, u8 data)
+{
+    u8 bit = reg & 7;
+    registers[part][reg] = data;
+    SET_BIT(knownRegisters[part][reg >> 3], bit);
+    writeCount++;
+    queueWrite(part, reg, data);
+}
+
+static void writeReg(u8 part, u8 reg, u8 data)
+{
+    if (isRegUnchanged(part, reg, data)) {
+        return;
+    }
+    forceWriteReg(part, reg, data);
+}
+
+/* The high byte of a frequency is only latched until its low byte is written,
+   and the latch is shared by every channel, so the pair is always written
+   together, high byte first, unless neither byte has changed. */
+static void writeFrequencyRegs(u8 part, u8 lowReg, u16 freqNumber, u8 octave)
+{
+    u8 high = (freqNumber >> 8) | (octave << 3);
+    u8 low = freqNumber;
+    if (isRegUnchanged(part, lowReg + 4, high)
+        && isRegUnchanged(part, lowReg, low)) {
+        return;
+    }
+    forceWriteReg(part, lowReg + 4, high);
+    forceWriteReg(part, lowReg, low);
+}
+
+static void writeKeyOnOff(u8 data)
+{
+    writeCount++;
+    queueWrite(0, 0x28, data);
+}
+
+static void beginWriteBatch(void)
+{
+    batchDepth++;
+}
+
+static void endWriteBatch(void)
+{
+    if (--batchDepth == 0) {
+        flushWriteQueue();
+    }
+}
+
+static void queueWrite(u8 part, u8 reg, u8 data)
+{
+    if (queuedWrites == YM2612_WRITE_QUEUE_LENGTH) {
+        flushWriteQueue();
+    }
+    YmWrite* write = &writeQueue[queuedWrites++];
+    write->part = part;
+    write->reg = reg;
+    write->data = data;
+    if (batchDepth == 0) {
+        flushWriteQueue();
+    }
+}
+
+static void flushWriteQueue(void)
+{
+    if (queuedWrites == 0) {
+        return;
+    }
+    batchCount++;
+#if YM2612_Z80_DRIVER
+    z80_ym_beginWrites();
+#endif
+    for (u8 i = 0; i < queuedWrites; i++) {
+        const YmWrite* write = &writeQueue[i];
+        ymWrite(write->part, write->reg, write->data);
+    }
+#if YM2612_Z80_DRIVER
+    z80_ym_endWrites();
+#endif
+    queuedWrites = 0;
+}
+
+static void ymWrite(u8 part, u8 reg, u8 data)
+{
+#if YM2612_Z80_DRIVER
+    z80_ym_write(part, reg, data);
+#else
+    ym_port_write(part, reg, data);
+#endif
+}
+
 static void writeChannelReg(u8 channel, u8 baseReg, u8 data)
 {
-    YM2612_writeReg(channel > 2 ? 1 : 0, baseReg + (channel % 3), data);
+    writeReg(channel > 2 ? 1 : 0, baseReg + (channel % 3), data);
 }
 
 static u8 regOperatorIndex(u8 op)
@@ -302,15 +713,14 @@ static Operator* getOperator(u8 channel, u8 operator)
 
 static void updateGlobalLfo(void)
 {
-    YM2612_writeReg(0, 0x22, (global.lfoEnable << 3) | global.lfoFrequency);
+    writeReg(0, 0x22, (global.lfoEnable << 3) | global.lfoFrequency);
 }
 
 static void updateOctaveAndFrequency(u8 channel)
 {
     FmChannel* chan = fmChannel(channel);
-    writeChannelReg(
-        channel, 0xA4, (chan->freqNumber >> 8) | (chan->octave << 3));
-    writeChannelReg(channel, 0xA0, chan->freqNumber);
+    writeFrequencyRegs(channel > 2 ? 1 : 0, 0xA0 + (channel % 3),
+        chan->freqNumber, chan->octave);
 }
 
 static void updateAlgorithmAndFeedback(u8 channel)
@@ -376,26 +786,32 @@ static void updateOperatorTotalLevel(u8 channel, u8 operator)
 
 static u8 effectiveTotalLevel(u8 channel, u8 operator, u8 totalLevel)
 {
-    return isOutputOperator(fmChannel(channel)->algorithm, operator)
-        ? volumeAdjustedTotalLevel(channel, totalLevel)
-        : totalLevel;
+    if (!isOutputOperator(fmChannel(channel)->algorithm, operator)) {
+        return totalLevel;
+    }
+    return volumeAdjustedTotalLevel(
+        operatorVolume(channel, operator), totalLevel);
+}
+
+static u8 operatorVolume(u8 channel, u8 operator)
+{
+    if (specialMode && channel == SPECIAL_MODE_CHANNEL) {
+        return specialModeVolumes[operator];
+    }
+    return volumes[channel];
 }
 
 static bool isOutputOperator(u8 algorithm, u8 operator)
 {
-    return (algorithm < 4 && operator== 3)
-        || (algorithm == 4 && (operator== 2 || operator== 3))
-        || ((algorithm == 5 || algorithm == 6) && operator> 0)
-        || algorithm == 7;
+    return CHECK_BIT(ALGORITHM_CARRIERS[algorithm], operator);
 }
 
-static u8 volumeAdjustedTotalLevel(u8 channel, u8 totalLevel)
+static u8 volumeAdjustedTotalLevel(u8 volume, u8 totalLevel)
 {
-    u8 volume = volumes[channel];
     u8 logarithmicVolume = 0x7F - VOLUME_TO_TOTAL_LEVELS[volume];
     u8 inverseTotalLevel = 0x7F - totalLevel;
-    u8 inverseNewTotalLevel
-        = (u16)inverseTotalLevel * (u16)logarithmicVolume / (u16)0x7F;
+    u16 scaled = (u16)inverseTotalLevel * logarithmicVolume;
+    u8 inverseNewTotalLevel = ((u32)scaled * RECIPROCAL_0x7F) >> 20;
     return 0x7F - inverseNewTotalLevel;
 }
 
@@ -409,6 +825,16 @@ const Global* synth_globalParameters()
     return &global;
 }
 
+u16 synth_batchCount(void)
+{
+    return batchCount;
+}
+
+u16 synth_writeCount(void)
+{
+    return writeCount;
+}
+
 void synth_setParameterUpdateCallback(ParameterUpdatedCallback* cb)
 {
     parameterUpdatedCallback = cb;
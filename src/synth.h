@@ -1,10 +1,16 @@
 #pragma once
+#include <stdbool.h>
 #include <stdint.h>
 #include <types.h>
 
 #define MAX_FM_OPERATORS 4
 #define MAX_FM_CHANS 6
 #define FM_ALGORITHMS 8
+#define YM2612_PARTS 2
+#define YM2612_REGISTERS 256
+#define FM_PRESET_IMAGE_LENGTH 30
+#define SPECIAL_MODE_CHANNEL 2
+#define DAC_CHANNEL 5
 
 #define STEREO_MODE_CENTRE 3
 #define STEREO_MODE_RIGHT 1
@@ -39,6 +45,12 @@ struct FmChannel {
     Operator operators[MAX_FM_OPERATORS];
 };
 
+typedef struct FmPresetImage FmPresetImage;
+
+struct FmPresetImage {
+    u8 registers[FM_PRESET_IMAGE_LENGTH];
+};
+
 typedef struct Global Global;
 
 struct Global {
@@ -58,6 +70,18 @@ void synth_noteOn(u8 channel);
 void synth_noteOff(u8 channel);
 void synth_pitch(u8 channel, u8 octave, u16 freqNumber);
 void synth_volume(u8 channel, u8 volume);
+void synth_specialMode(bool enable);
+void synth_specialModePitch(u8 op, u8 octave, u16 freqNumber);
+void synth_specialModeVolume(u8 op, u8 volume);
+void synth_specialModeNoteOn(u8 op);
+void synth_specialModeNoteOff(u8 op);
+bool synth_dacAvailable(void);
+void synth_dacEnable(bool enable);
+void synth_dacPlay(const u8* data, u16 length, u16 rate);
+void synth_dacStop(void);
+void synth_dacLoad(u16 offset, const u8* data, u16 length);
+void synth_dacPlayLoaded(
+    u16 offset, u16 length, u16 rate, u16 loopStart, u16 loopLength);
 void synth_stereo(u8 channel, u8 mode);
 void synth_algorithm(u8 channel, u8 algorithm);
 void synth_feedback(u8 channel, u8 feedback);
@@ -79,6 +103,10 @@ void synth_ams(u8 channel, u8 ams);
 void synth_fms(u8 channel, u8 fms);
 u8 synth_busy(void);
 void synth_preset(u8 channel, const FmChannel* preset);
+void synth_presetImage(u8 channel, const FmPresetImage* image);
+void synth_unpackPresetImage(FmChannel* chan, const FmPresetImage* image);
 const FmChannel* synth_channelParameters(u8 channel);
 const Global* synth_globalParameters();
 void synth_setParameterUpdateCallback(ParameterUpdatedCallback* cb);
+u16 synth_writeCount(void);
+u16 synth_batchCount(void);
@@ -0,0 +1,22 @@
+#include "ym_port.h"
+#include <ym2612.h>
+
+void ym_port_write(u8 part, u8 reg, u8 data)
+{
+    /* The bus is held from synth_init, so only the chip itself is waited
+       on. As in SGDK's YM2612_writeReg, the busy flag isn't updated straight
+       after the address write (MD2), so pad with dummy reads and poll it
+       again before writing the data. */
+    vu8* status = (vu8*)YM2612_BASEPORT;
+    vu8* port = status + (part << 1);
+    while (*status & 0x80)
+        ;
+    port[0] = reg;
+    port[0];
+    port[0];
+    port[0];
+    port[0];
+    while (*status & 0x80)
+        ;
+    port[1] = data;
+}
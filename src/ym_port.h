@@ -0,0 +1,4 @@
+#pragma once
+#include <types.h>
+
+void ym_port_write(u8 part, u8 reg, u8 data);
@@ -0,0 +1,209 @@
+#include "z80_ym.h"
+#include <stdint.h>
+#include <z80_ctrl.h>
+
+/* Drains a ring of (part, register, data) triples at Z80_YM_RING into the
+   YM2612. The 68000 owns the head index and the driver owns the tail; both
+   start at zero as loading the driver clears Z80 RAM.
+
+   Between ring entries the driver streams one byte of the current sample
+   from the 68000 bus to the DAC, then idles for Z80_DAC_DELAY iterations to
+   set the playback rate. A sample starts when the 68000 changes
+   Z80_DAC_TRIGGER, after filling in its bank, windowed address and length.
+   Once it ends the driver restarts from Z80_DAC_LOOP_ADDRESS for
+   Z80_DAC_LOOP_LENGTH bytes, which only makes sense for samples held in the
+   Z80_SAMPLE_ARENA as it does not restore the bank. The shadow registers
+   hold the sample state: HL' is the read address, BC' the bytes remaining
+   and E' the last trigger seen. */
+const u8 Z80_YM_DRIVER[] = {
+    0xF3, //             di
+    0x31, 0x00, 0x20, // ld sp,0x2000
+    0x21, 0x00, 0x1D, // ld hl,Z80_YM_RING
+    0xD9, //             exx
+    0x01, 0x00, 0x00, // ld bc,0
+    0x1E, 0x00, //       ld e,0
+    0xD9, //             exx
+    0x3A, 0x00, 0x1E, // loop: ld a,(Z80_YM_RING_HEAD)
+    0xBD, //             cp l
+    0x28, 0x14, //       jr z,dac
+    0x7E, //             ld a,(hl) ; part
+    0x2C, //             inc l
+    0x87, //             add a,a
+    0x5F, //             ld e,a
+    0x16, 0x40, //       ld d,0x40
+    0x7E, //             ld a,(hl) ; register
+    0x2C, //             inc l
+    0x12, //             ld (de),a
+    0x1C, //             inc e
+    0x7E, //             ld a,(hl) ; data
+    0x2C, //             inc l
+    0x12, //             ld (de),a
+    0x7D, //             ld a,l
+    0x32, 0x01, 0x1E, // ld (Z80_YM_RING_TAIL),a
+    0xCD, 0x74, 0x00, // call busy
+    0xD9, //             dac: exx
+    0x3A, 0x02, 0x1E, // ld a,(Z80_DAC_TRIGGER)
+    0xBB, //             cp e
+    0x28, 0x0E, //       jr z,play
+    0x5F, //             ld e,a
+    0x2A, 0x03, 0x1E, // ld hl,(Z80_DAC_BANK)
+    0xCD, 0x7C, 0x00, // call bank
+    0x2A, 0x05, 0x1E, // ld hl,(Z80_DAC_ADDRESS)
+    0xED, 0x4B, 0x07, 0x1E, // ld bc,(Z80_DAC_LENGTH)
+    0x78, //             play: ld a,b
+    0xB1, //             or c
+    0x20, 0x0B, //       jr nz,stream
+    0xED, 0x4B, 0x0C, 0x1E, // ld bc,(Z80_DAC_LOOP_LENGTH)
+    0x78, //             ld a,b
+    0xB1, //             or c
+    0x28, 0x28, //       jr z,idle
+    0x2A, 0x0A, 0x1E, // ld hl,(Z80_DAC_LOOP_ADDRESS)
+    0x3E, 0x2A, //       stream: ld a,0x2A
+    0x32, 0x00, 0x40, // ld (0x4000),a
+    0x7E, //             ld a,(hl) ; sample
+    0x32, 0x01, 0x40, // ld (0x4001),a
+    0x0B, //             dec bc
+    0x23, //             inc hl
+    0x7C, //             ld a,h
+    0xB5, //             or l
+    0x20, 0x0D, //       jr nz,delay
+    0x2A, 0x03, 0x1E, // ld hl,(Z80_DAC_BANK) ; crossed into next bank
+    0x23, //             inc hl
+    0x22, 0x03, 0x1E, // ld (Z80_DAC_BANK),hl
+    0xCD, 0x7C, 0x00, // call bank
+    0x21, 0x00, 0x80, // ld hl,0x8000
+    0x3A, 0x09, 0x1E, // delay: ld a,(Z80_DAC_DELAY)
+    0x3D, //             wait: dec a
+    0x20, 0xFD, //       jr nz,wait
+    0xCD, 0x74, 0x00, // call busy
+    0xD9, //             idle: exx
+    0x18, 0x9A, //       jr loop
+    0x3A, 0x00, 0x40, // busy: ld a,(0x4000)
+    0xE6, 0x80, //       and 0x80
+    0x20, 0xF9, //       jr nz,busy
+    0xC9, //             ret
+    0xC5, //             bank: push bc
+    0x06, 0x08, //       ld b,8
+    0x7D, //             ld a,l
+    0x32, 0x00, 0x60, // bit: ld (0x6000),a
+    0x0F, //             rrca
+    0x10, 0xFA, //       djnz bit
+    0x7C, //             ld a,h
+    0x32, 0x00, 0x60, // ld (0x6000),a
+    0xC1, //             pop bc
+    0xC9, //             ret
+};
+
+const u16 Z80_YM_DRIVER_SIZE = sizeof(Z80_YM_DRIVER);
+
+static const u8 WRITE_SIZE = 3;
+
+/* Z80 cycles taken by one pass of the driver loop while a sample plays and
+   the ring is empty, excluding the delay, and by each delay iteration. */
+static const u32 Z80_CLOCK = 3579545;
+static const u16 DAC_LOOP_CYCLES = 232;
+static const u16 DAC_DELAY_CYCLES = 16;
+
+static u8 head;
+static u8 trigger;
+
+static u8 freeBytes(void);
+static void writeWord(u16 addr, u16 value);
+static u8 dacDelay(u16 rate);
+static void startSample(u16 bank, u16 address, u16 length, u16 rate,
+    u16 loopAddress, u16 loopLength);
+
+void z80_ym_init(void)
+{
+    head = 0;
+    trigger = 0;
+    Z80_loadCustomDriver(Z80_YM_DRIVER, Z80_YM_DRIVER_SIZE);
+}
+
+void z80_ym_beginWrites(void)
+{
+    Z80_requestBus(TRUE);
+}
+
+void z80_ym_write(u8 part, u8 reg, u8 data)
+{
+    while (freeBytes() < WRITE_SIZE) {
+        z80_ym_endWrites();
+        z80_ym_beginWrites();
+    }
+    Z80_write(Z80_YM_RING + head++, part);
+    Z80_write(Z80_YM_RING + head++, reg);
+    Z80_write(Z80_YM_RING + head++, data);
+}
+
+void z80_ym_endWrites(void)
+{
+    Z80_write(Z80_YM_RING_HEAD, head);
+    Z80_releaseBus();
+}
+
+void z80_ym_playSample(const u8* data, u16 length, u16 rate)
+{
+    u32 address = (u32)(uintptr_t)data;
+    startSample((address >> 15) & 0x1FF, 0x8000 | (address & 0x7FFF), length,
+        rate, 0, 0);
+}
+
+void z80_ym_stopSample(void)
+{
+    z80_ym_playSample(NULL, 0, 0);
+}
+
+void z80_ym_writeSampleArena(u16 offset, const u8* data, u16 length)
+{
+    Z80_requestBus(TRUE);
+    for (u16 i = 0; i < length; i++) {
+        Z80_write(Z80_SAMPLE_ARENA + offset + i, data[i]);
+    }
+    Z80_releaseBus();
+}
+
+void z80_ym_playArenaSample(
+    u16 offset, u16 length, u16 rate, u16 loopStart, u16 loopLength)
+{
+    u16 address = Z80_SAMPLE_ARENA + offset;
+    startSample(0, address, length, rate, address + loopStart, loopLength);
+}
+
+static void startSample(u16 bank, u16 address, u16 length, u16 rate,
+    u16 loopAddress, u16 loopLength)
+{
+    Z80_requestBus(TRUE);
+    writeWord(Z80_DAC_BANK, bank);
+    writeWord(Z80_DAC_ADDRESS, address);
+    writeWord(Z80_DAC_LENGTH, length);
+    Z80_write(Z80_DAC_DELAY, dacDelay(rate));
+    writeWord(Z80_DAC_LOOP_ADDRESS, loopAddress);
+    writeWord(Z80_DAC_LOOP_LENGTH, loopLength);
+    Z80_write(Z80_DAC_TRIGGER, ++trigger);
+    Z80_releaseBus();
+}
+
+static void writeWord(u16 addr, u16 value)
+{
+    Z80_write(addr, value);
+    Z80_write(addr + 1, value >> 8);
+}
+
+static u8 dacDelay(u16 rate)
+{
+    if (rate == 0) {
+        return 1;
+    }
+    u32 cycles = Z80_CLOCK / rate;
+    if (cycles <= DAC_LOOP_CYCLES + DAC_DELAY_CYCLES) {
+        return 1;
+    }
+    u32 delay = (cycles - DAC_LOOP_CYCLES) / DAC_DELAY_CYCLES;
+    return delay > 0xFF ? 0xFF : delay;
+}
+
+static u8 freeBytes(void)
+{
+    return (u8)(Z80_read(Z80_YM_RING_TAIL) - head - 1);
+}
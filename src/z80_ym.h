@@ -0,0 +1,28 @@
+#pragma once
+#include <types.h>
+
+#define Z80_SAMPLE_ARENA 0x0100
+#define Z80_SAMPLE_ARENA_SIZE 0x1C00
+#define Z80_YM_RING 0x1D00
+#define Z80_YM_RING_HEAD 0x1E00
+#define Z80_YM_RING_TAIL 0x1E01
+#define Z80_DAC_TRIGGER 0x1E02
+#define Z80_DAC_BANK 0x1E03
+#define Z80_DAC_ADDRESS 0x1E05
+#define Z80_DAC_LENGTH 0x1E07
+#define Z80_DAC_DELAY 0x1E09
+#define Z80_DAC_LOOP_ADDRESS 0x1E0A
+#define Z80_DAC_LOOP_LENGTH 0x1E0C
+
+extern const u8 Z80_YM_DRIVER[];
+extern const u16 Z80_YM_DRIVER_SIZE;
+
+void z80_ym_init(void);
+void z80_ym_beginWrites(void);
+void z80_ym_write(u8 part, u8 reg, u8 data);
+void z80_ym_endWrites(void);
+void z80_ym_playSample(const u8* data, u16 length, u16 rate);
+void z80_ym_stopSample(void);
+void z80_ym_writeSampleArena(u16 offset, const u8* data, u16 length);
+void z80_ym_playArenaSample(
+    u16 offset, u16 length, u16 rate, u16 loopStart, u16 loopLength);
@@ -25,16 +25,16 @@ void stub_comm_read_returns_midi_event(u8 status, u8 data, u8 data2)
 
 void expect_ym2612_write_reg(u8 part, u8 reg, u8 data)
 {
-    expect_value(__wrap_YM2612_writeReg, part, part);
-    expect_value(__wrap_YM2612_writeReg, reg, reg);
-    expect_value(__wrap_YM2612_writeReg, data, data);
+    expect_value(__wrap_ym_port_write, part, part);
+    expect_value(__wrap_ym_port_write, reg, reg);
+    expect_value(__wrap_ym_port_write, data, data);
 }
 
 void expect_ym2612_write_reg_any_data(u8 part, u8 reg)
 {
-    expect_value(__wrap_YM2612_writeReg, part, part);
-    expect_value(__wrap_YM2612_writeReg, reg, reg);
-    expect_any(__wrap_YM2612_writeReg, data);
+    expect_value(__wrap_ym_port_write, part, part);
+    expect_value(__wrap_ym_port_write, reg, reg);
+    expect_any(__wrap_ym_port_write, data);
 }
 
 static u8 regOpIndex(u8 op)
@@ -58,10 +58,10 @@ void expect_ym2612_write_operator(u8 chan, u8 op, u8 baseReg, u8 data)
 
 void expect_ym2612_write_operator_any_data(u8 chan, u8 op, u8 baseReg)
 {
-    expect_value(__wrap_YM2612_writeReg, part, REG_PART(chan));
-    expect_value(__wrap_YM2612_writeReg, reg,
+    expect_value(__wrap_ym_port_write, part, REG_PART(chan));
+    expect_value(__wrap_ym_port_write, reg,
         baseReg + REG_OFFSET(chan) + (regOpIndex(op) * 4));
-    expect_any(__wrap_YM2612_writeReg, data);
+    expect_any(__wrap_ym_port_write, data);
 }
 
 void expect_ym2612_write_channel(u8 chan, u8 baseReg, u8 data)
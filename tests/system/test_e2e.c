@@ -16,7 +16,8 @@ static int test_e2e_setup(void** state)
     wraps_disable_checks();
     comm_reset_counts();
     comm_init();
-    midi_init(M_BANK_0, P_BANK_0, ENVELOPES);
+    wraps_sram_erase();
+    midi_init(M_BANKS, P_BANK_0_IMAGES, ENVELOPES);
     wraps_enable_checks();
     return 0;
 }
@@ -7,14 +7,21 @@
 #include "test_midi.h"
 #include "test_midi_dynamic.c"
 #include "test_midi_fm.c"
+#include "test_midi_fm_special.c"
+#include "test_midi_dac.c"
 #include "test_midi_polyphony.c"
+#include "test_midi_sustain.c"
 #include "test_midi_psg.c"
 #include "test_midi_receiver.c"
 #include "test_midi_sysex.c"
+#include "test_midi_coalescing.c"
 #include "test_scheduler.c"
 #include "test_synth.c"
 #include "test_vstring.c"
 #include "test_buffer.c"
+#include "test_z80_ym.c"
+#include "test_sample_bank.c"
+#include "test_persistence.c"
 
 #define midi_test(test) cmocka_unit_test_setup(test, test_midi_setup)
 #define dynamic_midi_test(test)                                                \
@@ -28,6 +35,11 @@
 #define scheduler_test(test) cmocka_unit_test_setup(test, test_scheduler_setup)
 #define applemidi_test(test) cmocka_unit_test_setup(test, test_applemidi_setup)
 #define buffer_test(test) cmocka_unit_test_setup(test, test_buffer_setup)
+#define z80_ym_test(test) cmocka_unit_test_setup(test, test_z80_ym_setup)
+#define sample_bank_test(test)                                                 \
+    cmocka_unit_test_setup(test, test_sample_bank_setup)
+#define persistence_test(test)                                                 \
+    cmocka_unit_test_setup(test, test_persistence_setup)
 
 int main(void)
 {
@@ -50,7 +62,7 @@ int main(void)
         cmocka_unit_test(test_midi_receiver_does_nothing_on_midi_position),
         cmocka_unit_test(test_midi_receiver_sets_midi_program),
         cmocka_unit_test(test_midi_receiver_sends_sysex_to_midi_layer),
-        cmocka_unit_test(test_midi_receiver_handles_sysex_limits),
+        cmocka_unit_test(test_midi_receiver_streams_long_sysex_in_chunks),
         cmocka_unit_test(test_midi_receiver_sends_midi_reset),
 
         midi_test(test_midi_triggers_synth_note_on),
@@ -84,6 +96,7 @@ int main(void)
             test_midi_psg_envelope_with_loop_end_continues_playing_after_note_off),
         midi_test(
             test_midi_psg_envelope_with_loop_end_resets_release_note_after_note_silenced),
+        midi_test(test_midi_silences_invalid_psg_envelope),
         midi_test(test_midi_shifts_semitone_in_psg_envelope),
         midi_test(test_midi_pitch_shift_handles_upper_limit_psg_envelope),
         midi_test(test_midi_pitch_shift_handles_lower_limit_psg_envelope),
@@ -95,10 +108,20 @@ int main(void)
         midi_test(test_midi_channel_volume_sets_psg_attenuation),
         midi_test(test_midi_channel_volume_sets_psg_attenuation_2),
         midi_test(test_midi_sets_synth_pitch_bend),
+        midi_test(test_midi_pitch_bend_crosses_octave_boundary),
+        midi_test(test_midi_rpn_sets_pitch_bend_range),
+        midi_test(test_midi_nrpn_deselects_pitch_bend_range),
         midi_test(test_midi_sets_psg_pitch_bend_down),
         midi_test(test_midi_sets_psg_pitch_bend_up),
+        midi_test(test_midi_rpn_sets_psg_pitch_bend_range),
         midi_test(test_midi_psg_pitch_bend_persists_after_tick),
         midi_test(test_midi_loads_psg_envelope),
+        midi_test(test_midi_plays_stored_program_envelope),
+        midi_test(test_midi_removed_program_envelope_falls_back_to_default),
+        midi_test(test_midi_psg_envelope_bank_compacts_freed_space),
+        midi_test(test_midi_psg_envelope_keeps_playing_when_bank_compacted),
+        midi_test(test_midi_psg_rejects_malformed_envelopes),
+        midi_test(test_midi_psg_stored_envelope_keeps_its_loop),
         midi_test(test_midi_polyphonic_mode_returns_state),
         midi_test(test_midi_polyphonic_mode_uses_multiple_fm_channels),
         midi_test(
@@ -121,15 +144,20 @@ int main(void)
         midi_test(test_midi_sets_operator_ssg_eg),
         midi_test(test_midi_sets_global_LFO_enable),
         midi_test(test_midi_sets_global_LFO_frequency),
+        midi_test(test_midi_dispatches_fm_cc_once_per_mapped_channel),
         midi_test(test_midi_sets_channel_AMS),
         midi_test(test_midi_sets_channel_FMS),
         midi_test(test_midi_sets_polyphonic_mode),
         midi_test(test_midi_unsets_polyphonic_mode),
         midi_test(test_midi_sets_unknown_CC),
-        midi_test(test_midi_ignores_sustain_pedal_cc),
         midi_test(test_midi_ignores_sysex_nrpn_ccs),
         midi_test(test_midi_polyphonic_mode_sends_CCs_to_all_FM_channels),
         midi_test(test_midi_set_overflow_flag_on_polyphony_breach),
+        midi_test(test_midi_sustain_defers_note_off_until_pedal_released),
+        midi_test(test_midi_sustain_releases_all_deferred_voices_on_pedal_up),
+        midi_test(test_midi_sustain_steals_sustained_voice_before_held_notes),
+        midi_test(test_midi_sostenuto_holds_only_notes_down_when_pressed),
+        midi_test(test_midi_sustain_release_keeps_sostenuto_notes),
         midi_test(test_midi_sets_fm_preset),
         midi_test(test_midi_sysex_general_midi_reset_resets_synth_volume),
         midi_test(test_midi_sysex_sends_all_notes_off),
@@ -137,11 +165,19 @@ int main(void)
         midi_test(test_midi_sysex_remaps_midi_channel_to_psg),
         midi_test(test_midi_sysex_remaps_midi_channel_to_fm),
         midi_test(test_midi_sysex_unassigns_midi_channel),
+        midi_test(
+            test_midi_sysex_remapped_channels_receive_midi_channel_ccs),
         midi_test(test_midi_sysex_does_nothing_for_empty_payload),
         midi_test(test_midi_sysex_handles_incomplete_channel_mapping_command),
         midi_test(
             test_midi_fm_note_on_percussion_channel_sets_percussion_preset),
+        midi_test(test_midi_fm_percussion_channel_reuses_loaded_preset),
+        midi_test(test_midi_fm_percussion_channel_reloads_edited_preset),
         midi_test(test_midi_switching_program_retains_pan_setting),
+        midi_test(test_midi_program_change_is_applied_on_next_note_on),
+        midi_test(test_midi_applies_program_before_fm_parameter_cc),
+        midi_test(test_midi_applies_volume_cc_between_program_and_note_on),
+        midi_test(test_midi_applies_program_when_showing_fm_parameters),
         midi_test(test_midi_sets_genmdm_stereo_mode),
         midi_test(test_midi_sysex_enables_dynamic_channel_mode),
         midi_test(test_midi_sysex_sets_mapping_mode_to_auto),
@@ -149,10 +185,37 @@ int main(void)
         midi_test(test_midi_sysex_loads_psg_envelope),
         midi_test(test_midi_sysex_inverts_total_level_values),
         midi_test(test_midi_sysex_sets_original_total_level_values),
+        midi_test(test_midi_sysex_remaps_cc),
+        midi_test(test_midi_sysex_remapped_cc_replaces_original_function),
+        midi_test(test_midi_sysex_tunes_single_note),
+        midi_test(test_midi_sysex_retunes_sounding_note),
+        midi_test(test_midi_sysex_ignores_no_change_tuning),
+        midi_test(test_midi_sysex_loads_bulk_tuning_dump),
+        midi_test(test_midi_sysex_streams_command_split_across_chunks),
+        midi_test(test_midi_sysex_ignores_command_with_extra_data),
+        midi_test(test_midi_sysex_rejects_psg_envelope_longer_than_limit),
+        midi_test(test_midi_sysex_loads_fm_patch_for_midi_channel),
+        midi_test(test_midi_sysex_loads_fm_patch_for_device_channel),
+        midi_test(test_midi_sysex_rejects_invalid_fm_patch),
+        midi_test(test_midi_sysex_dumps_fm_patch),
+        midi_test(test_midi_sysex_recalls_uploaded_user_preset),
+        midi_test(test_midi_sysex_stores_channel_parameters_as_user_preset),
+        midi_test(test_midi_sysex_bank_select_waits_for_program_change),
+        midi_test(test_midi_sysex_restoring_user_preset_reloads_channel),
+        midi_test(test_midi_sysex_rejects_user_preset_slot_out_of_range),
+        midi_test(test_midi_coalesces_volume_until_tick),
+        midi_test(test_midi_coalesces_pitch_bend_until_tick),
+        midi_test(test_midi_superseded_updates_count_saturates),
+        midi_test(test_midi_coalesced_updates_are_kept_per_channel),
+        midi_test(test_midi_flushes_coalesced_updates_before_note_on),
+        midi_test(test_midi_flushes_coalesced_updates_before_note_off),
+        midi_test(test_midi_does_not_coalesce_non_continuous_ccs),
         midi_test(
             test_midi_sets_all_channel_mappings_when_setting_polyphonic_mode),
         midi_test(test_midi_shows_fm_parameter_ui),
         midi_test(test_midi_hides_fm_parameter_ui),
+        midi_test(test_midi_selects_program_from_bank),
+        midi_test(test_midi_unknown_bank_falls_back_to_bank_0),
         midi_test(test_midi_reset_reinitialises_module),
 
         synth_test(test_synth_init_sets_initial_registers),
@@ -161,6 +224,8 @@ int main(void)
         synth_test(test_synth_sets_note_off_fm_reg_chan_0_to_2),
         synth_test(test_synth_sets_note_off_fm_reg_chan_3_to_5),
         synth_test(test_synth_sets_octave_and_freq_reg_chan),
+        synth_test(test_synth_commits_octave_only_change),
+        synth_test(test_synth_relatches_frequency_after_another_channel),
         synth_test(test_synth_sets_stereo_ams_and_freq),
         synth_test(test_synth_sets_algorithm),
         synth_test(test_synth_sets_feedback),
@@ -189,11 +254,26 @@ int main(void)
             test_synth_applies_volume_modifier_to_output_operators_algorithm_4),
         synth_test(
             test_synth_applies_volume_modifier_to_output_operators_algorithms_5_and_6),
+        synth_test(test_synth_does_not_rewrite_unchanged_registers),
+        synth_test(test_synth_counts_register_writes),
+        synth_test(test_synth_batches_preset_writes),
+        synth_test(test_synth_only_writes_changed_preset_registers),
+        synth_test(test_synth_rewrites_total_levels_when_algorithm_changes),
+        synth_test(test_synth_benchmarks_program_transitions),
+        synth_test(test_synth_streams_preset_image_registers),
+        synth_test(test_synth_preset_images_match_presets),
+        synth_test(test_synth_volume_changes_only_write_carriers),
         synth_test(test_synth_exposes_fm_channel_parameters),
         synth_test(test_synth_exposes_global_parameters),
         synth_test(test_synth_calls_callback_when_parameter_changes),
         synth_test(test_synth_calls_callback_when_lfo_freq_changes),
         synth_test(test_synth_calls_callback_when_lfo_enable_changes),
+        synth_test(test_synth_enables_ch3_special_mode),
+        synth_test(test_synth_sets_ch3_special_mode_operator_frequencies),
+        synth_test(
+            test_synth_commits_ch3_special_mode_operator_octave_change),
+        synth_test(test_synth_keys_ch3_special_mode_operators_independently),
+        synth_test(test_synth_applies_ch3_special_mode_volume_per_operator),
 
         comm_test(test_comm_reads_from_serial_when_ready),
         comm_test(test_comm_reads_when_ready),
@@ -224,12 +304,41 @@ int main(void)
         dynamic_midi_test(test_midi_exposes_dynamic_mode_mappings),
         dynamic_midi_test(test_midi_dynamic_enables_percussive_mode_if_needed),
         dynamic_midi_test(test_midi_sets_presets_on_dynamic_channels),
+        dynamic_midi_test(
+            test_midi_dynamic_applies_edited_patch_to_allocated_channel),
+        dynamic_midi_test(
+            test_midi_dynamic_updates_only_edited_field_of_patch),
+        dynamic_midi_test(test_midi_dynamic_global_lfo_does_not_edit_patch),
+        dynamic_midi_test(
+            test_midi_dynamic_program_change_discards_edited_patch),
         dynamic_midi_test(
             test_midi_dynamic_does_not_send_percussion_to_psg_channels),
+        dynamic_midi_test(test_midi_special_mode_adds_percussion_voices),
+        dynamic_midi_test(test_midi_special_mode_releases_percussion_voice),
+        dynamic_midi_test(test_midi_special_mode_reserves_fm_channel_3),
+        dynamic_midi_test(
+            test_midi_special_mode_disable_restores_fm_channel_3),
+        dynamic_midi_test(test_midi_dac_plays_drum_sample),
+        dynamic_midi_test(test_midi_dac_retriggers_drum_sample),
+        dynamic_midi_test(test_midi_dac_falls_back_to_fm_without_sample),
+        dynamic_midi_test(test_midi_dac_reserves_fm_channel_6),
+        dynamic_midi_test(test_midi_dac_disable_stops_sample),
+        dynamic_midi_test(test_midi_dac_prefers_uploaded_sample),
+        dynamic_midi_test(test_midi_dac_deletes_uploaded_sample),
+        dynamic_midi_test(
+            test_midi_dac_replacing_sample_keeps_other_key_playing),
+        dynamic_midi_test(test_midi_dac_ignores_fm_parameter_ccs),
+        dynamic_midi_test(test_midi_dac_stays_fm_without_z80_driver),
+        dynamic_midi_test(
+            test_midi_dac_refuses_sample_upload_without_z80_driver),
         dynamic_midi_test(test_midi_sysex_resets_dynamic_mode_state),
+        dynamic_midi_test(
+            test_midi_sysex_loaded_fm_patch_follows_dynamic_channel),
         dynamic_midi_test(
             test_midi_dynamic_sends_note_off_to_channel_playing_same_pitch),
         dynamic_midi_test(test_midi_dynamic_limits_percussion_notes),
+        dynamic_midi_test(
+            test_midi_dynamic_routes_drum_to_channel_holding_its_preset),
         dynamic_midi_test(test_midi_dynamic_maintains_volume_on_remapping),
         dynamic_midi_test(test_midi_dynamic_sets_volume_on_playing_notes),
         dynamic_midi_test(test_midi_dynamic_maintains_pan_on_remapping),
@@ -298,7 +407,50 @@ int main(void)
         buffer_test(test_buffer_available_returns_correct_value_when_empty),
         buffer_test(test_buffer_available_returns_correct_value_when_full),
         buffer_test(test_buffer_returns_cannot_write_if_full),
-        buffer_test(test_buffer_returns_can_write_if_empty)
+        buffer_test(test_buffer_returns_can_write_if_empty),
+        z80_ym_test(test_z80_ym_loads_driver),
+        z80_ym_test(test_z80_ym_driver_writes_registers_in_order),
+        z80_ym_test(test_z80_ym_driver_waits_for_batch_to_be_published),
+        z80_ym_test(test_z80_ym_driver_waits_while_ym2612_busy),
+        z80_ym_test(test_z80_ym_driver_wraps_around_ring),
+        z80_ym_test(test_z80_ym_driver_streams_sample_to_dac),
+        z80_ym_test(test_z80_ym_driver_mixes_register_writes_with_sample),
+        z80_ym_test(test_z80_ym_driver_switches_bank_mid_sample),
+        z80_ym_test(test_z80_ym_driver_stops_sample),
+        z80_ym_test(test_z80_ym_driver_restarts_retriggered_sample),
+        z80_ym_test(test_z80_ym_driver_streams_arena_sample),
+        z80_ym_test(test_z80_ym_driver_loops_arena_sample),
+        sample_bank_test(test_sample_bank_uploads_sample),
+        sample_bank_test(test_sample_bank_streams_upload_in_chunks),
+        sample_bank_test(test_sample_bank_rejects_bad_checksum),
+        sample_bank_test(test_sample_bank_rejects_truncated_upload),
+        sample_bank_test(test_sample_bank_rejects_sample_larger_than_arena),
+        sample_bank_test(test_sample_bank_rejects_loop_beyond_sample),
+        sample_bank_test(test_sample_bank_coalesces_freed_space),
+        sample_bank_test(test_sample_bank_replaces_sample_for_key),
+        sample_bank_test(
+            test_sample_bank_replacing_sample_keeps_other_key_playing),
+        sample_bank_test(test_sample_bank_replacing_playing_sample_stops_it),
+        sample_bank_test(
+            test_sample_bank_keeps_sample_when_replacement_fails),
+        sample_bank_test(test_sample_bank_limits_slots),
+        persistence_test(test_persistence_reads_back_written_image),
+        persistence_test(test_persistence_ignores_blank_sram),
+        persistence_test(test_persistence_rejects_bad_checksum),
+        persistence_test(test_persistence_rejects_newer_version),
+        midi_test(test_midi_restores_settings_from_sram),
+        midi_test(test_midi_saves_settings_on_next_tick),
+        midi_test(test_midi_saves_polyphonic_mode_on_next_tick),
+        midi_test(test_midi_restores_dynamic_mode_from_sram),
+        midi_test(test_midi_restores_channel_mapping_from_sram),
+        midi_test(test_midi_restores_user_presets_from_sram),
+        midi_test(test_midi_restores_user_envelope_from_sram),
+        midi_test(test_midi_restores_sections_of_older_layout),
+        midi_test(test_midi_ignores_corrupt_sram),
+        midi_test(test_midi_sysex_stores_psg_envelope_for_program),
+        midi_test(test_midi_sysex_empty_psg_envelope_removes_program_envelope),
+        midi_test(test_midi_sysex_rejects_psg_envelope_without_program),
+        midi_test(test_midi_restores_program_envelopes_from_sram)
     };
 
     return cmocka_run_group_tests(tests, NULL, NULL);
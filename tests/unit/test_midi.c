@@ -1,30 +1,37 @@
 #include "test_midi.h"
 #include "wraps.h"
 
-static const FmChannel M_BANK_0_INST_0_GRANDPIANO = { 2, 0, 3, 0, 0, 0, 0,
-    { { 1, 0, 26, 1, 7, 0, 7, 4, 1, 39, 0 },
-        { 4, 6, 24, 1, 9, 0, 6, 9, 7, 36, 0 },
-        { 2, 7, 31, 3, 23, 0, 9, 15, 1, 4, 0 },
-        { 1, 3, 27, 2, 4, 0, 10, 4, 6, 2, 0 } } };
-
-static const FmChannel M_BANK_0_INST_1_BRIGHTPIANO = { 5, 7, 3, 0, 0, 0, 0,
-    { { 4, 2, 27, 1, 9, 0, 11, 5, 6, 33, 0 },
-        { 4, 5, 27, 1, 9, 0, 7, 9, 7, 18, 0 },
-        { 1, 2, 27, 1, 5, 1, 10, 5, 6, 8, 0 },
-        { 6, 5, 27, 1, 9, 0, 3, 8, 7, 9, 0 } } };
-
-static const PercussionPreset P_BANK_0_INST_30_CASTANETS
-    = { { 4, 3, 3, 0, 0, 0, 0,
-            { { 9, 0, 31, 0, 11, 0, 15, 0, 15, 23, 0 },
-                { 1, 0, 31, 0, 19, 0, 15, 0, 15, 15, 0 },
-                { 4, 0, 31, 2, 20, 0, 15, 0, 15, 13, 0 },
-                { 2, 0, 31, 2, 20, 0, 15, 0, 15, 13, 0 } } },
+static const FmPresetImage M_BANK_0_INST_0_GRANDPIANO
+    = { { 0x02, 0xC0, 0x01, 0x72, 0x64, 0x31, 0x27, 0x04, 0x24, 0x02,
+        0x5A, 0xDF, 0x58, 0x9B, 0x07, 0x17, 0x09, 0x04, 0x04, 0x0F,
+        0x09, 0x04, 0x71, 0x91, 0x67, 0xA6, 0x00, 0x00, 0x00, 0x00 } };
+
+static const FmPresetImage M_BANK_0_INST_1_BRIGHTPIANO
+    = { { 0x3D, 0xC0, 0x24, 0x21, 0x54, 0x56, 0x21, 0x08, 0x12, 0x09,
+        0x5B, 0x5B, 0x5B, 0x5B, 0x09, 0x85, 0x09, 0x09, 0x05, 0x05,
+        0x09, 0x08, 0xB6, 0xA6, 0x77, 0x37, 0x00, 0x00, 0x00, 0x00 } };
+
+static const PercussionPresetImage P_BANK_0_INST_30_CASTANETS
+    = { { { 0x1C, 0xC0, 0x09, 0x04, 0x01, 0x02, 0x17, 0x0D, 0x0F, 0x0D,
+            0x1F, 0x9F, 0x1F, 0x9F, 0x0B, 0x14, 0x13, 0x14, 0x00, 0x00,
+            0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00 } },
           0 };
 
-static const FmChannel* M_BANK_0[MIDI_PROGRAMS]
+static const FmPresetImage M_BANK_1_INST_0_DETUNEDPIANO
+    = { { 0x02, 0xC0, 0x31, 0x12, 0x64, 0x31, 0x27, 0x04, 0x24, 0x02,
+        0x5A, 0xDF, 0x58, 0x9B, 0x07, 0x17, 0x09, 0x04, 0x04, 0x0F,
+        0x09, 0x04, 0x71, 0x91, 0x67, 0xA6, 0x00, 0x00, 0x00, 0x00 } };
+
+static const FmPresetImage* M_BANK_0[MIDI_PROGRAMS]
     = { &M_BANK_0_INST_0_GRANDPIANO, &M_BANK_0_INST_1_BRIGHTPIANO };
 
-static const PercussionPreset* P_BANK_0[MIDI_PROGRAMS];
+static const FmPresetImage* M_BANK_1[MIDI_PROGRAMS]
+    = { &M_BANK_1_INST_0_DETUNEDPIANO, &M_BANK_0_INST_1_BRIGHTPIANO };
+
+static const FmPresetImage** M_BANKS[MIDI_BANKS]
+    = { [0] = M_BANK_0, [1] = M_BANK_1 };
+
+static PercussionPresetImage P_BANK_0[MIDI_PROGRAMS];
 
 static const u8 ENVELOPE_0[] = { 0x00, EEF_LOOP_START, 0x00, EEF_END };
 static const u8 ENVELOPE_1[] = { 0x00, 0x0F, EEF_END };
@@ -62,11 +69,13 @@ static const u8* TEST_ENVELOPES[MIDI_PROGRAMS] = { ENVELOPE_0, ENVELOPE_1,
 
 int test_midi_setup(UNUSED void** state)
 {
-    P_BANK_0[30] = &P_BANK_0_INST_30_CASTANETS;
+    P_BANK_0[30] = P_BANK_0_INST_30_CASTANETS;
+    P_BANK_0[31] = P_BANK_0_INST_30_CASTANETS;
     expect_any(__wrap_synth_init, defaultPreset);
     wraps_disable_logging_checks();
     wraps_disable_checks();
-    midi_init(M_BANK_0, P_BANK_0, TEST_ENVELOPES);
+    wraps_sram_erase();
+    midi_init(M_BANKS, P_BANK_0, TEST_ENVELOPES);
     wraps_enable_checks();
     wraps_region_setIsPal(false);
     return 0;
@@ -106,15 +115,6 @@ void test_midi_sets_unknown_CC(UNUSED void** state)
     __real_midi_cc(0, expectedController, expectedValue);
 }
 
-void test_midi_ignores_sustain_pedal_cc(UNUSED void** state)
-{
-    wraps_enable_logging_checks();
-
-    u8 cc = 64;
-
-    __real_midi_cc(0, cc, 1);
-}
-
 void test_midi_ignores_sysex_nrpn_ccs(UNUSED void** state)
 {
     wraps_enable_logging_checks();
@@ -156,3 +156,36 @@ void test_midi_reset_reinitialises_module(UNUSED void** state)
     expect_any(__wrap_synth_init, defaultPreset);
     __real_midi_reset();
 }
+
+static void expectPresetNoteOn(u8 chan, const FmPresetImage* image)
+{
+    expect_value(__wrap_synth_presetImage, channel, chan);
+    expect_value(__wrap_synth_presetImage, image, image);
+    expect_value(__wrap_synth_stereo, channel, chan);
+    expect_any(__wrap_synth_stereo, mode);
+    expect_synth_pitch_any();
+    expect_synth_volume_any();
+    expect_value(__wrap_synth_noteOn, channel, chan);
+}
+
+void test_midi_selects_program_from_bank(UNUSED void** state)
+{
+    __real_midi_cc(0, CC_BANK_SELECT_MSB, 1);
+    __real_midi_cc(0, CC_BANK_SELECT_LSB, 0);
+    __real_midi_program(0, 0);
+
+    expectPresetNoteOn(0, &M_BANK_1_INST_0_DETUNEDPIANO);
+    __real_midi_note_on(0, MIDI_PITCH_C4, MAX_MIDI_VOLUME);
+}
+
+void test_midi_unknown_bank_falls_back_to_bank_0(UNUSED void** state)
+{
+    wraps_enable_logging_checks();
+
+    __real_midi_cc(0, CC_BANK_SELECT_MSB, 8);
+    __real_midi_cc(0, CC_BANK_SELECT_LSB, 1);
+    __real_midi_program(0, 1);
+
+    expectPresetNoteOn(0, &M_BANK_0_INST_1_BRIGHTPIANO);
+    __real_midi_note_on(0, MIDI_PITCH_C4, MAX_MIDI_VOLUME);
+}
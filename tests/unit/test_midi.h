@@ -34,11 +34,15 @@ extern void __real_midi_pitch_bend(u8 chan, u16 bend);
 extern void __real_midi_cc(u8 chan, u8 controller, u8 value);
 extern void __real_midi_program(u8 chan, u8 program);
 extern void __real_midi_sysex(const u8* data, u16 length);
+extern void __real_midi_sysex_begin(void);
+extern void __real_midi_sysex_data(const u8* data, u16 length);
+extern void __real_midi_sysex_end(void);
 extern bool __real_midi_dynamic_mode(void);
 extern DeviceChannel* __real_midi_channel_mappings(void);
 extern void __real_midi_psg_tick(void);
-extern void __real_midi_psg_load_envelope(const u8* eef);
+extern bool __real_midi_psg_load_envelope(const u8* eef);
 extern void __real_midi_reset(void);
+extern void __real_midi_tick(void);
 
 int test_midi_setup(UNUSED void** state);
 void test_midi_polyphonic_mode_returns_state(UNUSED void** state);
@@ -48,5 +52,6 @@ void test_midi_sets_unknown_CC(UNUSED void** state);
 void test_midi_shows_fm_parameter_ui(UNUSED void** state);
 void test_midi_hides_fm_parameter_ui(UNUSED void** state);
 void test_midi_reset_reinitialises_module(UNUSED void** state);
-void test_midi_ignores_sustain_pedal_cc(UNUSED void** state);
+void test_midi_selects_program_from_bank(UNUSED void** state);
+void test_midi_unknown_bank_falls_back_to_bank_0(UNUSED void** state);
 void test_midi_ignores_sysex_nrpn_ccs(UNUSED void** state);
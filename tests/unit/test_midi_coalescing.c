@@ -0,0 +1,117 @@
+#include "test_midi.h"
+
+static void enableCoalescing(void)
+{
+    const u8 sequence[] = { SYSEX_MANU_EXTENDED, SYSEX_MANU_REGION,
+        SYSEX_MANU_ID, SYSEX_COMMAND_COALESCE_UPDATES, 0x01 };
+
+    __real_midi_sysex(sequence, sizeof(sequence));
+}
+
+static void test_midi_coalesces_volume_until_tick(UNUSED void** state)
+{
+    enableCoalescing();
+
+    __real_midi_cc(0, CC_VOLUME, 10);
+    __real_midi_cc(0, CC_VOLUME, 20);
+    __real_midi_cc(0, CC_VOLUME, 30);
+
+    expect_synth_volume(0, 30);
+    __real_midi_tick();
+
+    assert_int_equal(midi_superseded_updates(), 2);
+}
+
+static void test_midi_coalesces_pitch_bend_until_tick(UNUSED void** state)
+{
+    enableCoalescing();
+
+    expect_synth_pitch(0, 4, SYNTH_NTSC_C);
+    expect_synth_volume_any();
+    expect_value(__wrap_synth_noteOn, channel, 0);
+    __real_midi_note_on(0, 60, MAX_MIDI_VOLUME);
+
+    __real_midi_pitch_bend(0, 0);
+    __real_midi_pitch_bend(0, 1000);
+
+    expect_synth_pitch(0, 3, 0x48a);
+    __real_midi_tick();
+
+    assert_int_equal(midi_superseded_updates(), 1);
+}
+
+static void test_midi_superseded_updates_count_saturates(UNUSED void** state)
+{
+    enableCoalescing();
+
+    for (u32 i = 0; i < 0x10010; i++) {
+        __real_midi_cc(0, CC_VOLUME, i & 0x7F);
+    }
+
+    expect_synth_volume_any();
+    __real_midi_tick();
+
+    assert_int_equal(midi_superseded_updates(), 0xFFFF);
+}
+
+static void test_midi_coalesced_updates_are_kept_per_channel(
+    UNUSED void** state)
+{
+    enableCoalescing();
+
+    __real_midi_cc(0, CC_VOLUME, 10);
+    __real_midi_cc(1, CC_VOLUME, 20);
+    __real_midi_cc(0, CC_PAN, 127);
+
+    expect_synth_volume(0, 10);
+    expect_synth_volume(1, 20);
+    expect_value(__wrap_synth_stereo, channel, 0);
+    expect_value(__wrap_synth_stereo, mode, STEREO_MODE_RIGHT);
+    __real_midi_tick();
+
+    assert_int_equal(midi_superseded_updates(), 0);
+}
+
+static void test_midi_flushes_coalesced_updates_before_note_on(
+    UNUSED void** state)
+{
+    enableCoalescing();
+
+    __real_midi_cc(0, CC_VOLUME, 50);
+
+    expect_synth_volume(0, 50);
+    expect_synth_pitch(0, 4, SYNTH_NTSC_C);
+    expect_synth_volume(0, 50);
+    expect_value(__wrap_synth_noteOn, channel, 0);
+    __real_midi_note_on(0, 60, MAX_MIDI_VOLUME);
+
+    __real_midi_tick();
+}
+
+static void test_midi_flushes_coalesced_updates_before_note_off(
+    UNUSED void** state)
+{
+    expect_synth_pitch(0, 4, SYNTH_NTSC_C);
+    expect_synth_volume_any();
+    expect_value(__wrap_synth_noteOn, channel, 0);
+    __real_midi_note_on(0, 60, MAX_MIDI_VOLUME);
+
+    enableCoalescing();
+    __real_midi_cc(0, CC_GENMDM_TOTAL_LEVEL_OP1, 5);
+
+    expect_value(__wrap_synth_operatorTotalLevel, channel, 0);
+    expect_value(__wrap_synth_operatorTotalLevel, op, 0);
+    expect_value(__wrap_synth_operatorTotalLevel, totalLevel, 5);
+    expect_value(__wrap_synth_noteOff, channel, 0);
+    __real_midi_note_off(0, 60);
+}
+
+static void test_midi_does_not_coalesce_non_continuous_ccs(
+    UNUSED void** state)
+{
+    enableCoalescing();
+
+    expect_value(__wrap_synth_algorithm, channel, 0);
+    expect_value(__wrap_synth_algorithm, algorithm, 1);
+    __real_midi_cc(0, CC_GENMDM_FM_ALGORITHM, 20);
+}
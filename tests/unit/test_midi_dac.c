@@ -0,0 +1,212 @@
+#include "sample_bank.h"
+#include "samples.h"
+#include "test_midi.h"
+
+static const u8 KICK_KEY = 36;
+
+static void enableDacDrums(void)
+{
+    const u8 sequence[] = { SYSEX_MANU_EXTENDED, SYSEX_MANU_REGION,
+        SYSEX_MANU_ID, SYSEX_COMMAND_DAC_DRUMS, 1 };
+
+    will_return(__wrap_synth_dacAvailable, true);
+    expect_value(__wrap_synth_dacEnable, enable, true);
+    __real_midi_sysex(sequence, sizeof(sequence));
+}
+
+static void expect_dac_sample(u8 key)
+{
+    const DacSample* sample = DAC_DRUM_SAMPLES[key];
+    expect_value(__wrap_synth_dacPlay, data, sample->data);
+    expect_value(__wrap_synth_dacPlay, length, sample->length);
+    expect_value(__wrap_synth_dacPlay, rate, sample->rate);
+}
+
+static void test_midi_dac_plays_drum_sample(UNUSED void** state)
+{
+    enableDacDrums();
+
+    expect_dac_sample(KICK_KEY);
+    __real_midi_note_on(
+        GENERAL_MIDI_PERCUSSION_CHANNEL, KICK_KEY, MAX_MIDI_VOLUME);
+}
+
+static void test_midi_dac_retriggers_drum_sample(UNUSED void** state)
+{
+    enableDacDrums();
+
+    expect_dac_sample(KICK_KEY);
+    __real_midi_note_on(
+        GENERAL_MIDI_PERCUSSION_CHANNEL, KICK_KEY, MAX_MIDI_VOLUME);
+
+    expect_dac_sample(KICK_KEY);
+    __real_midi_note_on(
+        GENERAL_MIDI_PERCUSSION_CHANNEL, KICK_KEY, MAX_MIDI_VOLUME);
+}
+
+static void test_midi_dac_falls_back_to_fm_without_sample(UNUSED void** state)
+{
+    const u8 MIDI_KEY = 30;
+
+    enableDacDrums();
+
+    expect_value(__wrap_synth_presetImage, channel, 0);
+    expect_any(__wrap_synth_presetImage, image);
+    expect_synth_pitch_any();
+    expect_synth_volume_any();
+    expect_value(__wrap_synth_noteOn, channel, 0);
+    __real_midi_note_on(
+        GENERAL_MIDI_PERCUSSION_CHANNEL, MIDI_KEY, MAX_MIDI_VOLUME);
+}
+
+static void test_midi_dac_reserves_fm_channel_6(UNUSED void** state)
+{
+    enableDacDrums();
+    for (u8 chan = DEV_CHAN_MIN_FM; chan < DAC_CHANNEL; chan++) {
+        expect_synth_pitch_any();
+        expect_synth_volume_any();
+        expect_value(__wrap_synth_noteOn, channel, chan);
+        __real_midi_note_on(0, MIDI_PITCH_C4 + chan, MAX_MIDI_VOLUME);
+    }
+
+    expect_any_psg_tone_on_channel(0);
+    expect_psg_attenuation(0, 0);
+    __real_midi_note_on(0, MIDI_PITCH_C4 + DAC_CHANNEL, MAX_MIDI_VOLUME);
+}
+
+static void test_midi_dac_disable_stops_sample(UNUSED void** state)
+{
+    const u8 sequence[] = { SYSEX_MANU_EXTENDED, SYSEX_MANU_REGION,
+        SYSEX_MANU_ID, SYSEX_COMMAND_DAC_DRUMS, 0 };
+
+    enableDacDrums();
+
+    expect_function_call(__wrap_synth_dacStop);
+    expect_value(__wrap_synth_dacEnable, enable, false);
+    __real_midi_sysex(sequence, sizeof(sequence));
+}
+
+static void uploadLoopedKickAt(u16 offset)
+{
+    const u8 sequence[] = { SYSEX_MANU_EXTENDED, SYSEX_MANU_REGION,
+        SYSEX_MANU_ID, SYSEX_COMMAND_UPLOAD_SAMPLE, KICK_KEY, 0x40, 0x3E, 0x00,
+        0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x01,
+        0x7F, 0x7B };
+
+    will_return(__wrap_synth_dacAvailable, true);
+    expect_value(__wrap_synth_dacLoad, offset, offset);
+    expect_any(__wrap_synth_dacLoad, data);
+    expect_value(__wrap_synth_dacLoad, length, 3);
+    __real_midi_sysex(sequence, sizeof(sequence));
+    assert_non_null(sample_bank_find(KICK_KEY));
+}
+
+static void uploadLoopedKick(void)
+{
+    uploadLoopedKickAt(0);
+}
+
+static void expectLoopedKickPlayed(u16 offset)
+{
+    expect_value(__wrap_synth_dacPlayLoaded, offset, offset);
+    expect_value(__wrap_synth_dacPlayLoaded, length, 3);
+    expect_value(__wrap_synth_dacPlayLoaded, rate, 8000);
+    expect_value(__wrap_synth_dacPlayLoaded, loopStart, 1);
+    expect_value(__wrap_synth_dacPlayLoaded, loopLength, 2);
+}
+
+static void test_midi_dac_prefers_uploaded_sample(UNUSED void** state)
+{
+    enableDacDrums();
+    uploadLoopedKick();
+
+    expectLoopedKickPlayed(0);
+    __real_midi_note_on(
+        GENERAL_MIDI_PERCUSSION_CHANNEL, KICK_KEY, MAX_MIDI_VOLUME);
+
+    expect_function_call(__wrap_synth_dacStop);
+    __real_midi_note_off(GENERAL_MIDI_PERCUSSION_CHANNEL, KICK_KEY);
+}
+
+static void test_midi_dac_deletes_uploaded_sample(UNUSED void** state)
+{
+    const u8 sequence[] = { SYSEX_MANU_EXTENDED, SYSEX_MANU_REGION,
+        SYSEX_MANU_ID, SYSEX_COMMAND_DELETE_SAMPLE, KICK_KEY };
+
+    enableDacDrums();
+    uploadLoopedKick();
+    expectLoopedKickPlayed(0);
+    __real_midi_note_on(
+        GENERAL_MIDI_PERCUSSION_CHANNEL, KICK_KEY, MAX_MIDI_VOLUME);
+
+    expect_function_call(__wrap_synth_dacStop);
+    __real_midi_sysex(sequence, sizeof(sequence));
+
+    expect_dac_sample(KICK_KEY);
+    __real_midi_note_on(
+        GENERAL_MIDI_PERCUSSION_CHANNEL, KICK_KEY, MAX_MIDI_VOLUME);
+}
+
+static void test_midi_dac_replacing_sample_keeps_other_key_playing(
+    UNUSED void** state)
+{
+    const u8 SNARE_KEY = 38;
+
+    enableDacDrums();
+    uploadLoopedKick();
+    expect_dac_sample(SNARE_KEY);
+    __real_midi_note_on(
+        GENERAL_MIDI_PERCUSSION_CHANNEL, SNARE_KEY, MAX_MIDI_VOLUME);
+
+    uploadLoopedKickAt(3);
+
+    expectLoopedKickPlayed(3);
+    __real_midi_note_on(
+        GENERAL_MIDI_PERCUSSION_CHANNEL, KICK_KEY, MAX_MIDI_VOLUME);
+}
+
+static void test_midi_dac_stays_fm_without_z80_driver(UNUSED void** state)
+{
+    const u8 sequence[] = { SYSEX_MANU_EXTENDED, SYSEX_MANU_REGION,
+        SYSEX_MANU_ID, SYSEX_COMMAND_DAC_DRUMS, 1 };
+    const u8 MIDI_KEY = 30;
+
+    wraps_enable_logging_checks();
+    will_return(__wrap_synth_dacAvailable, false);
+    expect_log_warn("DAC drums need Z80 driver");
+    __real_midi_sysex(sequence, sizeof(sequence));
+
+    expect_value(__wrap_synth_presetImage, channel, 0);
+    expect_any(__wrap_synth_presetImage, image);
+    expect_synth_pitch_any();
+    expect_synth_volume_any();
+    expect_value(__wrap_synth_noteOn, channel, 0);
+    __real_midi_note_on(
+        GENERAL_MIDI_PERCUSSION_CHANNEL, MIDI_KEY, MAX_MIDI_VOLUME);
+}
+
+static void test_midi_dac_refuses_sample_upload_without_z80_driver(
+    UNUSED void** state)
+{
+    const u8 sequence[] = { SYSEX_MANU_EXTENDED, SYSEX_MANU_REGION,
+        SYSEX_MANU_ID, SYSEX_COMMAND_UPLOAD_SAMPLE, KICK_KEY, 0x40, 0x3E, 0x00,
+        0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x01,
+        0x7F, 0x7B };
+
+    wraps_enable_logging_checks();
+    will_return(__wrap_synth_dacAvailable, false);
+    expect_log_warn("Samples need Z80 driver");
+    __real_midi_sysex(sequence, sizeof(sequence));
+
+    assert_null(sample_bank_find(KICK_KEY));
+}
+
+static void test_midi_dac_ignores_fm_parameter_ccs(UNUSED void** state)
+{
+    enableDacDrums();
+    expect_dac_sample(KICK_KEY);
+    __real_midi_note_on(
+        GENERAL_MIDI_PERCUSSION_CHANNEL, KICK_KEY, MAX_MIDI_VOLUME);
+
+    __real_midi_cc(GENERAL_MIDI_PERCUSSION_CHANNEL, CC_GENMDM_FM_ALGORITHM, 16);
+}
@@ -159,8 +159,8 @@ static void test_midi_dynamic_enables_percussive_mode_if_needed(
 {
     const u8 MIDI_KEY = 30;
 
-    expect_value(__wrap_synth_preset, channel, 0);
-    expect_any(__wrap_synth_preset, preset);
+    expect_value(__wrap_synth_presetImage, channel, 0);
+    expect_any(__wrap_synth_presetImage, image);
 
     expect_synth_pitch_any();
     expect_synth_volume_any();
@@ -170,8 +170,8 @@ static void test_midi_dynamic_enables_percussive_mode_if_needed(
     __real_midi_note_on(
         GENERAL_MIDI_PERCUSSION_CHANNEL, MIDI_KEY, MAX_MIDI_VOLUME);
 
-    expect_value(__wrap_synth_preset, channel, 1);
-    expect_any(__wrap_synth_preset, preset);
+    expect_value(__wrap_synth_presetImage, channel, 1);
+    expect_any(__wrap_synth_presetImage, image);
 
     expect_synth_pitch_any();
     expect_synth_volume_any();
@@ -184,12 +184,12 @@ static void test_midi_dynamic_enables_percussive_mode_if_needed(
 
 static void test_midi_sets_presets_on_dynamic_channels(UNUSED void** state)
 {
-    expect_value(__wrap_synth_preset, channel, 0);
-    expect_any(__wrap_synth_preset, preset);
-    expect_any(__wrap_synth_stereo, channel);
-    expect_any(__wrap_synth_stereo, mode);
     __real_midi_program(0, 2);
 
+    expect_value(__wrap_synth_presetImage, channel, 0);
+    expect_any(__wrap_synth_presetImage, image);
+    expect_any(__wrap_synth_stereo, channel);
+    expect_any(__wrap_synth_stereo, mode);
     expect_synth_pitch_any();
     expect_synth_volume_any();
     expect_value(__wrap_synth_noteOn, channel, 0);
@@ -197,8 +197,8 @@ static void test_midi_sets_presets_on_dynamic_channels(UNUSED void** state)
     print_message("Playing first note\n");
     __real_midi_note_on(0, MIDI_PITCH_AS6, MAX_MIDI_VOLUME);
 
-    expect_value(__wrap_synth_preset, channel, 1);
-    expect_any(__wrap_synth_preset, preset);
+    expect_value(__wrap_synth_presetImage, channel, 1);
+    expect_any(__wrap_synth_presetImage, image);
     expect_any(__wrap_synth_stereo, channel);
     expect_any(__wrap_synth_stereo, mode);
     expect_synth_pitch_any();
@@ -209,6 +209,106 @@ static void test_midi_sets_presets_on_dynamic_channels(UNUSED void** state)
     __real_midi_note_on(0, MIDI_PITCH_AS6, MAX_MIDI_VOLUME);
 }
 
+static const FmChannel EDITED_PATCH = { 7, 3, 3, 0, 0, 0, 0,
+    { { 1, 0, 26, 1, 7, 0, 7, 4, 1, 39, 0 },
+        { 4, 6, 24, 1, 9, 0, 6, 9, 7, 36, 0 },
+        { 2, 7, 31, 3, 23, 0, 9, 15, 1, 4, 0 },
+        { 1, 3, 27, 2, 4, 0, 10, 4, 6, 2, 0 } } };
+
+static void editPatchOnFirstChannel(void)
+{
+    expect_synth_pitch_any();
+    expect_synth_volume_any();
+    expect_value(__wrap_synth_noteOn, channel, 0);
+    __real_midi_note_on(0, MIDI_PITCH_AS6, MAX_MIDI_VOLUME);
+
+    wraps_synth_setChannelParameters(&EDITED_PATCH);
+    expect_value(__wrap_synth_algorithm, channel, 0);
+    expect_value(__wrap_synth_algorithm, algorithm, 7);
+    __real_midi_cc(0, CC_GENMDM_FM_ALGORITHM, 127);
+}
+
+static void test_midi_dynamic_applies_edited_patch_to_allocated_channel(
+    UNUSED void** state)
+{
+    editPatchOnFirstChannel();
+
+    expect_value(__wrap_synth_preset, channel, 1);
+    expect_memory(
+        __wrap_synth_preset, preset, &EDITED_PATCH, sizeof(EDITED_PATCH));
+    expect_any(__wrap_synth_stereo, channel);
+    expect_any(__wrap_synth_stereo, mode);
+    expect_synth_pitch_any();
+    expect_synth_volume_any();
+    expect_value(__wrap_synth_noteOn, channel, 1);
+    __real_midi_note_on(0, MIDI_PITCH_AS6, MAX_MIDI_VOLUME);
+}
+
+static void test_midi_dynamic_updates_only_edited_field_of_patch(
+    UNUSED void** state)
+{
+    editPatchOnFirstChannel();
+
+    FmChannel unrelatedChanges = EDITED_PATCH;
+    unrelatedChanges.feedback = 5;
+    unrelatedChanges.operators[0].multiple = 9;
+    wraps_synth_setChannelParameters(&unrelatedChanges);
+    expect_value(__wrap_synth_feedback, channel, 0);
+    expect_value(__wrap_synth_feedback, feedback, 5);
+    __real_midi_cc(0, CC_GENMDM_FM_FEEDBACK, 80);
+
+    FmChannel expected = EDITED_PATCH;
+    expected.feedback = 5;
+    expect_value(__wrap_synth_preset, channel, 1);
+    expect_memory(__wrap_synth_preset, preset, &expected, sizeof(expected));
+    expect_any(__wrap_synth_stereo, channel);
+    expect_any(__wrap_synth_stereo, mode);
+    expect_synth_pitch_any();
+    expect_synth_volume_any();
+    expect_value(__wrap_synth_noteOn, channel, 1);
+    __real_midi_note_on(0, MIDI_PITCH_AS6, MAX_MIDI_VOLUME);
+}
+
+static void test_midi_dynamic_global_lfo_does_not_edit_patch(
+    UNUSED void** state)
+{
+    expect_synth_pitch_any();
+    expect_synth_volume_any();
+    expect_value(__wrap_synth_noteOn, channel, 0);
+    __real_midi_note_on(0, MIDI_PITCH_AS6, MAX_MIDI_VOLUME);
+
+    expect_value(__wrap_synth_enableLfo, enable, 1);
+    __real_midi_cc(0, CC_GENMDM_GLOBAL_LFO_ENABLE, 127);
+
+    expect_synth_pitch_any();
+    expect_synth_volume_any();
+    expect_value(__wrap_synth_noteOn, channel, 1);
+    __real_midi_note_on(0, MIDI_PITCH_AS6, MAX_MIDI_VOLUME);
+}
+
+static void test_midi_dynamic_program_change_discards_edited_patch(
+    UNUSED void** state)
+{
+    const FmPresetImage M_BANK_0_INST_1_BRIGHTPIANO
+        = { { 0x3D, 0xC0, 0x24, 0x21, 0x54, 0x56, 0x21, 0x08, 0x12, 0x09,
+            0x5B, 0x5B, 0x5B, 0x5B, 0x09, 0x85, 0x09, 0x09, 0x05, 0x05,
+            0x09, 0x08, 0xB6, 0xA6, 0x77, 0x37, 0x00, 0x00, 0x00, 0x00 } };
+
+    editPatchOnFirstChannel();
+
+    __real_midi_program(0, 1);
+
+    expect_value(__wrap_synth_presetImage, channel, 1);
+    expect_memory(__wrap_synth_presetImage, image, &M_BANK_0_INST_1_BRIGHTPIANO,
+        sizeof(M_BANK_0_INST_1_BRIGHTPIANO));
+    expect_any(__wrap_synth_stereo, channel);
+    expect_any(__wrap_synth_stereo, mode);
+    expect_synth_pitch_any();
+    expect_synth_volume_any();
+    expect_value(__wrap_synth_noteOn, channel, 1);
+    __real_midi_note_on(0, MIDI_PITCH_AS6, MAX_MIDI_VOLUME);
+}
+
 static void test_midi_dynamic_does_not_send_percussion_to_psg_channels(
     UNUSED void** state)
 {
@@ -290,8 +390,8 @@ static void test_midi_dynamic_limits_percussion_notes(UNUSED void** state)
         expect_synth_pitch_any();
         expect_synth_volume_any();
         expect_value(__wrap_synth_noteOn, channel, i);
-        expect_value(__wrap_synth_preset, channel, i);
-        expect_any(__wrap_synth_preset, preset);
+        expect_value(__wrap_synth_presetImage, channel, i);
+        expect_any(__wrap_synth_presetImage, image);
 
         print_message("Drum %d\n", i + 1);
         __real_midi_note_on(
@@ -303,6 +403,33 @@ static void test_midi_dynamic_limits_percussion_notes(UNUSED void** state)
         GENERAL_MIDI_PERCUSSION_CHANNEL, DRUM_KEY, MAX_MIDI_VOLUME);
 }
 
+static void test_midi_dynamic_routes_drum_to_channel_holding_its_preset(
+    UNUSED void** state)
+{
+    const u8 DRUM_KEYS[] = { 30, 31 };
+
+    for (u8 i = 0; i < 2; i++) {
+        expect_value(__wrap_synth_presetImage, channel, i);
+        expect_any(__wrap_synth_presetImage, image);
+        expect_synth_pitch_any();
+        expect_synth_volume_any();
+        expect_value(__wrap_synth_noteOn, channel, i);
+        __real_midi_note_on(
+            GENERAL_MIDI_PERCUSSION_CHANNEL, DRUM_KEYS[i], MAX_MIDI_VOLUME);
+    }
+    for (u8 i = 0; i < 2; i++) {
+        expect_value(__wrap_synth_noteOff, channel, i);
+        __real_midi_note_off(GENERAL_MIDI_PERCUSSION_CHANNEL, DRUM_KEYS[i]);
+    }
+
+    print_message("Replaying second drum\n");
+    expect_synth_pitch_any();
+    expect_synth_volume_any();
+    expect_value(__wrap_synth_noteOn, channel, 1);
+    __real_midi_note_on(
+        GENERAL_MIDI_PERCUSSION_CHANNEL, DRUM_KEYS[1], MAX_MIDI_VOLUME);
+}
+
 static void test_midi_dynamic_maintains_volume_on_remapping(UNUSED void** state)
 {
     const u8 midi_vol = 50;
@@ -402,10 +529,10 @@ static void test_midi_dynamic_maintains_pitch_bend_on_remapping(
     __real_midi_note_on(0, MIDI_PITCH_AS6, MAX_MIDI_VOLUME);
 
     print_message("Setting bend\n");
-    expect_synth_pitch(0, 6, 0x4b0);
+    expect_synth_pitch(0, 7, 0x25f);
     __real_midi_pitch_bend(0, midi_bend);
 
-    expect_synth_pitch(1, 7, 0x295);
+    expect_synth_pitch(1, 7, 0x284);
     expect_synth_pitch(1, 7,
         0x25f); // defaults back as pitch bend not taken into consideration on
     // note on
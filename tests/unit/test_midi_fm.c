@@ -423,6 +423,50 @@ static void test_midi_sets_global_LFO_enable(UNUSED void** state)
     __real_midi_cc(0, 74, 64);
 }
 
+/* Rough 68000 cycle costs of dispatching an FM parameter CC. The old
+   switch ran once per mapped channel: a bounds-checked jump table, a call
+   to isIgnoringNonGeneralMidiCCs() and a RANGE() division. The table is
+   looked up and its flags tested once per CC, and each mapped channel costs
+   an indirect call and a shift. */
+static const u32 CYCLES_SWITCH = 40;
+static const u32 CYCLES_CALL = 36;
+static const u32 CYCLES_DIVIDE = 140;
+static const u32 CYCLES_TABLE_LOOKUP = 50;
+static const u32 CYCLES_INDIRECT_CALL = 20;
+static const u32 CYCLES_SHIFT = 14;
+
+static u32 switchDispatchCycles(u8 channels)
+{
+    return channels * (CYCLES_SWITCH + CYCLES_CALL + CYCLES_DIVIDE);
+}
+
+static u32 tableDispatchCycles(u8 channels)
+{
+    return CYCLES_TABLE_LOOKUP
+        + channels * (CYCLES_INDIRECT_CALL + CYCLES_SHIFT);
+}
+
+static void test_midi_dispatches_fm_cc_once_per_mapped_channel(
+    UNUSED void** state)
+{
+    __real_midi_cc(0, CC_POLYPHONIC_MODE, 127);
+
+    u8 channels = 0;
+    for (u8 chan = 0; chan <= MAX_FM_CHAN; chan++, channels++) {
+        expect_value(__wrap_synth_algorithm, channel, chan);
+        expect_value(__wrap_synth_algorithm, algorithm, 7);
+    }
+    __real_midi_cc(0, CC_GENMDM_FM_ALGORITHM, 127);
+
+    u32 before = switchDispatchCycles(channels);
+    u32 after = tableDispatchCycles(channels);
+    print_message("Estimated 68000 cycles per CC to %d channels: %u -> %u\n",
+        channels, before, after);
+    assert_true(after * 3 < before);
+
+    __real_midi_cc(0, CC_POLYPHONIC_MODE, 0);
+}
+
 static void test_midi_sets_global_LFO_frequency(UNUSED void** state)
 {
     expect_value(__wrap_synth_globalLfoFrequency, freq, 1);
@@ -435,19 +479,101 @@ static void test_midi_sets_fm_preset(UNUSED void** state)
     const u8 program = 1;
     const u8 chan = 0;
 
-    const FmChannel M_BANK_0_INST_1_BRIGHTPIANO = { 5, 7, 3, 0, 0, 0, 0,
-        { { 4, 2, 27, 1, 9, 0, 11, 5, 6, 33, 0 },
-            { 4, 5, 27, 1, 9, 0, 7, 9, 7, 18, 0 },
-            { 1, 2, 27, 1, 5, 1, 10, 5, 6, 8, 0 },
-            { 6, 5, 27, 1, 9, 0, 3, 8, 7, 9, 0 } } };
+    const FmPresetImage M_BANK_0_INST_1_BRIGHTPIANO
+        = { { 0x3D, 0xC0, 0x24, 0x21, 0x54, 0x56, 0x21, 0x08, 0x12, 0x09,
+            0x5B, 0x5B, 0x5B, 0x5B, 0x09, 0x85, 0x09, 0x09, 0x05, 0x05,
+            0x09, 0x08, 0xB6, 0xA6, 0x77, 0x37, 0x00, 0x00, 0x00, 0x00 } };
 
-    expect_value(__wrap_synth_preset, channel, chan);
-    expect_memory(__wrap_synth_preset, preset, &M_BANK_0_INST_1_BRIGHTPIANO,
+    __real_midi_program(chan, program);
+
+    expect_value(__wrap_synth_presetImage, channel, chan);
+    expect_memory(__wrap_synth_presetImage, image, &M_BANK_0_INST_1_BRIGHTPIANO,
         sizeof(M_BANK_0_INST_1_BRIGHTPIANO));
     expect_value(__wrap_synth_stereo, channel, chan);
     expect_any(__wrap_synth_stereo, mode);
+    expect_synth_pitch(chan, 4, SYNTH_NTSC_C);
+    expect_synth_volume_any();
+    expect_value(__wrap_synth_noteOn, channel, chan);
 
-    __real_midi_program(chan, program);
+    __real_midi_note_on(chan, 60, MAX_MIDI_VOLUME);
+}
+
+static void test_midi_program_change_is_applied_on_next_note_on(
+    UNUSED void** state)
+{
+    const u8 chan = 0;
+
+    __real_midi_program(chan, 1);
+    __real_midi_program(chan, 0);
+
+    expect_synth_pitch(chan, 4, SYNTH_NTSC_C);
+    expect_synth_volume_any();
+    expect_value(__wrap_synth_noteOn, channel, chan);
+
+    __real_midi_note_on(chan, 60, MAX_MIDI_VOLUME);
+}
+
+static void test_midi_applies_program_before_fm_parameter_cc(
+    UNUSED void** state)
+{
+    const u8 chan = 0;
+
+    __real_midi_program(chan, 1);
+
+    expect_value(__wrap_synth_presetImage, channel, chan);
+    expect_any(__wrap_synth_presetImage, image);
+    expect_value(__wrap_synth_stereo, channel, chan);
+    expect_any(__wrap_synth_stereo, mode);
+    expect_value(__wrap_synth_algorithm, channel, chan);
+    expect_value(__wrap_synth_algorithm, algorithm, 1);
+    __real_midi_cc(chan, CC_GENMDM_FM_ALGORITHM, 20);
+
+    expect_synth_pitch(chan, 4, SYNTH_NTSC_C);
+    expect_synth_volume_any();
+    expect_value(__wrap_synth_noteOn, channel, chan);
+    __real_midi_note_on(chan, 60, MAX_MIDI_VOLUME);
+}
+
+static void test_midi_applies_volume_cc_between_program_and_note_on(
+    UNUSED void** state)
+{
+    const u8 chan = 0;
+
+    __real_midi_program(chan, 1);
+
+    expect_synth_volume(chan, 64);
+    __real_midi_cc(chan, CC_VOLUME, 64);
+
+    expect_value(__wrap_synth_presetImage, channel, chan);
+    expect_any(__wrap_synth_presetImage, image);
+    expect_value(__wrap_synth_stereo, channel, chan);
+    expect_any(__wrap_synth_stereo, mode);
+    expect_synth_pitch(chan, 4, SYNTH_NTSC_C);
+    expect_synth_volume(chan, 64);
+    expect_value(__wrap_synth_noteOn, channel, chan);
+    __real_midi_note_on(chan, 60, MAX_MIDI_VOLUME);
+}
+
+static void test_midi_applies_program_when_showing_fm_parameters(
+    UNUSED void** state)
+{
+    const u8 chan = 0;
+
+    __real_midi_program(chan, 1);
+
+    expect_value(__wrap_synth_presetImage, channel, chan);
+    expect_any(__wrap_synth_presetImage, image);
+    expect_value(__wrap_synth_stereo, channel, chan);
+    expect_any(__wrap_synth_stereo, mode);
+    expect_value(__wrap_ui_fm_set_parameters_visibility, chan, chan);
+    expect_value(__wrap_ui_fm_set_parameters_visibility, show, true);
+    __real_midi_cc(chan, CC_SHOW_PARAMETERS_ON_UI, 127);
+
+    expect_value(__wrap_synth_presetImage, channel, chan);
+    expect_any(__wrap_synth_presetImage, image);
+    expect_value(__wrap_synth_stereo, channel, chan);
+    expect_any(__wrap_synth_stereo, mode);
+    __real_midi_program(chan, 0);
 }
 
 static void test_midi_sets_synth_pitch_bend(UNUSED void** state)
@@ -458,11 +584,65 @@ static void test_midi_sets_synth_pitch_bend(UNUSED void** state)
         expect_value(__wrap_synth_noteOn, channel, chan);
         __real_midi_note_on(chan, 60, MAX_MIDI_VOLUME);
 
-        expect_synth_pitch(chan, 4, 0x225);
+        expect_synth_pitch(chan, 3, 0x48a);
         __real_midi_pitch_bend(chan, 1000);
     }
 }
 
+static void test_midi_pitch_bend_crosses_octave_boundary(UNUSED void** state)
+{
+    const u8 chan = 0;
+    const u8 pitchAS3 = 58;
+    const u16 bendUpOneAndAHalfSemitones = 0x3800;
+
+    expect_synth_pitch(chan, 3, SYNTH_NTSC_AS);
+    expect_synth_volume_any();
+    expect_value(__wrap_synth_noteOn, channel, chan);
+    __real_midi_note_on(chan, pitchAS3, MAX_MIDI_VOLUME);
+
+    expect_synth_pitch(chan, 4, 625);
+    __real_midi_pitch_bend(chan, bendUpOneAndAHalfSemitones);
+}
+
+static void test_midi_rpn_sets_pitch_bend_range(UNUSED void** state)
+{
+    const u8 chan = 0;
+
+    expect_synth_pitch(chan, 4, SYNTH_NTSC_C);
+    expect_synth_volume_any();
+    expect_value(__wrap_synth_noteOn, channel, chan);
+    __real_midi_note_on(chan, MIDI_PITCH_C4, MAX_MIDI_VOLUME);
+
+    expect_synth_pitch(chan, 3, 0x47a);
+    __real_midi_pitch_bend(chan, 0);
+
+    __real_midi_cc(chan, CC_RPN_MSB, 0);
+    __real_midi_cc(chan, CC_RPN_LSB, 0);
+    expect_synth_pitch(chan, 3, SYNTH_NTSC_C);
+    __real_midi_cc(chan, CC_DATA_ENTRY_MSB, 12);
+
+    expect_synth_pitch(chan, 3, 625);
+    __real_midi_cc(chan, CC_DATA_ENTRY_LSB, 50);
+}
+
+static void test_midi_nrpn_deselects_pitch_bend_range(UNUSED void** state)
+{
+    const u8 chan = 0;
+
+    __real_midi_cc(chan, CC_RPN_MSB, 0);
+    __real_midi_cc(chan, CC_RPN_LSB, 0);
+    __real_midi_cc(chan, CC_NRPN_MSB, 0);
+    __real_midi_cc(chan, CC_DATA_ENTRY_MSB, 12);
+
+    expect_synth_pitch(chan, 4, SYNTH_NTSC_C);
+    expect_synth_volume_any();
+    expect_value(__wrap_synth_noteOn, channel, chan);
+    __real_midi_note_on(chan, MIDI_PITCH_C4, MAX_MIDI_VOLUME);
+
+    expect_synth_pitch(chan, 3, 0x47a);
+    __real_midi_pitch_bend(chan, 0);
+}
+
 static void remap_midi_channel(u8 midiChannel, u8 deviceChannel)
 {
     u8 sequence[] = { SYSEX_MANU_EXTENDED, SYSEX_MANU_REGION, SYSEX_MANU_ID,
@@ -480,23 +660,75 @@ static void test_midi_fm_note_on_percussion_channel_sets_percussion_preset(
 
     remap_midi_channel(MIDI_PERCUSSION_CHANNEL, FM_CHANNEL);
 
-    const FmChannel P_BANK_0_INST_30_CASTANETS = { 4, 3, 3, 0, 0, 0, 0,
-        { { 9, 0, 31, 0, 11, 0, 15, 0, 15, 23, 0 },
-            { 1, 0, 31, 0, 19, 0, 15, 0, 15, 15, 0 },
-            { 4, 0, 31, 2, 20, 0, 15, 0, 15, 13, 0 },
-            { 2, 0, 31, 2, 20, 0, 15, 0, 15, 13, 0 } } };
+    const FmPresetImage P_BANK_0_INST_30_CASTANETS
+        = { { 0x1C, 0xC0, 0x09, 0x04, 0x01, 0x02, 0x17, 0x0D, 0x0F, 0x0D,
+            0x1F, 0x9F, 0x1F, 0x9F, 0x0B, 0x14, 0x13, 0x14, 0x00, 0x00,
+            0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00 } };
 
-    expect_value(__wrap_synth_preset, channel, FM_CHANNEL);
-    expect_memory(__wrap_synth_preset, preset, &P_BANK_0_INST_30_CASTANETS,
+    expect_value(__wrap_synth_presetImage, channel, FM_CHANNEL);
+    expect_memory(__wrap_synth_presetImage, image, &P_BANK_0_INST_30_CASTANETS,
         sizeof(P_BANK_0_INST_30_CASTANETS));
 
     expect_synth_volume_any();
-    expect_synth_pitch(FM_CHANNEL, 0, 0x32a);
+    expect_synth_pitch(FM_CHANNEL, 0, 0x142);
     expect_value(__wrap_synth_noteOn, channel, FM_CHANNEL);
 
     __real_midi_note_on(MIDI_PERCUSSION_CHANNEL, MIDI_KEY, MAX_MIDI_VOLUME);
 }
 
+static void test_midi_fm_percussion_channel_reuses_loaded_preset(
+    UNUSED void** state)
+{
+    const u8 MIDI_PERCUSSION_CHANNEL = 9;
+    const u8 FM_CHANNEL = 5;
+    const u8 MIDI_KEY = 30;
+
+    remap_midi_channel(MIDI_PERCUSSION_CHANNEL, FM_CHANNEL);
+
+    expect_value(__wrap_synth_presetImage, channel, FM_CHANNEL);
+    expect_any(__wrap_synth_presetImage, image);
+    for (u8 i = 0; i < 2; i++) {
+        expect_synth_volume_any();
+        expect_synth_pitch(FM_CHANNEL, 0, 0x142);
+        expect_value(__wrap_synth_noteOn, channel, FM_CHANNEL);
+        __real_midi_note_on(MIDI_PERCUSSION_CHANNEL, MIDI_KEY, MAX_MIDI_VOLUME);
+
+        expect_value(__wrap_synth_noteOff, channel, FM_CHANNEL);
+        __real_midi_note_off(MIDI_PERCUSSION_CHANNEL, MIDI_KEY);
+    }
+}
+
+static void test_midi_fm_percussion_channel_reloads_edited_preset(
+    UNUSED void** state)
+{
+    const u8 MIDI_PERCUSSION_CHANNEL = 9;
+    const u8 FM_CHANNEL = 5;
+    const u8 MIDI_KEY = 30;
+
+    remap_midi_channel(MIDI_PERCUSSION_CHANNEL, FM_CHANNEL);
+
+    expect_value(__wrap_synth_presetImage, channel, FM_CHANNEL);
+    expect_any(__wrap_synth_presetImage, image);
+    expect_synth_volume_any();
+    expect_synth_pitch_any();
+    expect_value(__wrap_synth_noteOn, channel, FM_CHANNEL);
+    __real_midi_note_on(MIDI_PERCUSSION_CHANNEL, MIDI_KEY, MAX_MIDI_VOLUME);
+
+    expect_value(__wrap_synth_algorithm, channel, FM_CHANNEL);
+    expect_value(__wrap_synth_algorithm, algorithm, 1);
+    __real_midi_cc(MIDI_PERCUSSION_CHANNEL, CC_GENMDM_FM_ALGORITHM, 16);
+
+    expect_value(__wrap_synth_noteOff, channel, FM_CHANNEL);
+    __real_midi_note_off(MIDI_PERCUSSION_CHANNEL, MIDI_KEY);
+
+    expect_value(__wrap_synth_presetImage, channel, FM_CHANNEL);
+    expect_any(__wrap_synth_presetImage, image);
+    expect_synth_volume_any();
+    expect_synth_pitch_any();
+    expect_value(__wrap_synth_noteOn, channel, FM_CHANNEL);
+    __real_midi_note_on(MIDI_PERCUSSION_CHANNEL, MIDI_KEY, MAX_MIDI_VOLUME);
+}
+
 static void test_midi_switching_program_retains_pan_setting(UNUSED void** state)
 {
     const u8 program = 1;
@@ -507,17 +739,21 @@ static void test_midi_switching_program_retains_pan_setting(UNUSED void** state)
 
     __real_midi_cc(0, CC_PAN, 127);
 
-    const FmChannel M_BANK_0_INST_1_BRIGHTPIANO = { 5, 7, 3, 0, 0, 0, 0,
-        { { 4, 2, 27, 1, 9, 0, 11, 5, 6, 33, 0 },
-            { 4, 5, 27, 1, 9, 0, 7, 9, 7, 18, 0 },
-            { 1, 2, 27, 1, 5, 1, 10, 5, 6, 8, 0 },
-            { 6, 5, 27, 1, 9, 0, 3, 8, 7, 9, 0 } } };
+    const FmPresetImage M_BANK_0_INST_1_BRIGHTPIANO
+        = { { 0x3D, 0xC0, 0x24, 0x21, 0x54, 0x56, 0x21, 0x08, 0x12, 0x09,
+            0x5B, 0x5B, 0x5B, 0x5B, 0x09, 0x85, 0x09, 0x09, 0x05, 0x05,
+            0x09, 0x08, 0xB6, 0xA6, 0x77, 0x37, 0x00, 0x00, 0x00, 0x00 } };
 
-    expect_value(__wrap_synth_preset, channel, chan);
-    expect_memory(__wrap_synth_preset, preset, &M_BANK_0_INST_1_BRIGHTPIANO,
+    __real_midi_program(chan, program);
+
+    expect_value(__wrap_synth_presetImage, channel, chan);
+    expect_memory(__wrap_synth_presetImage, image, &M_BANK_0_INST_1_BRIGHTPIANO,
         sizeof(M_BANK_0_INST_1_BRIGHTPIANO));
     expect_value(__wrap_synth_stereo, channel, chan);
     expect_value(__wrap_synth_stereo, mode, 1);
+    expect_synth_pitch(chan, 4, SYNTH_NTSC_C);
+    expect_synth_volume_any();
+    expect_value(__wrap_synth_noteOn, channel, chan);
 
-    __real_midi_program(chan, program);
+    __real_midi_note_on(chan, 60, MAX_MIDI_VOLUME);
 }
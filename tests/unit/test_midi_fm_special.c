@@ -0,0 +1,102 @@
+#include "test_midi.h"
+
+static void enableSpecialMode(void)
+{
+    const u8 sequence[] = { SYSEX_MANU_EXTENDED, SYSEX_MANU_REGION,
+        SYSEX_MANU_ID, SYSEX_COMMAND_SPECIAL_MODE, 1 };
+
+    expect_value(__wrap_synth_preset, channel, SPECIAL_MODE_CHANNEL);
+    expect_any(__wrap_synth_preset, preset);
+    expect_value(__wrap_synth_specialMode, enable, true);
+    __real_midi_sysex(sequence, sizeof(sequence));
+}
+
+static void drumOnFm(u8 fmChan, u8 key)
+{
+    expect_value(__wrap_synth_presetImage, channel, fmChan);
+    expect_any(__wrap_synth_presetImage, image);
+    expect_synth_pitch_any();
+    expect_synth_volume_any();
+    expect_value(__wrap_synth_noteOn, channel, fmChan);
+    __real_midi_note_on(GENERAL_MIDI_PERCUSSION_CHANNEL, key, MAX_MIDI_VOLUME);
+}
+
+static void drumOnSpecialModeVoice(u8 op, u8 key)
+{
+    expect_value(__wrap_synth_specialModeVolume, op, op);
+    expect_value(__wrap_synth_specialModeVolume, volume, MAX_MIDI_VOLUME);
+    expect_value(__wrap_synth_specialModePitch, op, op);
+    expect_any(__wrap_synth_specialModePitch, octave);
+    expect_any(__wrap_synth_specialModePitch, freqNumber);
+    expect_value(__wrap_synth_specialModeNoteOn, op, op);
+    __real_midi_note_on(GENERAL_MIDI_PERCUSSION_CHANNEL, key, MAX_MIDI_VOLUME);
+}
+
+static void test_midi_special_mode_adds_percussion_voices(UNUSED void** state)
+{
+    const u8 MIDI_KEY = 30;
+
+    enableSpecialMode();
+    drumOnFm(0, MIDI_KEY);
+    drumOnFm(1, MIDI_KEY);
+    for (u8 op = 0; op < SPECIAL_MODE_VOICES; op++) {
+        drumOnSpecialModeVoice(op, MIDI_KEY + 1 + op);
+    }
+
+    __real_midi_note_on(
+        GENERAL_MIDI_PERCUSSION_CHANNEL, MIDI_KEY, MAX_MIDI_VOLUME);
+}
+
+static void test_midi_special_mode_releases_percussion_voice(
+    UNUSED void** state)
+{
+    const u8 MIDI_KEY = 30;
+
+    enableSpecialMode();
+    drumOnFm(0, MIDI_KEY);
+    drumOnFm(1, MIDI_KEY);
+    drumOnSpecialModeVoice(0, MIDI_PITCH_C4);
+
+    expect_value(__wrap_synth_specialModeNoteOff, op, 0);
+    __real_midi_note_off(GENERAL_MIDI_PERCUSSION_CHANNEL, MIDI_PITCH_C4);
+
+    drumOnSpecialModeVoice(0, MIDI_PITCH_C4);
+}
+
+static void test_midi_special_mode_reserves_fm_channel_3(UNUSED void** state)
+{
+    const u8 FM_CHANS[] = { 0, 1, 3, 4, 5 };
+
+    enableSpecialMode();
+    for (u8 i = 0; i < sizeof(FM_CHANS); i++) {
+        expect_synth_pitch_any();
+        expect_synth_volume_any();
+        expect_value(__wrap_synth_noteOn, channel, FM_CHANS[i]);
+        __real_midi_note_on(0, MIDI_PITCH_C4 + i, MAX_MIDI_VOLUME);
+    }
+}
+
+static void test_midi_special_mode_disable_restores_fm_channel_3(
+    UNUSED void** state)
+{
+    const u8 sequence[] = { SYSEX_MANU_EXTENDED, SYSEX_MANU_REGION,
+        SYSEX_MANU_ID, SYSEX_COMMAND_SPECIAL_MODE, 0 };
+
+    enableSpecialMode();
+    drumOnFm(0, 30);
+    drumOnFm(1, 30);
+    drumOnSpecialModeVoice(0, MIDI_PITCH_C4);
+
+    expect_value(__wrap_synth_specialModeNoteOff, op, 0);
+    expect_value(__wrap_synth_specialMode, enable, false);
+    __real_midi_sysex(sequence, sizeof(sequence));
+
+    expect_any(__wrap_synth_presetImage, channel);
+    expect_any(__wrap_synth_presetImage, image);
+    expect_any(__wrap_synth_stereo, channel);
+    expect_any(__wrap_synth_stereo, mode);
+    expect_synth_pitch_any();
+    expect_synth_volume_any();
+    expect_value(__wrap_synth_noteOn, channel, 2);
+    __real_midi_note_on(0, MIDI_PITCH_C4, MAX_MIDI_VOLUME);
+}
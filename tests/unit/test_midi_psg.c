@@ -189,6 +189,23 @@ static void test_midi_sets_psg_pitch_bend_up(UNUSED void** state)
     }
 }
 
+static void test_midi_rpn_sets_psg_pitch_bend_range(UNUSED void** state)
+{
+    const u8 chan = MIN_PSG_CHAN;
+    const u8 expectedPsgChan = 0;
+
+    __real_midi_cc(chan, CC_RPN_MSB, 0);
+    __real_midi_cc(chan, CC_RPN_LSB, 0);
+    __real_midi_cc(chan, CC_DATA_ENTRY_MSB, 12);
+
+    expect_psg_tone(expectedPsgChan, TONE_NTSC_C4);
+    expect_psg_attenuation(expectedPsgChan, PSG_ATTENUATION_LOUDEST);
+    __real_midi_note_on(chan, MIDI_PITCH_C4, MAX_MIDI_VOLUME);
+
+    expect_psg_tone(expectedPsgChan, 213);
+    __real_midi_pitch_bend(chan, 0x4000);
+}
+
 static void test_midi_psg_pitch_bend_persists_after_tick(UNUSED void** state)
 {
     for (int chan = MIN_PSG_CHAN; chan <= MAX_PSG_CHAN; chan++) {
@@ -199,7 +216,7 @@ static void test_midi_psg_pitch_bend_persists_after_tick(UNUSED void** state)
         expect_psg_attenuation(expectedPsgChan, PSG_ATTENUATION_LOUDEST);
         __real_midi_note_on(chan, MIDI_PITCH_C4, MAX_MIDI_VOLUME);
 
-        expect_psg_tone(expectedPsgChan, 0x1d8);
+        expect_psg_tone(expectedPsgChan, 0x1d9);
         __real_midi_pitch_bend(chan, 1000);
 
         __real_midi_psg_tick();
@@ -330,6 +347,27 @@ test_midi_psg_envelope_with_loop_end_resets_release_note_after_note_silenced(
     __real_midi_psg_tick();
 }
 
+static void initPsgEnvelopes(const u8* envelope)
+{
+    static const u8* envelopes[MIDI_PROGRAMS];
+    for (u8 program = 0; program < MIDI_PROGRAMS; program++) {
+        envelopes[program] = envelope;
+    }
+    midi_psg_init(envelopes);
+}
+
+static void test_midi_silences_invalid_psg_envelope(UNUSED void** state)
+{
+    const u8 envelope[] = { 0x00, EEF_LOOP_END, 0x00, EEF_END };
+
+    wraps_enable_logging_checks();
+    expect_log_warn("PSG envelope %d invalid");
+    initPsgEnvelopes(envelope);
+
+    __real_midi_note_on(MIN_PSG_CHAN, MIDI_PITCH_C4, MAX_MIDI_VOLUME);
+    __real_midi_psg_tick();
+}
+
 #define SHIFTS 14
 
 static void test_midi_shifts_semitone_in_psg_envelope(UNUSED void** state)
@@ -340,15 +378,14 @@ static void test_midi_shifts_semitone_in_psg_envelope(UNUSED void** state)
     const u16 expectedInitialTone = TONE_NTSC_C4;
     const u16 expectedShiftedTone[SHIFTS]
         = { /* Up */ 0x1aa, 0x1a9, 0x1a7, 0x19f, 0x193, 0x17c, 0x140,
-              /* Down */ 0x1ac, 0x1ad, 0x1b0, 0x1b7, 0x1c4, 0x1df, 0x23a };
+              /* Down */ 0x1ad, 0x1ae, 0x1b0, 0x1b8, 0x1c4, 0x1df, 0x23a };
 
     for (u8 i = 0; i < SHIFTS; i++) {
         u8 envelopeStep = (i + 1) * 0x10;
         const u8 envelope[] = { EEF_LOOP_START, 0x00, envelopeStep, EEF_END };
-        const u8* envelopes[] = { envelope };
 
         print_message("Shift: %d %d\n", i, envelopeStep);
-        midi_psg_init(envelopes);
+        initPsgEnvelopes(envelope);
 
         expect_psg_attenuation(expectedPsgChan, PSG_ATTENUATION_LOUDEST);
         expect_psg_tone(expectedPsgChan, expectedInitialTone);
@@ -370,8 +407,7 @@ static void test_midi_pitch_shift_handles_upper_limit_psg_envelope(
     const u8 maxPitch = 127;
     const u16 expectedInitialTone = 8;
     const u8 envelope[] = { EEF_LOOP_START, 0x00, 0x10, EEF_END };
-    const u8* envelopes[] = { envelope };
-    midi_psg_init(envelopes);
+    initPsgEnvelopes(envelope);
 
     expect_psg_tone(expectedPsgChan, expectedInitialTone);
     expect_psg_attenuation(expectedPsgChan, PSG_ATTENUATION_LOUDEST);
@@ -388,8 +424,7 @@ static void test_midi_pitch_shift_handles_lower_limit_psg_envelope(
     const u8 minPitch = MIDI_PITCH_A2;
     const u16 expectedInitialTone = TONE_NTSC_A2;
     const u8 envelope[] = { EEF_LOOP_START, 0x00, 0x80, EEF_END };
-    const u8* envelopes[] = { envelope };
-    midi_psg_init(envelopes);
+    initPsgEnvelopes(envelope);
 
     expect_psg_tone(expectedPsgChan, expectedInitialTone);
     expect_psg_attenuation(expectedPsgChan, PSG_ATTENUATION_LOUDEST);
@@ -413,6 +448,137 @@ static void test_midi_loads_psg_envelope(UNUSED void** state)
     __real_midi_psg_tick();
 }
 
+static void test_midi_plays_stored_program_envelope(UNUSED void** state)
+{
+    const u8 chan = MIN_PSG_CHAN;
+    const u8 eef[] = { 0x66, EEF_END };
+
+    assert_true(midi_psg_store_envelope(1, eef));
+    __real_midi_program(chan, 1);
+
+    expect_psg_tone(0, 0x17c);
+    expect_psg_attenuation(0, 6);
+    __real_midi_note_on(chan, MIDI_PITCH_C4, MAX_MIDI_VOLUME);
+
+    expect_psg_attenuation(0, PSG_ATTENUATION_SILENCE);
+    __real_midi_psg_tick();
+}
+
+static void test_midi_removed_program_envelope_falls_back_to_default(
+    UNUSED void** state)
+{
+    const u8 chan = MIN_PSG_CHAN;
+    const u8 eef[] = { 0x66, EEF_END };
+
+    assert_true(midi_psg_store_envelope(1, eef));
+    midi_psg_remove_envelope(1);
+    __real_midi_program(chan, 1);
+
+    expect_psg_tone(0, TONE_NTSC_C4);
+    expect_psg_attenuation(0, PSG_ATTENUATION_LOUDEST);
+    __real_midi_note_on(chan, MIDI_PITCH_C4, MAX_MIDI_VOLUME);
+
+    expect_psg_attenuation(0, PSG_ATTENUATION_SILENCE);
+    __real_midi_psg_tick();
+}
+
+/* 249 steps compile to a quarter of the envelope bank */
+#define QUARTER_BANK_EEF_LENGTH 250
+
+static void fillEnvelope(u8* eef, u16 length, u8 step)
+{
+    memset(eef, step, length - 1);
+    eef[length - 1] = EEF_END;
+}
+
+static void fillEnvelopeBank(void)
+{
+    u8 eef[QUARTER_BANK_EEF_LENGTH];
+    for (u8 program = 0; program < 4; program++) {
+        fillEnvelope(eef, sizeof(eef), program);
+        assert_true(midi_psg_store_envelope(program, eef));
+    }
+    assert_int_equal(midi_psg_envelope_bank_free(), 0);
+}
+
+static void test_midi_psg_envelope_bank_compacts_freed_space(
+    UNUSED void** state)
+{
+    u8 eef[200];
+    u8 stored[MAX_EEF_LENGTH];
+    fillEnvelope(eef, sizeof(eef), 0x04);
+    fillEnvelopeBank();
+
+    assert_false(midi_psg_store_envelope(4, eef));
+    midi_psg_remove_envelope(1);
+    assert_true(midi_psg_store_envelope(4, eef));
+
+    assert_true(midi_psg_program_envelope(4, stored));
+    assert_memory_equal(stored, eef, sizeof(eef));
+    assert_true(midi_psg_program_envelope(3, stored));
+    assert_int_equal(stored[0], 0x03);
+    assert_int_equal(stored[QUARTER_BANK_EEF_LENGTH - 1], EEF_END);
+    assert_int_equal(midi_psg_envelope_bank_free(), 50);
+}
+
+static void test_midi_psg_envelope_keeps_playing_when_bank_compacted(
+    UNUSED void** state)
+{
+    const u8 chan = MIN_PSG_CHAN;
+    u8 eef[QUARTER_BANK_EEF_LENGTH];
+    fillEnvelopeBank();
+    for (u16 i = 0; i < sizeof(eef) - 1; i += 2) {
+        eef[i] = 0x00;
+        eef[i + 1] = 0x07;
+    }
+    eef[sizeof(eef) - 1] = EEF_END;
+    assert_true(midi_psg_store_envelope(2, eef));
+    __real_midi_program(chan, 2);
+
+    expect_psg_tone(0, TONE_NTSC_C4);
+    expect_psg_attenuation(0, PSG_ATTENUATION_LOUDEST);
+    __real_midi_note_on(chan, MIDI_PITCH_C4, MAX_MIDI_VOLUME);
+
+    midi_psg_remove_envelope(1);
+    assert_true(midi_psg_store_envelope(4, eef));
+
+    expect_psg_attenuation(0, 7);
+    __real_midi_psg_tick();
+    expect_psg_attenuation(0, PSG_ATTENUATION_LOUDEST);
+    __real_midi_psg_tick();
+}
+
+static void test_midi_psg_rejects_malformed_envelopes(UNUSED void** state)
+{
+    const u8 loopEndFirst[] = { 0x00, EEF_LOOP_END, 0x00, EEF_END };
+    const u8 emptyLoop[] = { 0x00, EEF_LOOP_START, EEF_LOOP_END, EEF_END };
+    const u8 loopWithoutSteps[] = { 0x00, EEF_LOOP_START, EEF_END };
+    const u8 twoLoops[]
+        = { EEF_LOOP_START, 0x00, EEF_LOOP_START, 0x00, EEF_END };
+    u8 unterminated[MAX_EEF_LENGTH];
+    memset(unterminated, 0x00, sizeof(unterminated));
+
+    assert_false(midi_psg_store_envelope(0, loopEndFirst));
+    assert_false(midi_psg_store_envelope(0, emptyLoop));
+    assert_false(midi_psg_store_envelope(0, loopWithoutSteps));
+    assert_false(midi_psg_store_envelope(0, twoLoops));
+    assert_false(midi_psg_store_envelope(0, unterminated));
+    assert_false(__real_midi_psg_load_envelope(unterminated));
+    assert_int_equal(midi_psg_envelope_bank_free(), PSG_ENVELOPE_BANK_SIZE);
+}
+
+static void test_midi_psg_stored_envelope_keeps_its_loop(UNUSED void** state)
+{
+    const u8 eef[]
+        = { 0x00, EEF_LOOP_START, 0x01, EEF_LOOP_END, 0x02, EEF_END };
+    u8 stored[MAX_EEF_LENGTH];
+
+    assert_true(midi_psg_store_envelope(0, eef));
+
+    assert_true(midi_psg_program_envelope(0, stored));
+    assert_memory_equal(stored, eef, sizeof(eef));
+}
+
 static void test_midi_psg_sets_busy_indicators(UNUSED void** state)
 {
     for (u8 chan = 0; chan < MAX_PSG_CHANS; chan++) {
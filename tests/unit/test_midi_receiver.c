@@ -213,16 +213,20 @@ static void test_midi_receiver_sends_sysex_to_midi_layer(UNUSED void** state)
 
     u8 data[1] = { command };
 
-    expect_memory(__wrap_midi_sysex, data, &data, 1);
-    expect_value(__wrap_midi_sysex, length, 1);
+    expect_function_call(__wrap_midi_sysex_begin);
+    expect_memory(__wrap_midi_sysex_data, data, &data, 1);
+    expect_value(__wrap_midi_sysex_data, length, 1);
+    expect_function_call(__wrap_midi_sysex_end);
 
     midi_receiver_read();
 }
 
-static void test_midi_receiver_handles_sysex_limits(UNUSED void** state)
+static void test_midi_receiver_streams_long_sysex_in_chunks(
+    UNUSED void** state)
 {
-    const u16 SYSEX_BUFFER_SIZE = 256;
-    const u16 SYSEX_MESSAGE_SIZE = 300;
+    const u16 SYSEX_CHUNK_SIZE = 32;
+    const u16 SYSEX_MESSAGE_SIZE = 600;
+    const u16 LAST_CHUNK_SIZE = SYSEX_MESSAGE_SIZE % SYSEX_CHUNK_SIZE;
 
     const u8 command = 0x12;
     will_return(__wrap_comm_read, STATUS_SYSEX_START);
@@ -231,17 +235,19 @@ static void test_midi_receiver_handles_sysex_limits(UNUSED void** state)
     }
     will_return(__wrap_comm_read, SYSEX_END);
 
-    u8 data[SYSEX_BUFFER_SIZE];
-    for (u16 i = 0; i < SYSEX_BUFFER_SIZE; i++) {
+    u8 data[SYSEX_CHUNK_SIZE];
+    for (u16 i = 0; i < SYSEX_CHUNK_SIZE; i++) {
         data[i] = command;
     }
 
-    expect_memory(__wrap_midi_sysex, data, &data, SYSEX_BUFFER_SIZE);
-    expect_value(__wrap_midi_sysex, length, SYSEX_BUFFER_SIZE);
+    expect_function_call(__wrap_midi_sysex_begin);
+    for (u16 i = 0; i < SYSEX_MESSAGE_SIZE / SYSEX_CHUNK_SIZE; i++) {
+        expect_memory(__wrap_midi_sysex_data, data, &data, SYSEX_CHUNK_SIZE);
+        expect_value(__wrap_midi_sysex_data, length, SYSEX_CHUNK_SIZE);
+    }
+    expect_memory(__wrap_midi_sysex_data, data, &data, LAST_CHUNK_SIZE);
+    expect_value(__wrap_midi_sysex_data, length, LAST_CHUNK_SIZE);
+    expect_function_call(__wrap_midi_sysex_end);
 
     midi_receiver_read();
-
-    for (u16 i = 0; i < SYSEX_MESSAGE_SIZE - SYSEX_BUFFER_SIZE + 1; i++) {
-        comm_read();
-    }
 }
@@ -0,0 +1,102 @@
+#include "test_midi.h"
+
+static void noteOnFm(u8 midiChan, u8 fmChan, u8 pitch)
+{
+    expect_synth_pitch_any();
+    expect_synth_volume_any();
+    expect_value(__wrap_synth_noteOn, channel, fmChan);
+    __real_midi_note_on(midiChan, pitch, MAX_MIDI_VOLUME);
+}
+
+static void test_midi_sustain_defers_note_off_until_pedal_released(
+    UNUSED void** state)
+{
+    noteOnFm(0, 0, MIDI_PITCH_C4);
+
+    __real_midi_cc(0, CC_SUSTAIN_PEDAL, 127);
+    __real_midi_note_off(0, MIDI_PITCH_C4);
+
+    expect_value(__wrap_synth_noteOff, channel, 0);
+    __real_midi_cc(0, CC_SUSTAIN_PEDAL, 0);
+}
+
+static void test_midi_sustain_releases_all_deferred_voices_on_pedal_up(
+    UNUSED void** state)
+{
+    __real_midi_cc(0, CC_POLYPHONIC_MODE, 127);
+    for (u8 chan = 0; chan < 3; chan++) {
+        noteOnFm(0, chan, MIDI_PITCH_C4 + chan);
+    }
+
+    __real_midi_cc(0, CC_SUSTAIN_PEDAL, 127);
+    for (u8 chan = 0; chan < 3; chan++) {
+        __real_midi_note_off(0, MIDI_PITCH_C4 + chan);
+    }
+
+    expect_value(__wrap_synth_noteOff, channel, 0);
+    expect_value(__wrap_synth_noteOff, channel, 1);
+    expect_value(__wrap_synth_noteOff, channel, 2);
+    __real_midi_cc(0, CC_SUSTAIN_PEDAL, 0);
+
+    __real_midi_cc(0, CC_POLYPHONIC_MODE, 0);
+}
+
+static void test_midi_sustain_steals_sustained_voice_before_held_notes(
+    UNUSED void** state)
+{
+    const u8 SELECT_FM = 32;
+    const u8 SUSTAINED_CHAN = 3;
+
+    __real_midi_cc(0, CC_POLYPHONIC_MODE, 127);
+    __real_midi_cc(0, CC_DEVICE_SELECT, SELECT_FM);
+    for (u8 chan = 0; chan <= MAX_FM_CHAN; chan++) {
+        noteOnFm(0, chan, MIDI_PITCH_C4 + chan);
+    }
+
+    __real_midi_cc(0, CC_SUSTAIN_PEDAL, 127);
+    __real_midi_note_off(0, MIDI_PITCH_C4 + SUSTAINED_CHAN);
+
+    noteOnFm(0, SUSTAINED_CHAN, MIDI_PITCH_B6);
+
+    __real_midi_cc(0, CC_POLYPHONIC_MODE, 0);
+}
+
+static void test_midi_sostenuto_holds_only_notes_down_when_pressed(
+    UNUSED void** state)
+{
+    __real_midi_cc(0, CC_POLYPHONIC_MODE, 127);
+    noteOnFm(0, 0, MIDI_PITCH_C4);
+
+    __real_midi_cc(0, CC_SOSTENUTO_PEDAL, 127);
+    noteOnFm(0, 1, MIDI_PITCH_CS4);
+
+    __real_midi_note_off(0, MIDI_PITCH_C4);
+    expect_value(__wrap_synth_noteOff, channel, 1);
+    __real_midi_note_off(0, MIDI_PITCH_CS4);
+
+    expect_value(__wrap_synth_noteOff, channel, 0);
+    __real_midi_cc(0, CC_SOSTENUTO_PEDAL, 0);
+
+    __real_midi_cc(0, CC_POLYPHONIC_MODE, 0);
+}
+
+static void test_midi_sustain_release_keeps_sostenuto_notes(
+    UNUSED void** state)
+{
+    __real_midi_cc(0, CC_POLYPHONIC_MODE, 127);
+    noteOnFm(0, 0, MIDI_PITCH_C4);
+    __real_midi_cc(0, CC_SOSTENUTO_PEDAL, 127);
+    __real_midi_cc(0, CC_SUSTAIN_PEDAL, 127);
+    noteOnFm(0, 1, MIDI_PITCH_CS4);
+
+    __real_midi_note_off(0, MIDI_PITCH_C4);
+    __real_midi_note_off(0, MIDI_PITCH_CS4);
+
+    expect_value(__wrap_synth_noteOff, channel, 1);
+    __real_midi_cc(0, CC_SUSTAIN_PEDAL, 0);
+
+    expect_value(__wrap_synth_noteOff, channel, 0);
+    __real_midi_cc(0, CC_SOSTENUTO_PEDAL, 0);
+
+    __real_midi_cc(0, CC_POLYPHONIC_MODE, 0);
+}
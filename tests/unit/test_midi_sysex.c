@@ -1,3 +1,4 @@
+#include "persistence.h"
 #include "test_midi.h"
 
 static void remapChannel(u8 midiChannel, u8 deviceChannel)
@@ -109,6 +110,27 @@ static void test_midi_sysex_unassigns_midi_channel(UNUSED void** state)
     __real_midi_note_on(0, 60, MAX_MIDI_VOLUME);
 }
 
+static void test_midi_sysex_remapped_channels_receive_midi_channel_ccs(
+    UNUSED void** state)
+{
+    const u8 UNASSIGNED_MIDI = 0x7F;
+
+    remapChannel(0, 1);
+
+    expect_value(__wrap_synth_volume, channel, 0);
+    expect_value(__wrap_synth_volume, volume, 64);
+    expect_value(__wrap_synth_volume, channel, 1);
+    expect_value(__wrap_synth_volume, volume, 64);
+    __real_midi_cc(0, CC_VOLUME, 64);
+
+    remapChannel(UNASSIGNED_MIDI, 0);
+
+    expect_value(__wrap_synth_volume, channel, 1);
+    expect_value(__wrap_synth_volume, volume, 32);
+    __real_midi_cc(0, CC_VOLUME, 32);
+    __real_midi_cc(1, CC_VOLUME, 32);
+}
+
 static void test_midi_sysex_does_nothing_for_empty_payload(UNUSED void** state)
 {
     const u16 length = 0;
@@ -256,3 +278,538 @@ static void test_midi_sysex_sets_original_total_level_values(
     expect_value(__wrap_synth_operatorTotalLevel, totalLevel, 126);
     __real_midi_cc(0, CC_GENMDM_TOTAL_LEVEL_OP1, 126);
 }
+
+static void test_midi_sysex_remaps_cc(UNUSED void** state)
+{
+    const u8 UNDEFINED_CC = 9;
+    const u8 sequence[] = { SYSEX_MANU_EXTENDED, SYSEX_MANU_REGION,
+        SYSEX_MANU_ID, SYSEX_COMMAND_REMAP_CC, UNDEFINED_CC,
+        CC_GENMDM_FM_ALGORITHM };
+
+    __real_midi_sysex(sequence, sizeof(sequence));
+
+    expect_value(__wrap_synth_algorithm, channel, 0);
+    expect_value(__wrap_synth_algorithm, algorithm, 7);
+    __real_midi_cc(0, UNDEFINED_CC, 127);
+}
+
+static void test_midi_sysex_remapped_cc_replaces_original_function(
+    UNUSED void** state)
+{
+    const u8 sequence[] = { SYSEX_MANU_EXTENDED, SYSEX_MANU_REGION,
+        SYSEX_MANU_ID, SYSEX_COMMAND_REMAP_CC, CC_GENMDM_FM_FEEDBACK,
+        CC_GENMDM_FM_ALGORITHM };
+
+    __real_midi_sysex(sequence, sizeof(sequence));
+
+    expect_value(__wrap_synth_algorithm, channel, 0);
+    expect_value(__wrap_synth_algorithm, algorithm, 2);
+    __real_midi_cc(0, CC_GENMDM_FM_FEEDBACK, 32);
+}
+
+static void test_midi_sysex_tunes_single_note(UNUSED void** state)
+{
+    const u8 sequence[] = { SYSEX_UNIVERSAL_REAL_TIME, 0x7F, SYSEX_MIDI_TUNING,
+        SYSEX_MIDI_TUNING_NOTE_CHANGE, 0, 1, MIDI_PITCH_C4, MIDI_PITCH_C4,
+        0x40, 0x00 };
+
+    __real_midi_sysex(sequence, sizeof(sequence));
+
+    expect_synth_pitch(0, 4, 662);
+    expect_synth_volume_any();
+    expect_value(__wrap_synth_noteOn, channel, 0);
+    __real_midi_note_on(0, MIDI_PITCH_C4, MAX_MIDI_VOLUME);
+}
+
+static void test_midi_sysex_retunes_sounding_note(UNUSED void** state)
+{
+    const u8 sequence[] = { SYSEX_UNIVERSAL_REAL_TIME, 0x7F, SYSEX_MIDI_TUNING,
+        SYSEX_MIDI_TUNING_NOTE_CHANGE, 0, 1, MIDI_PITCH_C4, MIDI_PITCH_CS4,
+        0x00, 0x00 };
+
+    expect_synth_pitch(0, 4, SYNTH_NTSC_C);
+    expect_synth_volume_any();
+    expect_value(__wrap_synth_noteOn, channel, 0);
+    __real_midi_note_on(0, MIDI_PITCH_C4, MAX_MIDI_VOLUME);
+
+    expect_synth_pitch(0, 4, 681);
+    __real_midi_sysex(sequence, sizeof(sequence));
+}
+
+static void test_midi_sysex_ignores_no_change_tuning(UNUSED void** state)
+{
+    const u8 sequence[] = { SYSEX_UNIVERSAL_REAL_TIME, 0x7F, SYSEX_MIDI_TUNING,
+        SYSEX_MIDI_TUNING_NOTE_CHANGE, 0, 1, MIDI_PITCH_C4, 0x7F, 0x7F, 0x7F };
+
+    __real_midi_sysex(sequence, sizeof(sequence));
+
+    expect_synth_pitch(0, 4, SYNTH_NTSC_C);
+    expect_synth_volume_any();
+    expect_value(__wrap_synth_noteOn, channel, 0);
+    __real_midi_note_on(0, MIDI_PITCH_C4, MAX_MIDI_VOLUME);
+}
+
+static void test_midi_sysex_loads_bulk_tuning_dump(UNUSED void** state)
+{
+    const u16 header = 5 + 16;
+    u8 sequence[header + 128 * 3 + 1];
+    memset(sequence, 0, sizeof(sequence));
+    sequence[0] = SYSEX_UNIVERSAL_NON_REAL_TIME;
+    sequence[1] = 0x7F;
+    sequence[2] = SYSEX_MIDI_TUNING;
+    sequence[3] = SYSEX_MIDI_TUNING_BULK_DUMP;
+    for (u8 key = 0; key < 128; key++) {
+        u8* frequency = &sequence[header + key * 3];
+        if (key == 127) {
+            memset(frequency, 0x7F, 3);
+        } else {
+            frequency[0] = key + 1;
+        }
+    }
+
+    __real_midi_sysex_begin();
+    for (u16 i = 0; i < sizeof(sequence); i++) {
+        __real_midi_sysex_data(&sequence[i], 1);
+    }
+    __real_midi_sysex_end();
+
+    expect_synth_pitch(0, 4, 681);
+    expect_synth_volume_any();
+    expect_value(__wrap_synth_noteOn, channel, 0);
+    __real_midi_note_on(0, MIDI_PITCH_C4, MAX_MIDI_VOLUME);
+
+    expect_psg_tone(0, TONE_NTSC_CS4);
+    expect_psg_attenuation(0, PSG_ATTENUATION_LOUDEST);
+    __real_midi_note_on(MIN_PSG_CHAN, MIDI_PITCH_C4, MAX_MIDI_VOLUME);
+}
+
+static void test_midi_sysex_streams_command_split_across_chunks(
+    UNUSED void** state)
+{
+    const u8 UNASSIGNED_MIDI = 0x7F;
+    const u8 sequence[] = { SYSEX_MANU_EXTENDED, SYSEX_MANU_REGION,
+        SYSEX_MANU_ID, SYSEX_COMMAND_REMAP, UNASSIGNED_MIDI, DEV_CHAN_MIN_FM };
+
+    __real_midi_sysex_begin();
+    for (u16 i = 0; i < sizeof(sequence); i++) {
+        __real_midi_sysex_data(&sequence[i], 1);
+    }
+    __real_midi_sysex_end();
+    remapChannel(0, DEV_CHAN_MIN_PSG);
+
+    expect_any_psg_tone_on_channel(0);
+    expect_psg_attenuation(0, PSG_ATTENUATION_LOUDEST);
+    __real_midi_note_on(0, MIDI_PITCH_C4, MAX_MIDI_VOLUME);
+}
+
+static void test_midi_sysex_ignores_command_with_extra_data(
+    UNUSED void** state)
+{
+    const u8 sequence[] = { SYSEX_MANU_EXTENDED, SYSEX_MANU_REGION,
+        SYSEX_MANU_ID, SYSEX_COMMAND_REMAP, 0, DEV_CHAN_MIN_PSG, 0, 0, 0, 0 };
+
+    __real_midi_sysex(sequence, sizeof(sequence));
+
+    expect_synth_pitch_any();
+    expect_synth_volume_any();
+    expect_value(__wrap_synth_noteOn, channel, 0);
+    __real_midi_note_on(0, MIDI_PITCH_C4, MAX_MIDI_VOLUME);
+}
+
+static void test_midi_sysex_rejects_psg_envelope_longer_than_limit(
+    UNUSED void** state)
+{
+    const u8 header[] = { SYSEX_MANU_EXTENDED, SYSEX_MANU_REGION,
+        SYSEX_MANU_ID, SYSEX_COMMAND_LOAD_PSG_ENVELOPE };
+    const u8 step[] = { 0x00, 0x01 };
+
+    wraps_enable_logging_checks();
+    __real_midi_sysex_begin();
+    __real_midi_sysex_data(header, sizeof(header));
+    for (u16 i = 0; i < MAX_EEF_LENGTH; i++) {
+        __real_midi_sysex_data(step, sizeof(step));
+    }
+
+    expect_log_warn("Envelope too long");
+    __real_midi_sysex_end();
+}
+
+static const FmChannel LOADED_PATCH = { 4, 6, 3, 1, 2, 0, 0,
+    { { 1, 0, 26, 1, 7, 0, 7, 4, 1, 39, 0 },
+        { 4, 6, 24, 1, 9, 1, 6, 9, 7, 36, 8 },
+        { 2, 7, 31, 3, 23, 0, 9, 15, 1, 4, 0 },
+        { 15, 3, 27, 2, 4, 0, 10, 4, 6, 127, 0 } } };
+
+static const u8 PACKED_LOADED_PATCH[SYSEX_FM_PATCH_LENGTH] = { 4, 6, 3, 1, 2,
+    1, 0, 26, 1, 7, 0, 7, 4, 1, 39, 0, 4, 6, 24, 1, 9, 1, 6, 9, 7, 36, 8, 2, 7,
+    31, 3, 23, 0, 9, 15, 1, 4, 0, 15, 3, 27, 2, 4, 0, 10, 4, 6, 127, 0 };
+
+static void loadFmPatch(u8 target, const u8* patch)
+{
+    u8 sequence[5 + SYSEX_FM_PATCH_LENGTH] = { SYSEX_MANU_EXTENDED,
+        SYSEX_MANU_REGION, SYSEX_MANU_ID, SYSEX_COMMAND_LOAD_FM_PATCH, target };
+    memcpy(&sequence[5], patch, SYSEX_FM_PATCH_LENGTH);
+
+    __real_midi_sysex(sequence, sizeof(sequence));
+}
+
+static void expectLoadedPatch(u8 chan)
+{
+    expect_value(__wrap_synth_preset, channel, chan);
+    expect_memory(
+        __wrap_synth_preset, preset, &LOADED_PATCH, sizeof(LOADED_PATCH));
+    expect_value(__wrap_synth_stereo, channel, chan);
+    expect_any(__wrap_synth_stereo, mode);
+}
+
+static void test_midi_sysex_loads_fm_patch_for_midi_channel(
+    UNUSED void** state)
+{
+    expectLoadedPatch(0);
+    loadFmPatch(0, PACKED_LOADED_PATCH);
+
+    expect_synth_pitch_any();
+    expect_synth_volume_any();
+    expect_value(__wrap_synth_noteOn, channel, 0);
+    __real_midi_note_on(0, MIDI_PITCH_C4, MAX_MIDI_VOLUME);
+}
+
+static void test_midi_sysex_loads_fm_patch_for_device_channel(
+    UNUSED void** state)
+{
+    expectLoadedPatch(2);
+    loadFmPatch(SYSEX_FM_PATCH_DEVICE_CHANNEL | 2, PACKED_LOADED_PATCH);
+}
+
+static void test_midi_sysex_rejects_invalid_fm_patch(UNUSED void** state)
+{
+    u8 patch[SYSEX_FM_PATCH_LENGTH];
+    memcpy(patch, PACKED_LOADED_PATCH, sizeof(patch));
+    patch[0] = 8;
+
+    wraps_enable_logging_checks();
+    expect_log_warn("Invalid FM patch");
+    loadFmPatch(0, patch);
+}
+
+static void test_midi_sysex_dumps_fm_patch(UNUSED void** state)
+{
+    const u8 target = SYSEX_FM_PATCH_DEVICE_CHANNEL | 1;
+    const u8 sequence[] = { SYSEX_MANU_EXTENDED, SYSEX_MANU_REGION,
+        SYSEX_MANU_ID, SYSEX_COMMAND_DUMP_FM_PATCH, target };
+    const u8 reply[] = { SYSEX_START, SYSEX_MANU_EXTENDED, SYSEX_MANU_REGION,
+        SYSEX_MANU_ID, SYSEX_COMMAND_LOAD_FM_PATCH, target };
+
+    wraps_synth_setChannelParameters(&LOADED_PATCH);
+    for (u8 i = 0; i < sizeof(reply); i++) {
+        expect_value(__wrap_comm_write, data, reply[i]);
+    }
+    for (u8 i = 0; i < SYSEX_FM_PATCH_LENGTH; i++) {
+        expect_value(__wrap_comm_write, data, PACKED_LOADED_PATCH[i]);
+    }
+    expect_value(__wrap_comm_write, data, SYSEX_END);
+    __real_midi_sysex(sequence, sizeof(sequence));
+}
+
+static void test_midi_sysex_loaded_fm_patch_follows_dynamic_channel(
+    UNUSED void** state)
+{
+    loadFmPatch(0, PACKED_LOADED_PATCH);
+
+    expectLoadedPatch(0);
+    expect_synth_pitch_any();
+    expect_synth_volume_any();
+    expect_value(__wrap_synth_noteOn, channel, 0);
+    __real_midi_note_on(0, MIDI_PITCH_C4, MAX_MIDI_VOLUME);
+}
+
+static void storeUserPreset(u8 slot, const u8* patch)
+{
+    u8 sequence[5 + SYSEX_FM_PATCH_LENGTH] = { SYSEX_MANU_EXTENDED,
+        SYSEX_MANU_REGION, SYSEX_MANU_ID, SYSEX_COMMAND_STORE_USER_PRESET,
+        slot };
+    memcpy(&sequence[5], patch, SYSEX_FM_PATCH_LENGTH);
+
+    __real_midi_sysex(sequence, sizeof(sequence));
+}
+
+static void selectUserPreset(u8 chan, u8 slot)
+{
+    __real_midi_cc(chan, CC_BANK_SELECT_MSB, USER_PRESET_BANK);
+    __real_midi_cc(chan, CC_BANK_SELECT_LSB, 0);
+    __real_midi_program(chan, slot);
+}
+
+static void expectNoteOn(u8 chan)
+{
+    expect_synth_pitch_any();
+    expect_synth_volume_any();
+    expect_value(__wrap_synth_noteOn, channel, chan);
+}
+
+static void test_midi_sysex_recalls_uploaded_user_preset(UNUSED void** state)
+{
+    const u8 SLOT = 3;
+
+    storeUserPreset(SLOT, PACKED_LOADED_PATCH);
+    selectUserPreset(0, SLOT);
+
+    expectLoadedPatch(0);
+    expectNoteOn(0);
+    __real_midi_note_on(0, MIDI_PITCH_C4, MAX_MIDI_VOLUME);
+}
+
+static void test_midi_sysex_stores_channel_parameters_as_user_preset(
+    UNUSED void** state)
+{
+    const u8 SLOT = 0;
+    const u8 sequence[] = { SYSEX_MANU_EXTENDED, SYSEX_MANU_REGION,
+        SYSEX_MANU_ID, SYSEX_COMMAND_STORE_USER_PRESET, SLOT,
+        SYSEX_FM_PATCH_DEVICE_CHANNEL | 0 };
+
+    wraps_synth_setChannelParameters(&LOADED_PATCH);
+    __real_midi_sysex(sequence, sizeof(sequence));
+    selectUserPreset(1, SLOT);
+
+    expectLoadedPatch(1);
+    expectNoteOn(1);
+    __real_midi_note_on(1, MIDI_PITCH_C4, MAX_MIDI_VOLUME);
+}
+
+static void test_midi_sysex_bank_select_waits_for_program_change(
+    UNUSED void** state)
+{
+    storeUserPreset(0, PACKED_LOADED_PATCH);
+    __real_midi_cc(0, CC_BANK_SELECT_MSB, USER_PRESET_BANK);
+
+    expectNoteOn(0);
+    __real_midi_note_on(0, MIDI_PITCH_C4, MAX_MIDI_VOLUME);
+}
+
+static void test_midi_sysex_restoring_user_preset_reloads_channel(
+    UNUSED void** state)
+{
+    const u8 SLOT = 5;
+    u8 patch[SYSEX_FM_PATCH_LENGTH];
+    memcpy(patch, PACKED_LOADED_PATCH, sizeof(patch));
+    patch[0] = 1;
+
+    wraps_disable_checks();
+    storeUserPreset(SLOT, patch);
+    selectUserPreset(0, SLOT);
+    __real_midi_note_on(0, MIDI_PITCH_C4, MAX_MIDI_VOLUME);
+    __real_midi_note_off(0, MIDI_PITCH_C4);
+    wraps_enable_checks();
+
+    storeUserPreset(SLOT, PACKED_LOADED_PATCH);
+
+    expectLoadedPatch(0);
+    expectNoteOn(0);
+    __real_midi_note_on(0, MIDI_PITCH_C4, MAX_MIDI_VOLUME);
+}
+
+static void test_midi_sysex_rejects_user_preset_slot_out_of_range(
+    UNUSED void** state)
+{
+    wraps_enable_logging_checks();
+    expect_log_warn("Preset slot %d?");
+    storeUserPreset(USER_PRESETS, PACKED_LOADED_PATCH);
+}
+
+static void sendCustomCommand(u8 command, u8 value)
+{
+    const u8 sequence[] = { SYSEX_MANU_EXTENDED, SYSEX_MANU_REGION,
+        SYSEX_MANU_ID, command, value };
+
+    __real_midi_sysex(sequence, sizeof(sequence));
+}
+
+static void restartMidi(void)
+{
+    __real_midi_tick();
+    expect_any(__wrap_synth_init, defaultPreset);
+    wraps_disable_checks();
+    __real_midi_reset();
+    wraps_enable_checks();
+}
+
+static void test_midi_restores_settings_from_sram(UNUSED void** state)
+{
+    sendCustomCommand(SYSEX_COMMAND_INVERT_TOTAL_LEVEL, 1);
+
+    restartMidi();
+
+    expect_value(__wrap_synth_operatorTotalLevel, channel, 0);
+    expect_value(__wrap_synth_operatorTotalLevel, op, 0);
+    expect_value(__wrap_synth_operatorTotalLevel, totalLevel, 127);
+    __real_midi_cc(0, CC_GENMDM_TOTAL_LEVEL_OP1, 0);
+}
+
+static void test_midi_saves_settings_on_next_tick(UNUSED void** state)
+{
+    u8 sram[PERSISTENCE_SIZE];
+    memcpy(sram, wraps_sram(), sizeof(sram));
+
+    sendCustomCommand(SYSEX_COMMAND_INVERT_TOTAL_LEVEL, 1);
+    sendCustomCommand(SYSEX_COMMAND_DYNAMIC, 1);
+    assert_memory_equal(wraps_sram(), sram, sizeof(sram));
+
+    __real_midi_tick();
+    assert_memory_not_equal(wraps_sram(), sram, sizeof(sram));
+}
+
+static void test_midi_saves_polyphonic_mode_on_next_tick(UNUSED void** state)
+{
+    u8 sram[PERSISTENCE_SIZE];
+    memcpy(sram, wraps_sram(), sizeof(sram));
+
+    __real_midi_cc(0, CC_POLYPHONIC_MODE, 127);
+    assert_memory_equal(wraps_sram(), sram, sizeof(sram));
+
+    restartMidi();
+
+    assert_true(__real_midi_dynamic_mode());
+}
+
+static void test_midi_restores_dynamic_mode_from_sram(UNUSED void** state)
+{
+    sendCustomCommand(SYSEX_COMMAND_DYNAMIC, 1);
+
+    restartMidi();
+
+    assert_true(__real_midi_dynamic_mode());
+}
+
+static void test_midi_restores_channel_mapping_from_sram(UNUSED void** state)
+{
+    remapChannel(0x7F, DEV_CHAN_MIN_FM);
+    remapChannel(0, DEV_CHAN_MIN_PSG);
+
+    restartMidi();
+
+    expect_any_psg_tone_on_channel(0);
+    expect_psg_attenuation(0, PSG_ATTENUATION_LOUDEST);
+    __real_midi_note_on(0, MIDI_PITCH_C4, MAX_MIDI_VOLUME);
+}
+
+static void test_midi_restores_user_presets_from_sram(UNUSED void** state)
+{
+    const u8 SLOT = 3;
+    storeUserPreset(SLOT, PACKED_LOADED_PATCH);
+
+    restartMidi();
+
+    const FmChannel* preset = midi_fm_user_preset(SLOT);
+    assert_non_null(preset);
+    assert_memory_equal(preset, &LOADED_PATCH, sizeof(LOADED_PATCH));
+}
+
+static void test_midi_restores_user_envelope_from_sram(UNUSED void** state)
+{
+    u8 settings[2 + ALL_DEV_CHANS];
+    u8 envelope[1 + MAX_EEF_LENGTH] = { 1, 0x07, 0x0F, EEF_END };
+    sendCustomCommand(SYSEX_COMMAND_DYNAMIC, 0);
+    __real_midi_tick();
+    assert_true(persistence_read_begin());
+    assert_true(persistence_read(settings, sizeof(settings)));
+    persistence_write_begin();
+    persistence_write(settings, sizeof(settings));
+    persistence_write(envelope, sizeof(envelope));
+    persistence_write_end();
+
+    expect_memory(__wrap_midi_psg_load_envelope, eef, &envelope[1], 4);
+    restartMidi();
+}
+
+static void test_midi_restores_sections_of_older_layout(UNUSED void** state)
+{
+    /* an image holding only the settings section */
+    u8 settings[2 + ALL_DEV_CHANS];
+    sendCustomCommand(SYSEX_COMMAND_DYNAMIC, 1);
+    storeUserPreset(0, PACKED_LOADED_PATCH);
+    __real_midi_tick();
+    assert_true(persistence_read_begin());
+    assert_true(persistence_read(settings, sizeof(settings)));
+    persistence_write_begin();
+    persistence_write(settings, sizeof(settings));
+    persistence_write_end();
+
+    restartMidi();
+
+    assert_true(__real_midi_dynamic_mode());
+    assert_null(midi_fm_user_preset(0));
+}
+
+static void test_midi_ignores_corrupt_sram(UNUSED void** state)
+{
+    const u16 FIRST_PAYLOAD_BYTE = 9;
+    sendCustomCommand(SYSEX_COMMAND_DYNAMIC, 1);
+    __real_midi_tick();
+    wraps_sram()[FIRST_PAYLOAD_BYTE] ^= 0x01;
+
+    wraps_enable_logging_checks();
+    expect_log_warn("SRAM: Bad checksum");
+    restartMidi();
+
+    assert_false(__real_midi_dynamic_mode());
+}
+
+static void storePsgEnvelope(const u8* data, u16 length)
+{
+    u8 sequence[16] = { SYSEX_MANU_EXTENDED, SYSEX_MANU_REGION, SYSEX_MANU_ID,
+        SYSEX_COMMAND_STORE_PSG_ENVELOPE };
+    memcpy(&sequence[4], data, length);
+
+    __real_midi_sysex(sequence, 4 + length);
+}
+
+static void test_midi_sysex_stores_psg_envelope_for_program(
+    UNUSED void** state)
+{
+    const u8 PROGRAM = 3;
+    const u8 data[] = { PROGRAM, 0x06, 0x06, 0x00, 0x0F };
+    const u8 eef[] = { 0x66, 0x0F, EEF_END };
+    u8 stored[MAX_EEF_LENGTH];
+
+    storePsgEnvelope(data, sizeof(data));
+
+    assert_true(midi_psg_program_envelope(PROGRAM, stored));
+    assert_memory_equal(stored, eef, sizeof(eef));
+    assert_false(midi_psg_program_envelope(PROGRAM + 1, stored));
+}
+
+static void test_midi_sysex_empty_psg_envelope_removes_program_envelope(
+    UNUSED void** state)
+{
+    const u8 PROGRAM = 3;
+    const u8 data[] = { PROGRAM, 0x06, 0x06 };
+
+    storePsgEnvelope(data, sizeof(data));
+    storePsgEnvelope(data, 1);
+
+    u8 stored[MAX_EEF_LENGTH];
+    assert_false(midi_psg_program_envelope(PROGRAM, stored));
+}
+
+static void test_midi_sysex_rejects_psg_envelope_without_program(
+    UNUSED void** state)
+{
+    wraps_enable_logging_checks();
+    expect_log_warn("Envelope program?");
+
+    storePsgEnvelope(NULL, 0);
+}
+
+static void test_midi_restores_program_envelopes_from_sram(
+    UNUSED void** state)
+{
+    const u8 data[] = { 3, 0x06, 0x06 };
+    const u8 eef[] = { 0x66, EEF_END };
+    u8 stored[MAX_EEF_LENGTH];
+    storePsgEnvelope(data, sizeof(data));
+
+    restartMidi();
+
+    assert_true(midi_psg_program_envelope(3, stored));
+    assert_memory_equal(stored, eef, sizeof(eef));
+}
@@ -0,0 +1,62 @@
+#include "cmocka_inc.h"
+
+#include "persistence.h"
+#include "wraps.h"
+
+#define SRAM_HEADER_LENGTH 9
+#define SRAM_VERSION_OFFSET 4
+
+static int test_persistence_setup(UNUSED void** state)
+{
+    wraps_sram_erase();
+    wraps_disable_logging_checks();
+    return 0;
+}
+
+static void writeImage(const u8* data, u16 length)
+{
+    persistence_write_begin();
+    persistence_write(data, length);
+    persistence_write_end();
+}
+
+static void test_persistence_reads_back_written_image(UNUSED void** state)
+{
+    const u8 data[] = { 0x01, 0x02, 0xFF, 0x00, 0x80 };
+    u8 read[sizeof(data)];
+    writeImage(data, sizeof(data));
+
+    assert_true(persistence_read_begin());
+    assert_true(persistence_read(read, sizeof(read)));
+    assert_memory_equal(read, data, sizeof(data));
+    assert_false(persistence_read(read, 1));
+}
+
+static void test_persistence_ignores_blank_sram(UNUSED void** state)
+{
+    wraps_enable_logging_checks();
+
+    assert_false(persistence_read_begin());
+}
+
+static void test_persistence_rejects_bad_checksum(UNUSED void** state)
+{
+    const u8 data[] = { 0x01, 0x02, 0x03 };
+    writeImage(data, sizeof(data));
+    wraps_sram()[SRAM_HEADER_LENGTH + 1] ^= 0x10;
+
+    wraps_enable_logging_checks();
+    expect_log_warn("SRAM: Bad checksum");
+    assert_false(persistence_read_begin());
+}
+
+static void test_persistence_rejects_newer_version(UNUSED void** state)
+{
+    const u8 data[] = { 0x01 };
+    writeImage(data, sizeof(data));
+    wraps_sram()[SRAM_VERSION_OFFSET] = PERSISTENCE_VERSION + 1;
+
+    wraps_enable_logging_checks();
+    expect_log_warn("SRAM: Version %d?");
+    assert_false(persistence_read_begin());
+}
@@ -0,0 +1,293 @@
+#include "cmocka_inc.h"
+
+#include "sample_bank.h"
+#include "wraps.h"
+#include "z80_ym.h"
+
+#define MAX_ENCODED_SAMPLE 4096
+
+static const u8 SAMPLE_KEY = 36;
+static const u16 SAMPLE_RATE = 8000;
+
+static int test_sample_bank_setup(UNUSED void** state)
+{
+    sample_bank_init();
+    return 0;
+}
+
+static u16 write16bitValue(u8* out, u16 value)
+{
+    out[0] = value & 0x7F;
+    out[1] = (value >> 7) & 0x7F;
+    out[2] = value >> 14;
+    return 3;
+}
+
+static u16 encodeHeader(u8* out, u8 key, u16 length, u16 loopStart,
+    u16 loopLength)
+{
+    u16 index = 0;
+    out[index++] = key;
+    index += write16bitValue(&out[index], SAMPLE_RATE);
+    index += write16bitValue(&out[index], length);
+    index += write16bitValue(&out[index], loopStart);
+    index += write16bitValue(&out[index], loopLength);
+    return index;
+}
+
+static u16 encodeChunk(u8* out, const u8* data, u16 length)
+{
+    u16 index = 0;
+    u8 checksum = 0;
+    for (u16 group = 0; group < length; group += 7) {
+        u16 msbIndex = index++;
+        out[msbIndex] = 0;
+        for (u16 i = group; i < group + 7 && i < length; i++) {
+            out[msbIndex] |= (data[i] >> 7) << (i - group);
+            out[index++] = data[i] & 0x7F;
+        }
+    }
+    for (u16 i = 0; i < index; i++) {
+        checksum ^= out[i];
+    }
+    out[index++] = checksum;
+    return index;
+}
+
+static u16 encodeSample(u8* out, u8 key, const u8* data, u16 length)
+{
+    u16 index = encodeHeader(out, key, length, 0, 0);
+    for (u16 offset = 0; offset < length;
+         offset += SAMPLE_UPLOAD_CHUNK_LENGTH) {
+        u16 remaining = length - offset;
+        u16 chunk = remaining < SAMPLE_UPLOAD_CHUNK_LENGTH
+            ? remaining
+            : SAMPLE_UPLOAD_CHUNK_LENGTH;
+        index += encodeChunk(&out[index], &data[offset], chunk);
+    }
+    return index;
+}
+
+static void fillSample(u8* data, u16 length)
+{
+    for (u16 i = 0; i < length; i++) {
+        data[i] = 0x80 + i * 13;
+    }
+}
+
+static bool uploadEncoded(const u8* encoded, u16 length)
+{
+    sample_bank_upload_begin();
+    sample_bank_upload_data(encoded, length);
+    return sample_bank_upload_end();
+}
+
+static bool uploadUnchecked(u8 key, u16 length)
+{
+    static u8 data[MAX_ENCODED_SAMPLE];
+    static u8 encoded[MAX_ENCODED_SAMPLE];
+    fillSample(data, length);
+    u16 encodedLength = encodeSample(encoded, key, data, length);
+
+    wraps_disable_checks();
+    bool uploaded = uploadEncoded(encoded, encodedLength);
+    wraps_enable_checks();
+    return uploaded;
+}
+
+static void test_sample_bank_uploads_sample(UNUSED void** state)
+{
+    u8 data[10];
+    u8 encoded[32];
+    fillSample(data, sizeof(data));
+    u16 length = encodeSample(encoded, SAMPLE_KEY, data, sizeof(data));
+
+    expect_value(__wrap_synth_dacLoad, offset, 0);
+    expect_memory(__wrap_synth_dacLoad, data, data, sizeof(data));
+    expect_value(__wrap_synth_dacLoad, length, sizeof(data));
+    assert_true(uploadEncoded(encoded, length));
+
+    const UploadedSample* sample = sample_bank_find(SAMPLE_KEY);
+    assert_non_null(sample);
+    assert_int_equal(sample->offset, 0);
+    assert_int_equal(sample->length, sizeof(data));
+    assert_int_equal(sample->rate, SAMPLE_RATE);
+}
+
+static void test_sample_bank_streams_upload_in_chunks(UNUSED void** state)
+{
+    u8 data[100];
+    u8 encoded[160];
+    const u16 SLICE = 5;
+    fillSample(data, sizeof(data));
+    u16 length = encodeSample(encoded, SAMPLE_KEY, data, sizeof(data));
+
+    expect_value(__wrap_synth_dacLoad, offset, 0);
+    expect_memory(
+        __wrap_synth_dacLoad, data, data, SAMPLE_UPLOAD_CHUNK_LENGTH);
+    expect_value(__wrap_synth_dacLoad, length, SAMPLE_UPLOAD_CHUNK_LENGTH);
+    expect_value(__wrap_synth_dacLoad, offset, SAMPLE_UPLOAD_CHUNK_LENGTH);
+    expect_memory(__wrap_synth_dacLoad, data,
+        &data[SAMPLE_UPLOAD_CHUNK_LENGTH],
+        sizeof(data) - SAMPLE_UPLOAD_CHUNK_LENGTH);
+    expect_value(__wrap_synth_dacLoad, length,
+        sizeof(data) - SAMPLE_UPLOAD_CHUNK_LENGTH);
+
+    sample_bank_upload_begin();
+    for (u16 i = 0; i < length; i += SLICE) {
+        u16 remaining = length - i;
+        sample_bank_upload_data(
+            &encoded[i], remaining < SLICE ? remaining : SLICE);
+    }
+    assert_true(sample_bank_upload_end());
+}
+
+static void test_sample_bank_rejects_bad_checksum(UNUSED void** state)
+{
+    u8 data[10];
+    u8 encoded[32];
+    fillSample(data, sizeof(data));
+    u16 length = encodeSample(encoded, SAMPLE_KEY, data, sizeof(data));
+    encoded[length - 1] ^= 1;
+
+    assert_false(uploadEncoded(encoded, length));
+
+    assert_null(sample_bank_find(SAMPLE_KEY));
+    assert_int_equal(sample_bank_largest_free_block(), Z80_SAMPLE_ARENA_SIZE);
+}
+
+static void test_sample_bank_rejects_truncated_upload(UNUSED void** state)
+{
+    u8 data[100];
+    u8 encoded[160];
+    fillSample(data, sizeof(data));
+    u16 length = encodeSample(encoded, SAMPLE_KEY, data, sizeof(data));
+
+    expect_any(__wrap_synth_dacLoad, offset);
+    expect_any(__wrap_synth_dacLoad, data);
+    expect_any(__wrap_synth_dacLoad, length);
+    assert_false(uploadEncoded(encoded, length - 1));
+
+    assert_null(sample_bank_find(SAMPLE_KEY));
+    assert_int_equal(sample_bank_largest_free_block(), Z80_SAMPLE_ARENA_SIZE);
+}
+
+static void test_sample_bank_rejects_sample_larger_than_arena(
+    UNUSED void** state)
+{
+    u8 encoded[SAMPLE_UPLOAD_HEADER_LENGTH];
+    u16 length = encodeHeader(encoded, SAMPLE_KEY, Z80_SAMPLE_ARENA_SIZE + 1,
+        0, 0);
+
+    assert_false(uploadEncoded(encoded, length));
+    assert_null(sample_bank_find(SAMPLE_KEY));
+}
+
+static void test_sample_bank_rejects_loop_beyond_sample(UNUSED void** state)
+{
+    u8 encoded[SAMPLE_UPLOAD_HEADER_LENGTH];
+    u16 length = encodeHeader(encoded, SAMPLE_KEY, 100, 50, 51);
+
+    assert_false(uploadEncoded(encoded, length));
+    assert_int_equal(sample_bank_largest_free_block(), Z80_SAMPLE_ARENA_SIZE);
+}
+
+static void test_sample_bank_coalesces_freed_space(UNUSED void** state)
+{
+    assert_true(uploadUnchecked(35, 1500));
+    assert_true(uploadUnchecked(36, 500));
+    assert_true(uploadUnchecked(38, 1500));
+    assert_true(uploadUnchecked(40, 1500));
+    assert_true(uploadUnchecked(42, 1500));
+    assert_int_equal(sample_bank_largest_free_block(),
+        Z80_SAMPLE_ARENA_SIZE - 6500);
+
+    sample_bank_delete(35);
+    sample_bank_delete(36);
+
+    assert_int_equal(sample_bank_largest_free_block(), 2000);
+    assert_true(uploadUnchecked(44, 2000));
+    assert_int_equal(sample_bank_find(44)->offset, 0);
+}
+
+static void test_sample_bank_replaces_sample_for_key(UNUSED void** state)
+{
+    assert_true(uploadUnchecked(SAMPLE_KEY, 100));
+    assert_true(uploadUnchecked(SAMPLE_KEY, 200));
+
+    const UploadedSample* sample = sample_bank_find(SAMPLE_KEY);
+    assert_int_equal(sample->offset, 100);
+    assert_int_equal(sample->length, 200);
+    assert_int_equal(sample_bank_largest_free_block(),
+        Z80_SAMPLE_ARENA_SIZE - 300);
+}
+
+static bool uploadChecked(u8 key, u16 length)
+{
+    u8 data[10];
+    u8 encoded[32];
+    fillSample(data, length);
+    u16 encodedLength = encodeSample(encoded, key, data, length);
+
+    expect_any(__wrap_synth_dacLoad, offset);
+    expect_any(__wrap_synth_dacLoad, data);
+    expect_any(__wrap_synth_dacLoad, length);
+    return uploadEncoded(encoded, encodedLength);
+}
+
+static void expectSamplePlayed(u16 offset, u16 length)
+{
+    expect_value(__wrap_synth_dacPlayLoaded, offset, offset);
+    expect_value(__wrap_synth_dacPlayLoaded, length, length);
+    expect_value(__wrap_synth_dacPlayLoaded, rate, SAMPLE_RATE);
+    expect_value(__wrap_synth_dacPlayLoaded, loopStart, 0);
+    expect_value(__wrap_synth_dacPlayLoaded, loopLength, 0);
+}
+
+static void test_sample_bank_replacing_sample_keeps_other_key_playing(
+    UNUSED void** state)
+{
+    const u8 OTHER_KEY = 38;
+    assert_true(uploadUnchecked(SAMPLE_KEY, 10));
+    assert_true(uploadUnchecked(OTHER_KEY, 10));
+    expectSamplePlayed(10, 10);
+    assert_true(sample_bank_play(OTHER_KEY));
+
+    assert_true(uploadChecked(SAMPLE_KEY, 10));
+}
+
+static void test_sample_bank_replacing_playing_sample_stops_it(
+    UNUSED void** state)
+{
+    assert_true(uploadUnchecked(SAMPLE_KEY, 10));
+    expectSamplePlayed(0, 10);
+    assert_true(sample_bank_play(SAMPLE_KEY));
+
+    expect_function_call(__wrap_synth_dacStop);
+    assert_true(uploadChecked(SAMPLE_KEY, 10));
+}
+
+static void test_sample_bank_keeps_sample_when_replacement_fails(
+    UNUSED void** state)
+{
+    u8 encoded[SAMPLE_UPLOAD_HEADER_LENGTH];
+    u16 length
+        = encodeHeader(encoded, SAMPLE_KEY, Z80_SAMPLE_ARENA_SIZE, 0, 0);
+    assert_true(uploadUnchecked(SAMPLE_KEY, 100));
+
+    assert_false(uploadEncoded(encoded, length));
+
+    const UploadedSample* sample = sample_bank_find(SAMPLE_KEY);
+    assert_non_null(sample);
+    assert_int_equal(sample->length, 100);
+}
+
+static void test_sample_bank_limits_slots(UNUSED void** state)
+{
+    for (u8 i = 0; i < SAMPLE_BANK_SLOTS; i++) {
+        assert_true(uploadUnchecked(i, 10));
+    }
+
+    assert_false(uploadUnchecked(SAMPLE_BANK_SLOTS, 10));
+    assert_null(sample_bank_find(SAMPLE_BANK_SLOTS));
+}
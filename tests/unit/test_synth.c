@@ -1,5 +1,6 @@
 #include "cmocka_inc.h"
 
+#include "presets.h"
 #include "synth.h"
 #include "test_midi.h"
 #include <stdbool.h>
@@ -32,9 +33,15 @@ extern void __real_synth_operatorReleaseRate(u8 channel, u8 op, u8 releaseRate);
 extern void __real_synth_operatorSsgEg(u8 channel, u8 op, u8 ssgEg);
 extern void __real_synth_pitchBend(u8 channel, u16 bend);
 extern void __real_synth_preset(u8 channel, const FmChannel* preset);
+extern void __real_synth_presetImage(u8 channel, const FmPresetImage* image);
 extern void __real_synth_volume(u8 channel, u8 volume);
 extern const FmChannel* __real_synth_channelParameters(u8 channel);
 extern const Global* __real_synth_globalParameters();
+extern void __real_synth_specialMode(bool enable);
+extern void __real_synth_specialModePitch(u8 op, u8 octave, u16 freqNumber);
+extern void __real_synth_specialModeVolume(u8 op, u8 volume);
+extern void __real_synth_specialModeNoteOn(u8 op);
+extern void __real_synth_specialModeNoteOff(u8 op);
 
 static bool updated = false;
 static u8 lastChan = -1;
@@ -43,9 +50,9 @@ static ParameterUpdated lastParameterUpdated = -1;
 static void set_initial_registers()
 {
     const u16 count = 188;
-    expect_any_count(__wrap_YM2612_writeReg, part, count);
-    expect_any_count(__wrap_YM2612_writeReg, reg, count);
-    expect_any_count(__wrap_YM2612_writeReg, data, count);
+    expect_any_count(__wrap_ym_port_write, part, count);
+    expect_any_count(__wrap_ym_port_write, reg, count);
+    expect_any_count(__wrap_ym_port_write, data, count);
 
     const FmChannel M_BANK_0_INST_0_GRANDPIANO = { 2, 0, 3, 0, 0, 0, 0,
         { { 1, 0, 26, 1, 7, 0, 7, 4, 1, 39, 0 },
@@ -109,6 +116,35 @@ static void test_synth_sets_octave_and_freq_reg_chan(UNUSED void** state)
     }
 }
 
+static void test_synth_commits_octave_only_change(UNUSED void** state)
+{
+    const u8 chan = 0;
+    expect_ym2612_write_channel(chan, 0xA4, 0x22);
+    expect_ym2612_write_channel(chan, 0xA0, 0x84);
+    __real_synth_pitch(chan, 4, SYNTH_NTSC_C);
+
+    expect_ym2612_write_channel(chan, 0xA4, 0x2A);
+    expect_ym2612_write_channel(chan, 0xA0, 0x84);
+    __real_synth_pitch(chan, 5, SYNTH_NTSC_C);
+
+    __real_synth_pitch(chan, 5, SYNTH_NTSC_C);
+}
+
+static void test_synth_relatches_frequency_after_another_channel(
+    UNUSED void** state)
+{
+    expect_ym2612_write_channel(0, 0xA4, 0x22);
+    expect_ym2612_write_channel(0, 0xA0, 0x84);
+    __real_synth_pitch(0, 4, SYNTH_NTSC_C);
+    expect_ym2612_write_channel(1, 0xA4, 0x2A);
+    expect_ym2612_write_channel(1, 0xA0, 0x84);
+    __real_synth_pitch(1, 5, SYNTH_NTSC_C);
+
+    expect_ym2612_write_channel(0, 0xA4, 0x22);
+    expect_ym2612_write_channel(0, 0xA0, 0x85);
+    __real_synth_pitch(0, 4, SYNTH_NTSC_C + 1);
+}
+
 static void test_synth_sets_stereo_ams_and_freq(UNUSED void** state)
 {
     const u8 ams = 1;
@@ -196,8 +232,8 @@ static void test_synth_sets_operator_multiple_and_detune(UNUSED void** state)
 {
     const u8 baseReg = 0x30;
     for (u8 chan = 0; chan < MAX_FM_CHANS; chan++) {
-        u8 multiple = 0;
-        u8 detune = 0;
+        u8 multiple = 8;
+        u8 detune = 4;
         for (u8 op = 0; op < MAX_FM_OPERATORS; op++) {
             expect_ym2612_write_operator_any_data(chan, op, baseReg);
             __real_synth_operatorMultiple(chan, op, multiple);
@@ -216,7 +252,7 @@ static void test_synth_sets_operator_attack_rate_and_rate_scaling(
     const u8 baseReg = 0x50;
     for (u8 chan = 0; chan < MAX_FM_CHANS; chan++) {
         u8 attackRate = 0;
-        u8 rateScaling = 0;
+        u8 rateScaling = 3;
         for (u8 op = 0; op < MAX_FM_OPERATORS; op++) {
             expect_ym2612_write_operator_any_data(chan, op, baseReg);
             __real_synth_operatorAttackRate(chan, op, attackRate);
@@ -224,7 +260,7 @@ static void test_synth_sets_operator_attack_rate_and_rate_scaling(
                 chan, op, baseReg, attackRate | (rateScaling << 6));
             __real_synth_operatorRateScaling(chan, op, rateScaling);
             attackRate++;
-            rateScaling++;
+            rateScaling--;
         }
     }
 }
@@ -293,9 +329,11 @@ static void test_synth_sets_global_LFO_enable_and_frequency(UNUSED void** state)
 {
     const u8 baseReg = 0x22;
     expect_ym2612_write_reg_any_data(0, baseReg);
-    __real_synth_enableLfo(1);
-    expect_ym2612_write_reg(0, baseReg, (1 << 3) | 1);
+    __real_synth_enableLfo(0);
+    expect_ym2612_write_reg(0, baseReg, 1);
     __real_synth_globalLfoFrequency(1);
+    expect_ym2612_write_reg(0, baseReg, (1 << 3) | 1);
+    __real_synth_enableLfo(1);
 }
 
 static void test_synth_sets_busy_indicators(UNUSED void** state)
@@ -318,36 +356,31 @@ static void test_synth_sets_preset(UNUSED void** state)
             { 1, 5, 31, 3, 0, 1, 0, 0, 2, 30, 0 },
             { 1, 7, 31, 0, 6, 0, 4, 6, 7, 6, 0 } } };
 
+    /* Registers already holding the same value are not rewritten */
     expect_ym2612_write_channel_any_data(chan, 0xB0);
-    expect_ym2612_write_channel_any_data(chan, 0xB4);
     expect_ym2612_write_channel_any_data(chan, 0x30);
     expect_ym2612_write_channel_any_data(chan, 0x50);
     expect_ym2612_write_channel_any_data(chan, 0x60);
     expect_ym2612_write_channel_any_data(chan, 0x70);
     expect_ym2612_write_channel_any_data(chan, 0x80);
     expect_ym2612_write_channel_any_data(chan, 0x40);
-    expect_ym2612_write_channel_any_data(chan, 0x90);
     expect_ym2612_write_channel_any_data(chan, 0x38);
     expect_ym2612_write_channel_any_data(chan, 0x58);
     expect_ym2612_write_channel_any_data(chan, 0x68);
     expect_ym2612_write_channel_any_data(chan, 0x78);
     expect_ym2612_write_channel_any_data(chan, 0x88);
     expect_ym2612_write_channel_any_data(chan, 0x48);
-    expect_ym2612_write_channel_any_data(chan, 0x98);
     expect_ym2612_write_channel_any_data(chan, 0x34);
-    expect_ym2612_write_channel_any_data(chan, 0x54);
     expect_ym2612_write_channel_any_data(chan, 0x64);
     expect_ym2612_write_channel_any_data(chan, 0x74);
     expect_ym2612_write_channel_any_data(chan, 0x84);
     expect_ym2612_write_channel_any_data(chan, 0x44);
-    expect_ym2612_write_channel_any_data(chan, 0x94);
     expect_ym2612_write_channel_any_data(chan, 0x3C);
     expect_ym2612_write_channel_any_data(chan, 0x5C);
     expect_ym2612_write_channel_any_data(chan, 0x6C);
     expect_ym2612_write_channel_any_data(chan, 0x7C);
     expect_ym2612_write_channel_any_data(chan, 0x8C);
     expect_ym2612_write_channel_any_data(chan, 0x4C);
-    expect_ym2612_write_channel_any_data(chan, 0x9C);
 
     __real_synth_preset(chan, &M_BANK_0_INST_7_CLAVINET);
 }
@@ -462,10 +495,8 @@ test_synth_applies_volume_modifier_to_output_operators_algorithms_0_to_3(
 
             if (algorithm == 0) {
                 /* Operator values are not re-applied for algorithms 1-3 due
-                to unnecessary YM2612 writing optimisation */
-                expect_ym2612_write_operator(chan, 0, totalLevelReg, 0x27);
-                expect_ym2612_write_operator(chan, 1, totalLevelReg, 0x24);
-                expect_ym2612_write_operator(chan, 2, totalLevelReg, 0x4);
+                to unnecessary YM2612 writing optimisation. Only the output
+                operator's total level changes. */
                 expect_ym2612_write_operator(chan, 3, totalLevelReg, 0x28);
             }
             __real_synth_volume(chan, loudestVolume / 4);
@@ -486,8 +517,6 @@ static void test_synth_applies_volume_modifier_to_output_operators_algorithm_4(
         expect_ym2612_write_channel(chan, algorithmReg, algorithm);
         __real_synth_algorithm(chan, algorithm);
 
-        expect_ym2612_write_operator(chan, 0, totalLevelReg, 0x27);
-        expect_ym2612_write_operator(chan, 1, totalLevelReg, 0x24);
         expect_ym2612_write_operator(chan, 2, totalLevelReg, 0x29);
         expect_ym2612_write_operator(chan, 3, totalLevelReg, 0x28);
         __real_synth_volume(chan, loudestVolume / 4);
@@ -511,7 +540,6 @@ test_synth_applies_volume_modifier_to_output_operators_algorithms_5_and_6(
             if (algorithm == 5) {
                 /* Operator values are not re-applied for algorithms 1-3 due
                 to unnecessary YM2612 writing optimisation */
-                expect_ym2612_write_operator(chan, 0, totalLevelReg, 0x27);
                 expect_ym2612_write_operator(chan, 1, totalLevelReg, 0x40);
                 expect_ym2612_write_operator(chan, 2, totalLevelReg, 0x29);
                 expect_ym2612_write_operator(chan, 3, totalLevelReg, 0x28);
@@ -521,6 +549,215 @@ test_synth_applies_volume_modifier_to_output_operators_algorithms_5_and_6(
     }
 }
 
+static void test_synth_does_not_rewrite_unchanged_registers(
+    UNUSED void** state)
+{
+    const u8 chan = 0;
+
+    expect_ym2612_write_channel(chan, 0xB4, STEREO_MODE_LEFT << 6);
+    __real_synth_stereo(chan, STEREO_MODE_LEFT);
+    __real_synth_stereo(chan, STEREO_MODE_LEFT);
+
+    expect_ym2612_write_channel(chan, 0xB4, STEREO_MODE_RIGHT << 6);
+    __real_synth_stereo(chan, STEREO_MODE_RIGHT);
+}
+
+static void test_synth_counts_register_writes(UNUSED void** state)
+{
+    assert_int_equal(synth_writeCount(), 188);
+
+    expect_ym2612_write_reg(0, 0x28, 0xF0);
+    __real_synth_noteOn(0);
+    expect_ym2612_write_channel(0, 0xB0, 1);
+    __real_synth_algorithm(0, 1);
+    __real_synth_algorithm(0, 1);
+
+    assert_int_equal(synth_writeCount(), 190);
+}
+
+/* Rough 68000 cycle costs of a YM2612 register write. Both SGDK's
+   YM2612_writeReg and a queued write poll the busy flag twice and pad the
+   address write with dummy reads. Each unbatched write also pays a call and
+   a Z80 bus request/release round trip, which a batch pays once. */
+static const u32 CYCLES_BUS_ARBITRATION = 56;
+static const u32 CYCLES_BUSY_POLL = 24;
+static const u32 CYCLES_DUMMY_READS = 48;
+static const u32 CYCLES_PORT_WRITES = 24;
+static const u32 CYCLES_CALL_OVERHEAD = 40;
+
+#define CYCLES_PORT_ACCESS                                                     \
+    (CYCLES_BUSY_POLL * 2 + CYCLES_DUMMY_READS + CYCLES_PORT_WRITES)
+
+static u32 unbatchedCycles(u16 writes)
+{
+    return writes
+        * (CYCLES_CALL_OVERHEAD + CYCLES_BUS_ARBITRATION + CYCLES_PORT_ACCESS);
+}
+
+static u32 batchedCycles(u16 writes, u16 batches)
+{
+    return batches * (CYCLES_CALL_OVERHEAD + CYCLES_BUS_ARBITRATION)
+        + writes * CYCLES_PORT_ACCESS;
+}
+
+static void test_synth_batches_preset_writes(UNUSED void** state)
+{
+    const FmChannel M_BANK_0_INST_7_CLAVINET = { 1, 7, 3, 0, 0, 0, 0,
+        { { 1, 1, 31, 2, 0, 1, 0, 1, 6, 28, 0 },
+            { 1, 3, 31, 2, 0, 0, 0, 1, 7, 33, 0 },
+            { 1, 5, 31, 3, 0, 1, 0, 0, 2, 30, 0 },
+            { 1, 7, 31, 0, 6, 0, 4, 6, 7, 6, 0 } } };
+    const u16 expectedWrites = 24;
+    u16 writes = synth_writeCount();
+    u16 batches = synth_batchCount();
+
+    expect_any_count(__wrap_ym_port_write, part, expectedWrites);
+    expect_any_count(__wrap_ym_port_write, reg, expectedWrites);
+    expect_any_count(__wrap_ym_port_write, data, expectedWrites);
+    __real_synth_preset(0, &M_BANK_0_INST_7_CLAVINET);
+
+    writes = synth_writeCount() - writes;
+    batches = synth_batchCount() - batches;
+    assert_int_equal(writes, expectedWrites);
+    assert_int_equal(batches, 1);
+
+    u32 saved = unbatchedCycles(writes) - batchedCycles(writes, batches);
+    print_message("Estimated 68000 cycles saved per preset load: %u\n", saved);
+    assert_true(saved * 3 > unbatchedCycles(writes));
+}
+
+static void test_synth_only_writes_changed_preset_registers(
+    UNUSED void** state)
+{
+    FmChannel preset = *__real_synth_channelParameters(0);
+    preset.operators[2].attackRate = 12;
+    preset.operators[3].totalLevel = 20;
+
+    expect_ym2612_write_operator(0, 2, 0x50,
+        12 + (preset.operators[2].rateScaling << 6));
+    expect_ym2612_write_operator_any_data(0, 3, 0x40);
+    __real_synth_preset(0, &preset);
+}
+
+static void test_synth_rewrites_total_levels_when_algorithm_changes(
+    UNUSED void** state)
+{
+    FmChannel preset = *__real_synth_channelParameters(0);
+    preset.algorithm = 7;
+    expect_ym2612_write_operator_any_data(0, 3, 0x40);
+    __real_synth_volume(0, 60);
+
+    expect_ym2612_write_channel_any_data(0, 0xB0);
+    for (u8 op = 0; op < MAX_FM_OPERATORS - 1; op++) {
+        expect_ym2612_write_operator_any_data(0, op, 0x40);
+    }
+    __real_synth_preset(0, &preset);
+}
+
+static void test_synth_benchmarks_program_transitions(UNUSED void** state)
+{
+    const u16 fullLoadWrites = 30;
+    u32 totalWrites = 0;
+
+    wraps_disable_checks();
+    __real_synth_preset(0, M_BANK_0[0]);
+    for (u16 program = 0; program < MIDI_PROGRAMS; program++) {
+        u16 writes = synth_writeCount();
+        __real_synth_preset(0, M_BANK_0[(program + 1) % MIDI_PROGRAMS]);
+        totalWrites += (u16)(synth_writeCount() - writes);
+    }
+    wraps_enable_checks();
+
+    print_message("Average register writes per program change: %u.%02u "
+                  "(of %u)\n",
+        totalWrites / MIDI_PROGRAMS, (totalWrites * 100 / MIDI_PROGRAMS) % 100,
+        fullLoadWrites);
+    assert_true(totalWrites < fullLoadWrites * MIDI_PROGRAMS);
+}
+
+static void test_synth_streams_preset_image_registers(UNUSED void** state)
+{
+    FmPresetImage image;
+    memset(image.registers, 0x7E, FM_PRESET_IMAGE_LENGTH);
+    image.registers[0] = 0x07;
+    image.registers[1] = STEREO_MODE_CENTRE << 6;
+    wraps_disable_checks();
+    __real_synth_volume(0, 0);
+    wraps_enable_checks();
+
+    /* All operators become carriers, so total levels follow the volume */
+    expect_ym2612_write_channel(0, 0xB0, 0x07);
+    for (u8 reg = 0x30; reg < 0xA0; reg += 4) {
+        if (reg == 0x4C) {
+            continue;
+        }
+        expect_ym2612_write_reg(0, reg, (reg & 0xF0) == 0x40 ? 0x7F : 0x7E);
+    }
+    __real_synth_presetImage(0, &image);
+
+    const FmChannel* chan = __real_synth_channelParameters(0);
+    assert_int_equal(chan->algorithm, 7);
+    assert_int_equal(chan->operators[1].multiple, 14);
+    assert_int_equal(chan->operators[1].detune, 7);
+    assert_int_equal(chan->operators[1].totalLevel, 0x7E);
+}
+
+static void assert_channel_parameters_equal(u8 chanA, u8 chanB)
+{
+    const FmChannel* a = __real_synth_channelParameters(chanA);
+    const FmChannel* b = __real_synth_channelParameters(chanB);
+    assert_int_equal(a->algorithm, b->algorithm);
+    assert_int_equal(a->feedback, b->feedback);
+    assert_int_equal(a->stereo, b->stereo);
+    assert_int_equal(a->ams, b->ams);
+    assert_int_equal(a->fms, b->fms);
+    assert_memory_equal(a->operators, b->operators, sizeof(a->operators));
+}
+
+static void test_synth_preset_images_match_presets(UNUSED void** state)
+{
+    wraps_disable_checks();
+    for (u16 program = 0; program < MIDI_PROGRAMS; program++) {
+        __real_synth_preset(0, M_BANK_0[program]);
+        __real_synth_presetImage(1, M_BANK_0_IMAGES[program]);
+        assert_channel_parameters_equal(0, 1);
+
+        __real_synth_preset(0, M_BANK_8[program]);
+        __real_synth_presetImage(1, M_BANKS[8][program]);
+        assert_channel_parameters_equal(0, 1);
+
+        __real_synth_preset(0, &P_BANK_0[program]->channel);
+        __real_synth_presetImage(1, &P_BANK_0_IMAGES[program].image);
+        assert_channel_parameters_equal(0, 1);
+        assert_int_equal(P_BANK_0[program]->key, P_BANK_0_IMAGES[program].key);
+    }
+    wraps_enable_checks();
+}
+
+static void test_synth_volume_changes_only_write_carriers(UNUSED void** state)
+{
+    const u8 carrierCounts[FM_ALGORITHMS] = { 1, 1, 1, 1, 2, 3, 3, 4 };
+    const u16 changesPerAlgorithm = 1024;
+
+    wraps_disable_checks();
+    for (u8 op = 0; op < MAX_FM_OPERATORS; op++) {
+        __real_synth_operatorTotalLevel(0, op, 0);
+    }
+    for (u8 algorithm = 0; algorithm < FM_ALGORITHMS; algorithm++) {
+        __real_synth_algorithm(0, algorithm);
+        u16 count = synth_writeCount();
+        for (u16 i = 0; i < changesPerAlgorithm; i++) {
+            /* alternate between silent and full volume, so every carrier's
+               total level changes */
+            __real_synth_volume(0, (i & 1) ? MAX_MIDI_VOLUME : 0);
+        }
+        u16 writes = synth_writeCount() - count;
+        assert_int_equal(
+            writes, changesPerAlgorithm * carrierCounts[algorithm]);
+    }
+    wraps_enable_checks();
+}
+
 static void test_synth_exposes_fm_channel_parameters(UNUSED void** state)
 {
     const FmChannel* chan = __real_synth_channelParameters(0);
@@ -564,7 +801,7 @@ static void test_synth_calls_callback_when_lfo_freq_changes(UNUSED void** state)
     synth_setParameterUpdateCallback(&updateCallback);
 
     expect_ym2612_write_reg_any_data(0, 0x22);
-    __real_synth_globalLfoFrequency(1);
+    __real_synth_globalLfoFrequency(2);
 
     assert_true(updated);
     assert_int_equal(lastParameterUpdated, Lfo);
@@ -581,3 +818,83 @@ static void test_synth_calls_callback_when_lfo_enable_changes(
     assert_true(updated);
     assert_int_equal(lastParameterUpdated, Lfo);
 }
+
+static void test_synth_enables_ch3_special_mode(UNUSED void** state)
+{
+    expect_ym2612_write_reg(0, 0x27, 0x40);
+    __real_synth_specialMode(true);
+
+    expect_ym2612_write_reg(0, 0x27, 0);
+    __real_synth_specialMode(false);
+}
+
+static void test_synth_sets_ch3_special_mode_operator_frequencies(
+    UNUSED void** state)
+{
+    const u8 FREQ_REGS[MAX_FM_OPERATORS] = { 0xA9, 0xAA, 0xA8, 0xA2 };
+
+    expect_ym2612_write_reg(0, 0x27, 0x40);
+    __real_synth_specialMode(true);
+
+    for (u8 op = 0; op < MAX_FM_OPERATORS; op++) {
+        expect_ym2612_write_reg(0, FREQ_REGS[op] + 4, 0x22);
+        expect_ym2612_write_reg(0, FREQ_REGS[op], 0x84);
+        __real_synth_specialModePitch(op, 4, SYNTH_NTSC_C);
+    }
+}
+
+static void test_synth_commits_ch3_special_mode_operator_octave_change(
+    UNUSED void** state)
+{
+    expect_ym2612_write_reg(0, 0x27, 0x40);
+    __real_synth_specialMode(true);
+
+    expect_ym2612_write_reg(0, 0xAD, 0x22);
+    expect_ym2612_write_reg(0, 0xA9, 0x84);
+    __real_synth_specialModePitch(0, 4, SYNTH_NTSC_C);
+
+    expect_ym2612_write_reg(0, 0xAD, 0x2A);
+    expect_ym2612_write_reg(0, 0xA9, 0x84);
+    __real_synth_specialModePitch(0, 5, SYNTH_NTSC_C);
+
+    __real_synth_specialModePitch(0, 5, SYNTH_NTSC_C);
+}
+
+static void test_synth_keys_ch3_special_mode_operators_independently(
+    UNUSED void** state)
+{
+    expect_ym2612_write_reg(0, 0x27, 0x40);
+    __real_synth_specialMode(true);
+
+    expect_ym2612_write_reg(0, 0x28, 0x12);
+    __real_synth_specialModeNoteOn(0);
+    expect_ym2612_write_reg(0, 0x28, 0x52);
+    __real_synth_specialModeNoteOn(2);
+    assert_int_equal(synth_busy(), 1 << SPECIAL_MODE_CHANNEL);
+
+    expect_ym2612_write_reg(0, 0x28, 0x42);
+    __real_synth_specialModeNoteOff(0);
+    expect_ym2612_write_reg(0, 0x28, 0x02);
+    __real_synth_specialModeNoteOff(2);
+    assert_int_equal(synth_busy(), 0);
+}
+
+static void test_synth_applies_ch3_special_mode_volume_per_operator(
+    UNUSED void** state)
+{
+    const u8 chan = SPECIAL_MODE_CHANNEL;
+    const u8 totalLevelReg = 0x40;
+    const u8 loudestVolume = 0x7F;
+
+    expect_ym2612_write_reg(0, 0x27, 0x40);
+    __real_synth_specialMode(true);
+    expect_ym2612_write_channel(chan, 0xB0, 7);
+    __real_synth_algorithm(chan, 7);
+
+    expect_ym2612_write_operator(chan, 1, totalLevelReg, 0x40);
+    __real_synth_specialModeVolume(1, loudestVolume / 4);
+    __real_synth_specialModeVolume(1, loudestVolume / 4);
+
+    expect_ym2612_write_operator(chan, 1, totalLevelReg, 36);
+    __real_synth_specialModeVolume(1, loudestVolume);
+}
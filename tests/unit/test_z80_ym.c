@@ -0,0 +1,237 @@
+#include "cmocka_inc.h"
+
+#include "wraps.h"
+#include "z80_emu.h"
+#include "z80_ym.h"
+
+static const u16 DRAIN_INSTRUCTIONS = 2000;
+
+static int test_z80_ym_setup(UNUSED void** state)
+{
+    z80_ym_init();
+    z80_emu_reset(wraps_z80_ram());
+    return 0;
+}
+
+static void assert_ym_write(u16 index, u8 part, u8 reg, u8 data)
+{
+    const Z80EmuYmWrite* write = z80_emu_ymWrite(index);
+    assert_int_equal(write->part, part);
+    assert_int_equal(write->reg, reg);
+    assert_int_equal(write->data, data);
+}
+
+static void test_z80_ym_loads_driver(UNUSED void** state)
+{
+    assert_memory_equal(wraps_z80_ram(), Z80_YM_DRIVER, Z80_YM_DRIVER_SIZE);
+}
+
+static void test_z80_ym_driver_writes_registers_in_order(UNUSED void** state)
+{
+    z80_ym_beginWrites();
+    z80_ym_write(0, 0x28, 0xF0);
+    z80_ym_write(1, 0xB4, 0xC0);
+    z80_ym_write(0, 0x40, 0x7F);
+    z80_ym_endWrites();
+
+    z80_emu_run(DRAIN_INSTRUCTIONS);
+
+    assert_int_equal(z80_emu_ymWriteCount(), 3);
+    assert_ym_write(0, 0, 0x28, 0xF0);
+    assert_ym_write(1, 1, 0xB4, 0xC0);
+    assert_ym_write(2, 0, 0x40, 0x7F);
+    assert_int_equal(wraps_z80_ram()[Z80_YM_RING_TAIL],
+        wraps_z80_ram()[Z80_YM_RING_HEAD]);
+}
+
+static void test_z80_ym_driver_waits_for_batch_to_be_published(
+    UNUSED void** state)
+{
+    z80_ym_beginWrites();
+    z80_ym_write(0, 0x30, 0x01);
+
+    z80_emu_run(DRAIN_INSTRUCTIONS);
+    assert_int_equal(z80_emu_ymWriteCount(), 0);
+
+    z80_ym_endWrites();
+    z80_emu_run(DRAIN_INSTRUCTIONS);
+    assert_int_equal(z80_emu_ymWriteCount(), 1);
+    assert_ym_write(0, 0, 0x30, 0x01);
+}
+
+static void test_z80_ym_driver_waits_while_ym2612_busy(UNUSED void** state)
+{
+    z80_ym_beginWrites();
+    z80_ym_write(0, 0x30, 0x01);
+    z80_ym_write(0, 0x34, 0x02);
+    z80_ym_endWrites();
+    z80_emu_setYmBusyReads(50);
+
+    z80_emu_run(50);
+    assert_int_equal(z80_emu_ymWriteCount(), 1);
+
+    z80_emu_run(DRAIN_INSTRUCTIONS);
+    assert_int_equal(z80_emu_ymWriteCount(), 2);
+    assert_ym_write(1, 0, 0x34, 0x02);
+}
+
+static void test_z80_ym_driver_wraps_around_ring(UNUSED void** state)
+{
+    const u16 batches = 20;
+    const u8 writesPerBatch = 10;
+
+    for (u16 batch = 0; batch < batches; batch++) {
+        z80_ym_beginWrites();
+        for (u8 i = 0; i < writesPerBatch; i++) {
+            z80_ym_write(batch & 1, 0x30 + i, batch);
+        }
+        z80_ym_endWrites();
+        z80_emu_run(DRAIN_INSTRUCTIONS);
+    }
+
+    assert_int_equal(z80_emu_ymWriteCount(), batches * writesPerBatch);
+    for (u16 batch = 0; batch < batches; batch++) {
+        for (u8 i = 0; i < writesPerBatch; i++) {
+            assert_ym_write(batch * writesPerBatch + i, batch & 1, 0x30 + i,
+                batch);
+        }
+    }
+}
+
+static u8 rom[0x10000];
+
+static const u8* mapSample(u16 windowOffset, u16 length)
+{
+    u32 base = (u32)(uintptr_t)rom;
+    u16 offset = (windowOffset - base) & 0x7FFF;
+    for (u16 i = 0; i < length; i++) {
+        rom[offset + i] = 0x80 + i;
+    }
+    z80_emu_mapRom(rom, sizeof(rom), base);
+    return &rom[offset];
+}
+
+static void assert_dac_writes(u16 first, u16 count)
+{
+    for (u16 i = 0; i < count; i++) {
+        assert_ym_write(first + i, 0, 0x2A, 0x80 + i);
+    }
+}
+
+static void test_z80_ym_driver_streams_sample_to_dac(UNUSED void** state)
+{
+    const u16 length = 6;
+    const u8* sample = mapSample(0x100, length);
+
+    z80_ym_playSample(sample, length, 8000);
+    z80_emu_run(DRAIN_INSTRUCTIONS);
+
+    assert_int_equal(z80_emu_ymWriteCount(), length);
+    assert_dac_writes(0, length);
+}
+
+static void test_z80_ym_driver_mixes_register_writes_with_sample(
+    UNUSED void** state)
+{
+    const u16 length = 3;
+    const u8* sample = mapSample(0x100, length);
+
+    z80_ym_playSample(sample, length, 8000);
+    z80_ym_beginWrites();
+    z80_ym_write(0, 0x28, 0xF0);
+    z80_ym_write(0, 0x28, 0xF1);
+    z80_ym_endWrites();
+    z80_emu_run(DRAIN_INSTRUCTIONS);
+
+    assert_int_equal(z80_emu_ymWriteCount(), 5);
+    assert_ym_write(0, 0, 0x28, 0xF0);
+    assert_ym_write(1, 0, 0x2A, 0x80);
+    assert_ym_write(2, 0, 0x28, 0xF1);
+    assert_ym_write(3, 0, 0x2A, 0x81);
+    assert_ym_write(4, 0, 0x2A, 0x82);
+}
+
+static void test_z80_ym_driver_switches_bank_mid_sample(UNUSED void** state)
+{
+    const u16 length = 8;
+    const u8* sample = mapSample(0x7FFC, length);
+    u16 firstBank = ((u32)(uintptr_t)sample >> 15) & 0x1FF;
+
+    z80_ym_playSample(sample, length, 8000);
+    z80_emu_run(DRAIN_INSTRUCTIONS);
+
+    assert_int_equal(z80_emu_ymWriteCount(), length);
+    assert_dac_writes(0, length);
+    assert_int_equal(z80_emu_bank(), (firstBank + 1) & 0x1FF);
+}
+
+static void test_z80_ym_driver_stops_sample(UNUSED void** state)
+{
+    const u16 length = 200;
+    const u8* sample = mapSample(0x100, length);
+
+    z80_ym_playSample(sample, length, 8000);
+    z80_emu_run(DRAIN_INSTRUCTIONS / 4);
+    z80_ym_stopSample();
+    z80_emu_run(1);
+    u16 played = z80_emu_ymWriteCount();
+    z80_emu_run(DRAIN_INSTRUCTIONS);
+
+    assert_in_range(played, 1, length - 1);
+    assert_int_equal(z80_emu_ymWriteCount(), played);
+}
+
+static void test_z80_ym_driver_restarts_retriggered_sample(
+    UNUSED void** state)
+{
+    const u16 length = 4;
+    const u8* sample = mapSample(0x100, length);
+
+    z80_ym_playSample(sample, length, 8000);
+    z80_emu_run(DRAIN_INSTRUCTIONS);
+    z80_ym_playSample(sample, length, 8000);
+    z80_emu_run(DRAIN_INSTRUCTIONS);
+
+    assert_int_equal(z80_emu_ymWriteCount(), length * 2);
+    assert_dac_writes(0, length);
+    assert_dac_writes(length, length);
+}
+
+static void test_z80_ym_driver_streams_arena_sample(UNUSED void** state)
+{
+    const u8 sample[] = { 0x80, 0x81, 0x82, 0x83, 0x84 };
+    const u16 offset = 0x40;
+
+    z80_ym_writeSampleArena(offset, sample, sizeof(sample));
+    z80_ym_playArenaSample(offset, sizeof(sample), 8000, 0, 0);
+    z80_emu_run(DRAIN_INSTRUCTIONS);
+
+    assert_memory_equal(
+        wraps_z80_ram() + Z80_SAMPLE_ARENA + offset, sample, sizeof(sample));
+    assert_int_equal(z80_emu_ymWriteCount(), sizeof(sample));
+    assert_dac_writes(0, sizeof(sample));
+}
+
+static void test_z80_ym_driver_loops_arena_sample(UNUSED void** state)
+{
+    const u8 sample[] = { 0x80, 0x81, 0x82, 0x83 };
+    const u16 loopStart = 2;
+    const u16 loopLength = 2;
+
+    z80_ym_writeSampleArena(0, sample, sizeof(sample));
+    z80_ym_playArenaSample(0, sizeof(sample), 8000, loopStart, loopLength);
+    z80_emu_run(DRAIN_INSTRUCTIONS);
+
+    assert_in_range(z80_emu_ymWriteCount(), 8, Z80_EMU_MAX_YM_WRITES);
+    assert_dac_writes(0, sizeof(sample));
+    for (u16 i = sizeof(sample); i < 8; i += loopLength) {
+        assert_ym_write(i, 0, 0x2A, 0x82);
+        assert_ym_write(i + 1, 0, 0x2A, 0x83);
+    }
+
+    z80_ym_stopSample();
+    z80_emu_run(1);
+    u16 played = z80_emu_ymWriteCount();
+    z80_emu_run(DRAIN_INSTRUCTIONS);
+    assert_int_equal(z80_emu_ymWriteCount(), played);
+}
@@ -1,6 +1,8 @@
 #include "cmocka_inc.h"
 
+#include "persistence.h"
 #include "synth.h"
+#include "z80_emu.h"
 
 #include <stdbool.h>
 
@@ -192,6 +194,14 @@ void __wrap_synth_preset(u8 channel, const FmChannel* preset)
     check_expected(preset);
 }
 
+void __wrap_synth_presetImage(u8 channel, const FmPresetImage* image)
+{
+    if (disableChecks)
+        return;
+    check_expected(channel);
+    check_expected(image);
+}
+
 void __wrap_synth_volume(u8 channel, u8 volume)
 {
     if (disableChecks)
@@ -200,9 +210,103 @@ void __wrap_synth_volume(u8 channel, u8 volume)
     check_expected(volume);
 }
 
+void __wrap_synth_specialMode(bool enable)
+{
+    if (disableChecks)
+        return;
+    check_expected(enable);
+}
+
+void __wrap_synth_specialModePitch(u8 op, u8 octave, u16 freqNumber)
+{
+    if (disableChecks)
+        return;
+    check_expected(op);
+    check_expected(octave);
+    check_expected(freqNumber);
+}
+
+void __wrap_synth_specialModeVolume(u8 op, u8 volume)
+{
+    if (disableChecks)
+        return;
+    check_expected(op);
+    check_expected(volume);
+}
+
+void __wrap_synth_specialModeNoteOn(u8 op)
+{
+    if (disableChecks)
+        return;
+    check_expected(op);
+}
+
+void __wrap_synth_specialModeNoteOff(u8 op)
+{
+    if (disableChecks)
+        return;
+    check_expected(op);
+}
+
+bool __wrap_synth_dacAvailable(void)
+{
+    return mock_type(bool);
+}
+
+void __wrap_synth_dacEnable(bool enable)
+{
+    if (disableChecks)
+        return;
+    check_expected(enable);
+}
+
+void __wrap_synth_dacPlay(const u8* data, u16 length, u16 rate)
+{
+    if (disableChecks)
+        return;
+    check_expected(data);
+    check_expected(length);
+    check_expected(rate);
+}
+
+void __wrap_synth_dacStop(void)
+{
+    if (disableChecks)
+        return;
+    function_called();
+}
+
+void __wrap_synth_dacLoad(u16 offset, const u8* data, u16 length)
+{
+    if (disableChecks)
+        return;
+    check_expected(offset);
+    check_expected(data);
+    check_expected(length);
+}
+
+void __wrap_synth_dacPlayLoaded(
+    u16 offset, u16 length, u16 rate, u16 loopStart, u16 loopLength)
+{
+    if (disableChecks)
+        return;
+    check_expected(offset);
+    check_expected(length);
+    check_expected(rate);
+    check_expected(loopStart);
+    check_expected(loopLength);
+}
+
+static FmChannel channelParameters;
+
+void wraps_synth_setChannelParameters(const FmChannel* parameters)
+{
+    channelParameters = *parameters;
+}
+
 const FmChannel* __wrap_synth_channelParameters(u8 channel)
 {
-    return NULL;
+    return &channelParameters;
 }
 
 const Global* __wrap_synth_globalParameters()
@@ -303,6 +407,22 @@ void __wrap_midi_sysex(u8* data, u16 length)
     check_expected(length);
 }
 
+void __wrap_midi_sysex_begin(void)
+{
+    function_called();
+}
+
+void __wrap_midi_sysex_data(const u8* data, u16 length)
+{
+    check_expected(data);
+    check_expected(length);
+}
+
+void __wrap_midi_sysex_end(void)
+{
+    function_called();
+}
+
 void __wrap_midi_mappings(u8* mappingDest)
 {
     check_expected(mappingDest);
@@ -323,9 +443,15 @@ void __wrap_midi_psg_tick(void)
     function_called();
 }
 
-void __wrap_midi_psg_load_envelope(const u8* eef)
+void __wrap_midi_tick(void)
+{
+    function_called();
+}
+
+bool __wrap_midi_psg_load_envelope(const u8* eef)
 {
     check_expected_ptr(eef);
+    return true;
 }
 
 void __wrap_midi_reset(void)
@@ -374,7 +500,7 @@ void __wrap_ui_update(void)
     function_called();
 }
 
-void __wrap_YM2612_writeReg(const u16 part, const u8 reg, const u8 data)
+void __wrap_ym_port_write(u8 part, u8 reg, u8 data)
 {
     if (disableChecks)
         return;
@@ -825,6 +951,72 @@ void __wrap_Z80_requestBus(bool wait)
 {
 }
 
+void __wrap_Z80_releaseBus(void)
+{
+}
+
+static u8 z80Ram[Z80_EMU_RAM_SIZE];
+
+u8* wraps_z80_ram(void)
+{
+    return z80Ram;
+}
+
+void __wrap_Z80_loadCustomDriver(const u8* drv, u16 size)
+{
+    memset(z80Ram, 0, sizeof(z80Ram));
+    memcpy(z80Ram, drv, size);
+}
+
+u8 __wrap_Z80_read(const u16 addr)
+{
+    return z80Ram[addr];
+}
+
+void __wrap_Z80_write(const u16 addr, const u8 value)
+{
+    z80Ram[addr] = value;
+}
+
+static u8 sram[PERSISTENCE_SIZE];
+static bool sramWritable;
+
+u8* wraps_sram(void)
+{
+    return sram;
+}
+
+void wraps_sram_erase(void)
+{
+    memset(sram, 0xFF, sizeof(sram));
+}
+
+void __wrap_SRAM_enable(void)
+{
+    sramWritable = true;
+}
+
+void __wrap_SRAM_enableRO(void)
+{
+    sramWritable = false;
+}
+
+void __wrap_SRAM_disable(void)
+{
+    sramWritable = false;
+}
+
+u8 __wrap_SRAM_readByte(u32 offset)
+{
+    return sram[offset];
+}
+
+void __wrap_SRAM_writeByte(u32 offset, u8 val)
+{
+    assert_true(sramWritable);
+    sram[offset] = val;
+}
+
 void __wrap_SYS_doVBlankProcessEx(VBlankProcessTime processTime)
 {
 }
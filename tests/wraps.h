@@ -31,6 +31,9 @@ void wraps_disable_checks(void);
 void wraps_enable_checks(void);
 void wraps_disable_logging_checks(void);
 void wraps_enable_logging_checks(void);
+u8* wraps_z80_ram(void);
+u8* wraps_sram(void);
+void wraps_sram_erase(void);
 void __wrap_synth_enableLfo(u8 enable);
 void __wrap_synth_globalLfoFrequency(u8 freq);
 void __wrap_synth_noteOn(u8 channel);
@@ -57,7 +60,20 @@ void __wrap_synth_operatorAmplitudeModulation(
 void __wrap_synth_operatorReleaseRate(u8 channel, u8 op, u8 releaseRate);
 void __wrap_synth_operatorSsgEg(u8 channel, u8 op, u8 ssgEg);
 void __wrap_synth_preset(u8 channel, const FmChannel* preset);
+void __wrap_synth_presetImage(u8 channel, const FmPresetImage* image);
 void __wrap_synth_volume(u8 channel, u8 volume);
+void __wrap_synth_specialMode(bool enable);
+void __wrap_synth_specialModePitch(u8 op, u8 octave, u16 freqNumber);
+void __wrap_synth_specialModeVolume(u8 op, u8 volume);
+void __wrap_synth_specialModeNoteOn(u8 op);
+void __wrap_synth_specialModeNoteOff(u8 op);
+bool __wrap_synth_dacAvailable(void);
+void __wrap_synth_dacEnable(bool enable);
+void __wrap_synth_dacPlay(const u8* data, u16 length, u16 rate);
+void __wrap_synth_dacStop(void);
+void __wrap_synth_dacLoad(u16 offset, const u8* data, u16 length);
+void __wrap_synth_dacPlayLoaded(
+    u16 offset, u16 length, u16 rate, u16 loopStart, u16 loopLength);
 const FmChannel* __wrap_synth_channelParameters(u8 channel);
 const Global* __wrap_synth_globalParameters();
 bool __wrap_comm_read_ready(void);
@@ -77,14 +93,18 @@ bool __wrap_midi_getPolyphonic(void);
 void __wrap_midi_cc(u8 chan, u8 controller, u8 value);
 void __wrap_midi_program(u8 chan, u8 program);
 void __wrap_midi_sysex(u8* data, u16 length);
+void __wrap_midi_sysex_begin(void);
+void __wrap_midi_sysex_data(const u8* data, u16 length);
+void __wrap_midi_sysex_end(void);
 bool __wrap_midi_dynamic_mode(void);
 DeviceChannel* __wrap_midi_channel_mappings(void);
 void __wrap_midi_psg_tick(void);
-void __wrap_midi_psg_load_envelope(const u8* eef);
+void __wrap_midi_tick(void);
+bool __wrap_midi_psg_load_envelope(const u8* eef);
 void __wrap_midi_reset(void);
 void __wrap_ui_fm_set_parameters_visibility(u8 chan, bool show);
 void __wrap_ui_update(void);
-void __wrap_YM2612_writeReg(const u16 part, const u8 reg, const u8 data);
+void __wrap_ym_port_write(u8 part, u8 reg, u8 data);
 void __wrap_VDP_drawText(const char* str, u16 x, u16 y);
 void __wrap_SYS_setVIntCallback(VoidCallback* CB);
 void __wrap_VDP_setTextPalette(u16 palette);
@@ -143,6 +163,7 @@ Log* __wrap_log_dequeue(void);
 void __wrap_VDP_clearTextArea(u16 x, u16 y, u16 w, u16 h);
 bool __wrap_region_isPal(void);
 void wraps_region_setIsPal(bool isPal);
+void wraps_synth_setChannelParameters(const FmChannel* parameters);
 
 void __wrap_comm_megawifi_midiEmitCallback(u8 midiByte);
 mw_err __wrap_mediator_recv_event(void);
@@ -176,6 +197,11 @@ enum lsd_status __wrap_lsd_send(
     uint8_t ch, const char* data, int16_t len, void* ctx, lsd_send_cb send_cb);
 
 void __wrap_Z80_requestBus(bool wait);
+void __wrap_SRAM_enable(void);
+void __wrap_SRAM_enableRO(void);
+void __wrap_SRAM_disable(void);
+u8 __wrap_SRAM_readByte(u32 offset);
+void __wrap_SRAM_writeByte(u32 offset, u8 val);
 void __wrap_SYS_doVBlankProcessEx(VBlankProcessTime processTime);
 
 void __wrap_VDP_setTileMapXY(VDPPlane plane, u16 tile, u16 x, u16 y);
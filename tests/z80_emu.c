@@ -0,0 +1,334 @@
+#include "z80_emu.h"
+#include "cmocka_inc.h"
+#include <string.h>
+
+/* Interprets the subset of Z80 instructions used by the YM2612 driver, with
+   the YM2612 mapped at 0x4000-0x4003, the bank register at 0x6000 and a
+   window onto a mapped region of the 68000 bus at 0x8000-0xFFFF. */
+
+static u8* ram;
+static u16 pc;
+static u16 sp;
+static u8 a;
+static u8 b;
+static u8 c;
+static u8 d;
+static u8 e;
+static u8 h;
+static u8 l;
+static u8 shadow[6];
+static bool zero;
+static u16 bank;
+static const u8* rom;
+static u32 romSize;
+static u32 romAddress;
+static u16 ymBusyReads;
+static u8 ymAddress[2];
+static Z80EmuYmWrite ymWrites[Z80_EMU_MAX_YM_WRITES];
+static u16 ymWriteCount;
+
+static u8 readRom(u16 addr)
+{
+    u32 address = ((u32)bank << 15) | (addr & 0x7FFF);
+    u32 offset = (address - romAddress) & 0xFFFFFF;
+    if (rom == NULL || offset >= romSize) {
+        fail_msg("Z80 read from unmapped 68000 address %06X", address);
+    }
+    return rom[offset];
+}
+
+static u8 readMemory(u16 addr)
+{
+    if (addr >= 0x4000 && addr <= 0x4003) {
+        if (ymBusyReads > 0) {
+            ymBusyReads--;
+            return 0x80;
+        }
+        return 0;
+    }
+    if (addr >= 0x8000) {
+        return readRom(addr);
+    }
+    if (addr >= Z80_EMU_RAM_SIZE) {
+        fail_msg("Z80 read from unmapped address %04X", addr);
+    }
+    return ram[addr];
+}
+
+static void writeMemory(u16 addr, u8 value)
+{
+    if (addr >= 0x4000 && addr <= 0x4003) {
+        u8 part = (addr >> 1) & 1;
+        if ((addr & 1) == 0) {
+            ymAddress[part] = value;
+            return;
+        }
+        if (ymWriteCount == Z80_EMU_MAX_YM_WRITES) {
+            fail_msg("Too many YM2612 writes");
+        }
+        Z80EmuYmWrite* ymWrite = &ymWrites[ymWriteCount++];
+        ymWrite->part = part;
+        ymWrite->reg = ymAddress[part];
+        ymWrite->data = value;
+        return;
+    }
+    if (addr == 0x6000) {
+        bank = (bank >> 1) | ((value & 1) << 8);
+        return;
+    }
+    if (addr >= Z80_EMU_RAM_SIZE) {
+        fail_msg("Z80 write to unmapped address %04X", addr);
+    }
+    ram[addr] = value;
+}
+
+static u8 fetch(void)
+{
+    return readMemory(pc++);
+}
+
+static u16 fetchWord(void)
+{
+    u8 low = fetch();
+    return low | (fetch() << 8);
+}
+
+static void push(u16 value)
+{
+    writeMemory(--sp, value >> 8);
+    writeMemory(--sp, value);
+}
+
+static u16 pop(void)
+{
+    u8 low = readMemory(sp++);
+    return low | (readMemory(sp++) << 8);
+}
+
+static void exchangeShadowRegisters(void)
+{
+    u8* registers[] = { &b, &c, &d, &e, &h, &l };
+    for (u8 i = 0; i < 6; i++) {
+        u8 value = *registers[i];
+        *registers[i] = shadow[i];
+        shadow[i] = value;
+    }
+}
+
+static void jumpRelative(bool condition)
+{
+    s8 offset = (s8)fetch();
+    if (condition) {
+        pc += offset;
+    }
+}
+
+static void step(void)
+{
+    u8 opcode = fetch();
+    switch (opcode) {
+    case 0xF3: // di
+        break;
+    case 0x31: // ld sp,nn
+        sp = fetchWord();
+        break;
+    case 0x21: // ld hl,nn
+        l = fetch();
+        h = fetch();
+        break;
+    case 0x01: // ld bc,nn
+        c = fetch();
+        b = fetch();
+        break;
+    case 0x2A: { // ld hl,(nn)
+        u16 addr = fetchWord();
+        l = readMemory(addr);
+        h = readMemory(addr + 1);
+        break;
+    }
+    case 0x22: { // ld (nn),hl
+        u16 addr = fetchWord();
+        writeMemory(addr, l);
+        writeMemory(addr + 1, h);
+        break;
+    }
+    case 0xED: { // ld bc,(nn)
+        u8 extended = fetch();
+        if (extended != 0x4B) {
+            fail_msg("Unsupported Z80 opcode ED %02X at %04X", extended,
+                pc - 2);
+        }
+        u16 addr = fetchWord();
+        c = readMemory(addr);
+        b = readMemory(addr + 1);
+        break;
+    }
+    case 0xD9: // exx
+        exchangeShadowRegisters();
+        break;
+    case 0xC5: // push bc
+        push((b << 8) | c);
+        break;
+    case 0xC1: { // pop bc
+        u16 value = pop();
+        b = value >> 8;
+        c = value;
+        break;
+    }
+    case 0xCD: { // call nn
+        u16 addr = fetchWord();
+        push(pc);
+        pc = addr;
+        break;
+    }
+    case 0xC9: // ret
+        pc = pop();
+        break;
+    case 0x3A: // ld a,(nn)
+        a = readMemory(fetchWord());
+        break;
+    case 0x32: // ld (nn),a
+        writeMemory(fetchWord(), a);
+        break;
+    case 0x7E: // ld a,(hl)
+        a = readMemory((h << 8) | l);
+        break;
+    case 0x12: // ld (de),a
+        writeMemory((d << 8) | e, a);
+        break;
+    case 0x5F: // ld e,a
+        e = a;
+        break;
+    case 0x78: // ld a,b
+        a = b;
+        break;
+    case 0x7C: // ld a,h
+        a = h;
+        break;
+    case 0x3E: // ld a,n
+        a = fetch();
+        break;
+    case 0x06: // ld b,n
+        b = fetch();
+        break;
+    case 0x1E: // ld e,n
+        e = fetch();
+        break;
+    case 0x7D: // ld a,l
+        a = l;
+        break;
+    case 0x16: // ld d,n
+        d = fetch();
+        break;
+    case 0x2C: // inc l
+        zero = ++l == 0;
+        break;
+    case 0x1C: // inc e
+        zero = ++e == 0;
+        break;
+    case 0x3D: // dec a
+        zero = --a == 0;
+        break;
+    case 0x23: { // inc hl
+        u16 hl = ((h << 8) | l) + 1;
+        h = hl >> 8;
+        l = hl;
+        break;
+    }
+    case 0x0B: { // dec bc
+        u16 bc = ((b << 8) | c) - 1;
+        b = bc >> 8;
+        c = bc;
+        break;
+    }
+    case 0xB1: // or c
+        a |= c;
+        zero = a == 0;
+        break;
+    case 0xB5: // or l
+        a |= l;
+        zero = a == 0;
+        break;
+    case 0x0F: // rrca
+        a = (a >> 1) | (a << 7);
+        break;
+    case 0x87: // add a,a
+        a += a;
+        zero = a == 0;
+        break;
+    case 0xE6: // and n
+        a &= fetch();
+        zero = a == 0;
+        break;
+    case 0xBD: // cp l
+        zero = a == l;
+        break;
+    case 0xBB: // cp e
+        zero = a == e;
+        break;
+    case 0x28: // jr z,e
+        jumpRelative(zero);
+        break;
+    case 0x20: // jr nz,e
+        jumpRelative(!zero);
+        break;
+    case 0x18: // jr e
+        jumpRelative(true);
+        break;
+    case 0x10: // djnz e
+        jumpRelative(--b != 0);
+        break;
+    default:
+        fail_msg("Unsupported Z80 opcode %02X at %04X", opcode, pc - 1);
+    }
+}
+
+void z80_emu_reset(u8* z80Ram)
+{
+    ram = z80Ram;
+    pc = 0;
+    sp = 0;
+    a = b = c = d = e = h = l = 0;
+    memset(shadow, 0, sizeof(shadow));
+    zero = false;
+    bank = 0;
+    rom = NULL;
+    romSize = 0;
+    romAddress = 0;
+    ymBusyReads = 0;
+    ymWriteCount = 0;
+}
+
+void z80_emu_run(u16 instructions)
+{
+    while (instructions--) {
+        step();
+    }
+}
+
+void z80_emu_setYmBusyReads(u16 reads)
+{
+    ymBusyReads = reads;
+}
+
+void z80_emu_mapRom(const u8* data, u32 size, u32 address)
+{
+    rom = data;
+    romSize = size;
+    romAddress = address & 0xFFFFFF;
+}
+
+u16 z80_emu_bank(void)
+{
+    return bank;
+}
+
+u16 z80_emu_ymWriteCount(void)
+{
+    return ymWriteCount;
+}
+
+const Z80EmuYmWrite* z80_emu_ymWrite(u16 index)
+{
+    return &ymWrites[index];
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include <types.h>
+
+#define Z80_EMU_RAM_SIZE 0x2000
+#define Z80_EMU_MAX_YM_WRITES 512
+
+typedef struct Z80EmuYmWrite Z80EmuYmWrite;
+
+struct Z80EmuYmWrite {
+    u8 part;
+    u8 reg;
+    u8 data;
+};
+
+void z80_emu_reset(u8* ram);
+void z80_emu_run(u16 instructions);
+void z80_emu_setYmBusyReads(u16 reads);
+void z80_emu_mapRom(const u8* rom, u32 size, u32 address);
+u16 z80_emu_bank(void);
+u16 z80_emu_ymWriteCount(void);
+const Z80EmuYmWrite* z80_emu_ymWrite(u16 index);
@@ -0,0 +1,103 @@
+// Synthesises the unsigned 8-bit DAC drum samples in src/samples.c
+// Usage: node gen.js > src/samples.c
+
+MIDI_KEYS = 128;
+RATE = 8000;
+
+var seed = 1;
+
+function noise() {
+  seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+  return (seed / 0x3fffffff) - 1;
+}
+
+function kick(t) {
+  var sweep = 100 * 0.03 * (1 - Math.exp(-t / 0.03));
+  var phase = 2 * Math.PI * (50 * t + sweep);
+  return Math.sin(phase) * Math.exp(-t / 0.06);
+}
+
+function snare(t) {
+  return (
+    0.6 * noise() * Math.exp(-t / 0.04) +
+    0.4 * Math.sin(2 * Math.PI * 180 * t) * Math.exp(-t / 0.03)
+  );
+}
+
+var lastNoise = 0;
+
+function hat(decay) {
+  return (t) => {
+    var n = noise();
+    var highPassed = n - lastNoise;
+    lastNoise = n;
+    return 0.5 * highPassed * Math.exp(-t / decay);
+  };
+}
+
+SAMPLES = [
+  { name: "KICK", length: 1200, generate: kick, keys: [35, 36] },
+  { name: "SNARE", length: 1000, generate: snare, keys: [38, 40] },
+  { name: "CLOSED_HAT", length: 400, generate: hat(0.015), keys: [42, 44] },
+  { name: "OPEN_HAT", length: 1600, generate: hat(0.08), keys: [46] },
+];
+
+function hex(value) {
+  return "0x" + value.toString(16).toUpperCase().padStart(2, "0");
+}
+
+function render(sample) {
+  var data = [];
+  for (var i = 0; i < sample.length; i++) {
+    var value = sample.generate(i / RATE);
+    var clamped = Math.max(-1, Math.min(1, value));
+    data.push(Math.round(0x80 + clamped * 0x7f));
+  }
+  return data;
+}
+
+function formatData(data) {
+  var lines = [];
+  for (var i = 0; i < data.length; i += 12) {
+    lines.push("    " + data.slice(i, i + 12).map(hex).join(", ") + ",");
+  }
+  return lines.join("\n");
+}
+
+function formatDeclaration(name, initialiser) {
+  var declaration = "static const DacSample " + name;
+  var line = declaration + " = " + initialiser + ";";
+  return line.length <= 80
+    ? line
+    : declaration + "\n    = " + initialiser + ";";
+}
+
+function generateSample(sample) {
+  var data = sample.name + "_DATA";
+  var initialiser = "{ " + data + ", sizeof(" + data + "), " + RATE + " }";
+  return (
+    "static const u8 " + data + "[] = {\n" +
+    formatData(render(sample)) + "\n};\n\n" +
+    formatDeclaration(sample.name, initialiser) + "\n\n"
+  );
+}
+
+function generateBank() {
+  var keys = new Array(MIDI_KEYS).fill("NULL");
+  SAMPLES.forEach((sample) =>
+    sample.keys.forEach((key) => (keys[key] = "&" + sample.name))
+  );
+  var out = "const DacSample* const DAC_DRUM_SAMPLES[" + MIDI_KEYS + "] = {\n";
+  keys.forEach((entry, key) => {
+    out += "    /* " + key + " */ " + entry + ",\n";
+  });
+  return out + "};\n";
+}
+
+process.stdout.write(
+  "/* Generated by utils/dac_samples. Do not edit. */\n" +
+    '#include "samples.h"\n' +
+    "#include <stddef.h>\n\n" +
+    SAMPLES.map(generateSample).join("") +
+    generateBank()
+);
@@ -0,0 +1,175 @@
+// Generates YM2612 register images for the presets in src/presets.c
+// Usage: node gen.js < src/presets.c > src/preset_images.c
+
+fs = require("fs");
+
+MIDI_PROGRAMS = 128;
+OPERATORS = 4;
+OPERATOR_FIELDS = 11;
+CHANNEL_FIELDS = 7;
+REGISTER_SLOTS = [0, 2, 1, 3];
+
+function parsePresets(source) {
+  var presets = {};
+  var pattern = /static const (FmChannel|PercussionPreset)\s+(\w+)\s*=\s*({[^;]*});/g;
+  var match;
+  while ((match = pattern.exec(source)) !== null) {
+    var values = match[3].match(/\d+/g).map(Number);
+    presets[match[2]] = {
+      channel: parseChannel(values),
+      key: match[1] == "PercussionPreset" ? values[values.length - 1] : 0,
+    };
+  }
+  return presets;
+}
+
+function parseChannel(values) {
+  var operators = [];
+  for (var op = 0; op < OPERATORS; op++) {
+    var v = values.slice(
+      CHANNEL_FIELDS + op * OPERATOR_FIELDS,
+      CHANNEL_FIELDS + (op + 1) * OPERATOR_FIELDS
+    );
+    operators.push({
+      multiple: v[0],
+      detune: v[1],
+      attackRate: v[2],
+      rateScaling: v[3],
+      firstDecayRate: v[4],
+      amplitudeModulation: v[5],
+      secondaryAmplitude: v[6],
+      secondaryDecayRate: v[7],
+      releaseRate: v[8],
+      totalLevel: v[9],
+      ssgEg: v[10],
+    });
+  }
+  return {
+    algorithm: values[0],
+    feedback: values[1],
+    stereo: values[2],
+    ams: values[3],
+    fms: values[4],
+    operators: operators,
+  };
+}
+
+function parseBank(source, name) {
+  var match = new RegExp(name + "\\[\\d*\\]\\s*=\\s*{([^;]*)};").exec(source);
+  if (match === null) throw new Error("Bank " + name + " not found");
+  return match[1].match(/\w+/g);
+}
+
+function registerImage(chan) {
+  var groups = [
+    (op) => op.multiple + (op.detune << 4),
+    (op) => op.totalLevel,
+    (op) => op.attackRate + (op.rateScaling << 6),
+    (op) => op.firstDecayRate + (op.amplitudeModulation << 7),
+    (op) => op.secondaryDecayRate,
+    (op) => op.releaseRate + (op.secondaryAmplitude << 4),
+    (op) => op.ssgEg,
+  ];
+  var image = [
+    (chan.feedback << 3) + chan.algorithm,
+    (chan.stereo << 6) + (chan.ams << 4) + chan.fms,
+  ];
+  groups.forEach((pack) =>
+    REGISTER_SLOTS.forEach((op) => image.push(pack(chan.operators[op]) & 0xff))
+  );
+  return image;
+}
+
+function hex(value) {
+  return "0x" + value.toString(16).toUpperCase().padStart(2, "0");
+}
+
+function formatImage(image) {
+  var lines = [];
+  for (var i = 0; i < image.length; i += 10) {
+    lines.push(image.slice(i, i + 10).map(hex).join(", "));
+  }
+  return "{ " + lines.join(",\n        ") + " }";
+}
+
+function generateImages(presets, banks) {
+  var out = "";
+  var generated = {};
+  banks.forEach((bank) =>
+    bank.names.forEach((name, program) => {
+      if (presets[name] === undefined) {
+        throw new Error(bank.name + ": no preset for program " + program);
+      }
+      if (generated[name]) return;
+      generated[name] = true;
+      var image = formatImage(registerImage(presets[name].channel));
+      out += "static const FmPresetImage " + name + "_IMAGE\n";
+      out += "    = { " + image + " };\n";
+    })
+  );
+  return out;
+}
+
+function generateBankTable(bank) {
+  var out =
+    "const FmPresetImage* " + bank.name + "_IMAGES[" + MIDI_PROGRAMS + "] = {\n";
+  bank.names.forEach((name) => (out += "    &" + name + "_IMAGE,\n"));
+  return out + "};\n";
+}
+
+function generateBanks(banks) {
+  var out = "const FmPresetImage** M_BANKS[" + MIDI_PROGRAMS + "] = {\n";
+  banks.forEach(
+    (bank) => (out += "    [" + bank.number + "] = " + bank.name + "_IMAGES,\n")
+  );
+  return out + "};\n";
+}
+
+function generatePercussionBank(presets, names, name) {
+  var out =
+    "const PercussionPresetImage " + name + "[" + MIDI_PROGRAMS + "] = {\n";
+  for (var program = 0; program < MIDI_PROGRAMS; program++) {
+    var preset = presets[names[program]];
+    if (preset === undefined) {
+      throw new Error(name + ": no preset for program " + program);
+    }
+    var image = formatImage(registerImage(preset.channel));
+    out += "    /* " + program + " " + names[program] + " */\n";
+    out += "    { { " + image + " },\n        " + preset.key + " },\n";
+  }
+  return out + "};\n";
+}
+
+function parseBanks(source) {
+  var banks = [];
+  var pattern = /const FmChannel\* (M_BANK_(\d+))\[/g;
+  var match;
+  while ((match = pattern.exec(source)) !== null) {
+    var names = parseBank(source, match[1]);
+    if (names.length != MIDI_PROGRAMS) {
+      throw new Error(match[1] + ": expected " + MIDI_PROGRAMS + " presets");
+    }
+    banks.push({ name: match[1], number: Number(match[2]), names: names });
+  }
+  return banks;
+}
+
+var source = fs.readFileSync(0, "utf8");
+var presets = parsePresets(source);
+var banks = parseBanks(source);
+
+process.stdout.write(
+  "/* Generated by utils/preset_images from src/presets.c. Do not edit. */\n" +
+    '#include "presets.h"\n\n' +
+    generateImages(presets, banks) +
+    "\n" +
+    banks.map(generateBankTable).join("\n") +
+    "\n" +
+    generateBanks(banks) +
+    "\n" +
+    generatePercussionBank(
+      presets,
+      parseBank(source, "P_BANK_0"),
+      "P_BANK_0_IMAGES"
+    )
+);
@@ -0,0 +1,146 @@
+// Converts a PCM WAV file into the SysEx stream that uploads it as a DAC
+// drum sample for a MIDI key.
+// Usage: node wav2syx.js KEY [RATE] [LOOP_START LOOP_LENGTH] < in.wav > out.syx
+
+SYSEX_START = 0xf0;
+SYSEX_END = 0xf7;
+SYSEX_UPLOAD_SAMPLE = [0x00, 0x22, 0x77, 0x0c];
+CHUNK_LENGTH = 56;
+GROUP_LENGTH = 7;
+ARENA_SIZE = 0x1c00;
+DEFAULT_RATE = 8000;
+
+function fail(message) {
+  process.stderr.write(message + "\n");
+  process.exit(1);
+}
+
+function findChunk(wav, id) {
+  var offset = 12;
+  while (offset + 8 <= wav.length) {
+    var length = wav.readUInt32LE(offset + 4);
+    if (wav.toString("ascii", offset, offset + 4) === id) {
+      return wav.subarray(offset + 8, offset + 8 + length);
+    }
+    offset += 8 + length + (length & 1);
+  }
+  fail("WAV has no '" + id + "' chunk");
+}
+
+function readFrames(wav) {
+  if (
+    wav.toString("ascii", 0, 4) !== "RIFF" ||
+    wav.toString("ascii", 8, 12) !== "WAVE"
+  ) {
+    fail("Not a WAV file");
+  }
+  var format = findChunk(wav, "fmt ");
+  if (format.readUInt16LE(0) !== 1) {
+    fail("Only PCM WAV files are supported");
+  }
+  var channels = format.readUInt16LE(2);
+  var rate = format.readUInt32LE(4);
+  var bytesPerSample = format.readUInt16LE(14) / 8;
+  if (bytesPerSample < 1 || bytesPerSample > 4) {
+    fail("Unsupported bit depth");
+  }
+  var data = findChunk(wav, "data");
+  var frameLength = channels * bytesPerSample;
+  var frames = [];
+  for (var i = 0; i + frameLength <= data.length; i += frameLength) {
+    var sum = 0;
+    for (var c = 0; c < channels; c++) {
+      sum += readSample(data, i + c * bytesPerSample, bytesPerSample);
+    }
+    frames.push(sum / channels);
+  }
+  return { rate: rate, frames: frames };
+}
+
+function readSample(data, offset, bytesPerSample) {
+  if (bytesPerSample === 1) {
+    return (data[offset] - 0x80) / 0x80;
+  }
+  var bits = bytesPerSample * 8;
+  return data.readIntLE(offset, bytesPerSample) / Math.pow(2, bits - 1);
+}
+
+function resample(input, targetRate) {
+  var step = input.rate / targetRate;
+  var output = [];
+  var last = input.frames.length - 1;
+  for (var position = 0; position <= last; position += step) {
+    var index = Math.floor(position);
+    var next = Math.min(index + 1, last);
+    var fraction = position - index;
+    output.push(
+      input.frames[index] * (1 - fraction) + input.frames[next] * fraction
+    );
+  }
+  return output;
+}
+
+function toUnsigned8Bit(frames) {
+  return frames.map((value) => {
+    var clamped = Math.max(-1, Math.min(1, value));
+    return Math.round(0x80 + clamped * 0x7f);
+  });
+}
+
+function encode16BitValue(value) {
+  return [value & 0x7f, (value >> 7) & 0x7f, value >> 14];
+}
+
+function encodeChunk(data) {
+  var encoded = [];
+  for (var group = 0; group < data.length; group += GROUP_LENGTH) {
+    var bytes = data.slice(group, group + GROUP_LENGTH);
+    var msbs = 0;
+    bytes.forEach((value, i) => (msbs |= (value >> 7) << i));
+    encoded.push(msbs);
+    bytes.forEach((value) => encoded.push(value & 0x7f));
+  }
+  encoded.push(encoded.reduce((checksum, value) => checksum ^ value, 0));
+  return encoded;
+}
+
+function uploadMessage(key, rate, loopStart, loopLength, data) {
+  var message = [SYSEX_START].concat(SYSEX_UPLOAD_SAMPLE, [key]);
+  message = message.concat(
+    encode16BitValue(rate),
+    encode16BitValue(data.length),
+    encode16BitValue(loopStart),
+    encode16BitValue(loopLength)
+  );
+  for (var i = 0; i < data.length; i += CHUNK_LENGTH) {
+    message = message.concat(encodeChunk(data.slice(i, i + CHUNK_LENGTH)));
+  }
+  message.push(SYSEX_END);
+  return message;
+}
+
+function main(args) {
+  if (args.length < 1) {
+    fail("Usage: node wav2syx.js KEY [RATE] [LOOP_START LOOP_LENGTH]");
+  }
+  var key = parseInt(args[0]);
+  var rate = args.length > 1 ? parseInt(args[1]) : DEFAULT_RATE;
+  var loopStart = args.length > 2 ? parseInt(args[2]) : 0;
+  var loopLength = args.length > 3 ? parseInt(args[3]) : 0;
+  if (!(key >= 0 && key < 128)) {
+    fail("Key must be between 0 and 127");
+  }
+  var wav = require("fs").readFileSync(0);
+  var data = toUnsigned8Bit(resample(readFrames(wav), rate));
+  if (data.length > ARENA_SIZE) {
+    fail("Sample is " + data.length + " bytes; the bank holds " + ARENA_SIZE);
+  }
+  if (loopStart + loopLength > data.length) {
+    fail("Loop extends beyond the end of the sample");
+  }
+  process.stdout.write(
+    Buffer.from(uploadMessage(key, rate, loopStart, loopLength, data))
+  );
+}
+
+main(process.argv.slice(2));